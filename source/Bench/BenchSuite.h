@@ -0,0 +1,715 @@
+#pragma once
+
+#include "Engine/CoreTypes.h"
+#include "Engine/FlatMap.h"
+#include "Engine/GameManager.h"
+#include "Engine/Log.h"
+#include "Engine/Random.h"
+#include "Engine/SimulationLOD.h"
+#include "Engine/SyntheticContent.h"
+#include "Engine/TimerWheel.h"
+#include "Systems/NPCScheduleManager.h"
+#include "Systems/ReputationManager.h"
+#include "Systems/DialogueManager.h"
+#include "Systems/CombatSystem.h"
+#include "Systems/CrowdMorale.h"
+#include "Systems/SaveGameManager.h"
+#include "Systems/SaveCodec.h"
+#include "Systems/WeaponRegistry.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Nauvoo {
+
+struct FBenchOptions {
+    std::string json_file = "bench_results.json";
+    std::string filter;                 // only run benchmarks whose name contains this
+    int max_npcs = 100000;              // cap for macro town sizes
+};
+
+struct FBenchResult {
+    std::string name;
+    std::vector<std::pair<std::string, double>> metrics;
+};
+
+/**
+ * Performance benchmarks for engine and game systems.
+ * Results are printed and written as JSON so runs can be diffed across commits.
+ */
+class BenchSuite {
+public:
+    explicit BenchSuite(const FBenchOptions& bench_options = FBenchOptions()) : options(bench_options) {}
+
+    void RunAllBenchmarks() {
+        std::cout << "\n╔═══════════════════════════════════════════════════════════╗\n";
+        std::cout << "║           NAUVOO: LEGION - BENCHMARK SUITE v1.0           ║\n";
+        std::cout << "╚═══════════════════════════════════════════════════════════╝\n\n";
+
+        std::cout << "[BENCH] Micro benchmarks\n";
+        BenchGetNPCById();
+        BenchFindActivityForTime();
+        BenchGetAvailableChoices();
+        BenchRecordAction();
+        BenchSymbolMaps();
+        BenchNPCBleedFrame();
+        BenchInjuries();
+        BenchWeaponTick();
+        BenchVolley();
+        BenchEncounters();
+        BenchCombatAI();
+        BenchCrowdMorale();
+        BenchTimerWheel();
+        BenchLogging();
+        std::cout << std::endl;
+
+        std::cout << "[BENCH] Town day (macro)\n";
+        BenchTownDay();
+        std::cout << std::endl;
+
+        std::cout << "[BENCH] Save codecs\n";
+        BenchSaveCodecs();
+        std::cout << std::endl;
+
+        WriteJson();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    FBenchOptions options;
+    std::vector<FBenchResult> results;
+    volatile uint64_t sink = 0;         // keeps measured work observable
+
+    static double SecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    // Repeats a batch until the time budget is spent; the batch returns how many operations it ran
+    template <typename Fn>
+    static double MeasureNsPerOp(Fn&& batch, double min_seconds = 0.2) {
+        uint64_t ops = 0;
+        auto start = Clock::now();
+        do {
+            ops += batch();
+        } while (SecondsSince(start) < min_seconds);
+        return SecondsSince(start) * 1e9 / static_cast<double>(ops);
+    }
+
+    bool ShouldRun(const std::string& name) const {
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    }
+
+    void Report(const std::string& name, const std::vector<std::pair<std::string, double>>& metrics) {
+        std::cout << "  " << std::left << std::setw(40) << name << std::right;
+        for (const auto& metric : metrics) {
+            std::cout << "  " << metric.first << "=" << std::fixed << std::setprecision(2) << metric.second;
+        }
+        std::cout << std::endl;
+        results.push_back({ name, metrics });
+    }
+
+    std::vector<int> TownSizes(std::initializer_list<int> sizes) const {
+        std::vector<int> capped;
+        for (int size : sizes) {
+            if (size <= options.max_npcs) capped.push_back(size);
+        }
+        return capped;
+    }
+
+    // ==================== MICRO ====================
+
+    void BenchGetNPCById() {
+        for (int npc_count : TownSizes({ 100, 1000, 10000 })) {
+            std::string name = "micro/GetNPCById/" + std::to_string(npc_count);
+            if (!ShouldRun(name)) continue;
+
+            GameManager gm;
+            FSyntheticContentOptions content;
+            content.npc_count = npc_count;
+            SyntheticContentGenerator::Populate(gm, content);
+
+            FRandomStream rng(npc_count);
+            std::vector<std::string> ids;
+            for (int i = 0; i < 1024; ++i) {
+                ids.push_back(SyntheticContentGenerator::MakeNPCId(rng.NextInt(0, npc_count - 1)));
+            }
+
+            double ns = MeasureNsPerOp([&]() {
+                for (const auto& id : ids) sink = sink + (gm.GetNPCById(id) != nullptr);
+                return ids.size();
+            });
+            Report(name, { { "ns_per_op", ns } });
+        }
+    }
+
+    void BenchFindActivityForTime() {
+        std::string name = "micro/FindActivityForTime";
+        if (!ShouldRun(name)) return;
+
+        GameManager gm;
+        FSyntheticContentOptions content;
+        content.npc_count = 1000;
+        SyntheticContentGenerator::Populate(gm, content);
+
+        NPCScheduleManager* schedules = gm.GetScheduleManager();
+        std::vector<FNPC>& npcs = gm.GetAllNPCs();
+        FDateTime time = { 1841, 5, 15, 0 };
+
+        double ns = MeasureNsPerOp([&]() {
+            time.minute = (time.minute + 37) % 1440;
+            for (auto& npc : npcs) sink = sink + (schedules->GetCurrentActivity(npc, time) != nullptr);
+            return npcs.size();
+        });
+        Report(name, { { "ns_per_op", ns } });
+    }
+
+    void BenchGetAvailableChoices() {
+        std::string name = "micro/GetAvailableChoices";
+        if (!ShouldRun(name)) return;
+
+        double ns = 0.0;
+        {
+            ScopedQuietConsole quiet;
+            GameManager gm;
+            FSyntheticContentOptions content;
+            content.npc_count = 10;
+            content.dialogue_tree_count = 1;
+            content.choices_per_node = 8;
+            SyntheticContentGenerator::Populate(gm, content);
+
+            DialogueManager* dialogue = gm.GetDialogueManager();
+            const std::string npc_id = SyntheticContentGenerator::MakeNPCId(0);
+            dialogue->StartDialogue(npc_id, "dialogue_synthetic_0");
+
+            ns = MeasureNsPerOp([&]() {
+                for (int i = 0; i < 256; ++i) sink = sink + dialogue->GetAvailableChoices(npc_id).size();
+                return 256;
+            });
+        }
+        Report(name, { { "ns_per_op", ns } });
+    }
+
+    void BenchRecordAction() {
+        std::string name = "micro/RecordAction";
+        if (!ShouldRun(name)) return;
+
+        const FSymbol ATTEND_DRILL = MakeSymbol("attend_drill");
+        const FSymbol SKIP_DRILL = MakeSymbol("skip_drill");
+        double ns = 0.0;
+        {
+            ScopedQuietConsole quiet;
+            ReputationManager reputation;
+            ns = MeasureNsPerOp([&]() {
+                for (int i = 0; i < 64; ++i) {
+                    reputation.RecordAction(i % 2 ? ATTEND_DRILL : SKIP_DRILL, {});
+                }
+                return 64;
+            });
+        }
+        Report(name, { { "ns_per_op", ns } });
+    }
+
+    // Hits in random order and one full pass, for each map type the managers could key by symbol
+    void BenchSymbolMaps() {
+        for (int entry_count : TownSizes({ 16, 1000, 10000 })) {
+            BenchSymbolMap<std::map<FSymbol, FReputationData>>("std_map", entry_count);
+            BenchSymbolMap<std::unordered_map<FSymbol, FReputationData>>("unordered_map", entry_count);
+            BenchSymbolMap<TFlatHashMap<FSymbol, FReputationData>>("flat_hash", entry_count);
+            BenchSymbolMap<TFlatSortedMap<FSymbol, FReputationData>>("flat_sorted", entry_count);
+        }
+    }
+
+    template <typename TMap>
+    void BenchSymbolMap(const char* container, int entry_count) {
+        std::string name = std::string("micro/SymbolMap/") + container + "/" + std::to_string(entry_count);
+        if (!ShouldRun(name)) return;
+
+        TMap map;
+        std::vector<FSymbol> keys;
+        for (int i = 0; i < entry_count; ++i) {
+            FSymbol key(SyntheticContentGenerator::MakeNPCId(i));
+            keys.push_back(key);
+            map[key].trust = i % 200 - 100;
+        }
+
+        FRandomStream rng(entry_count);
+        std::vector<FSymbol> probes;
+        for (int i = 0; i < 1024; ++i) probes.push_back(keys[rng.NextInt(0, entry_count - 1)]);
+
+        double lookup_ns = MeasureNsPerOp([&]() {
+            for (FSymbol key : probes) {
+                auto it = map.find(key);
+                sink = sink + (it != map.end() ? it->second.trust : 0);
+            }
+            return probes.size();
+        });
+        double iterate_ns = MeasureNsPerOp([&]() {
+            int64_t total = 0;
+            for (const auto& entry : map) total += entry.second.trust;
+            sink = sink + total;
+            return map.size();
+        });
+        Report(name, { { "lookup_ns", lookup_ns }, { "iterate_ns_per_entry", iterate_ns } });
+    }
+
+    void BenchLogging() {
+        std::string name = "micro/Log";
+        if (!ShouldRun(name)) return;
+
+        Logger& logger = Logger::Get();
+        const uint32_t previous_mask = Logger::GetCategoryMask();
+        const std::string npc_id = "npc_synthetic_42";
+
+        // Masked-out category: the cost every filtered call site pays
+        Logger::SetCategoryMask(previous_mask & ~static_cast<uint32_t>(ELogCategory::COMBAT));
+        double disabled_ns = MeasureNsPerOp([&]() {
+            for (int i = 0; i < 1024; ++i) {
+                NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[Bench] ", npc_id, " health: ", i, "/", 100.0f);
+            }
+            return 1024;
+        });
+        Logger::SetCategoryMask(previous_mask);
+
+        // Enabled call including the writer draining it (console sink off so only formatting is timed)
+        logger.SetConsoleEnabled(false);
+        double enqueue_ns = 0.0;
+        {
+            ScopedLogLevel level(ELogLevel::WARNING);
+            enqueue_ns = MeasureNsPerOp([&]() {
+                for (int i = 0; i < 1024; ++i) {
+                    NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[Bench] ", npc_id, " health: ", i, "/", 100.0f);
+                }
+                logger.Flush();
+                return 1024;
+            });
+        }
+        logger.SetConsoleEnabled(true);
+
+        Report(name, { { "disabled_ns_per_call", disabled_ns }, { "enabled_with_drain_ns_per_call", enqueue_ns } });
+    }
+
+    // Per-frame bleeding cost of a town full of wounded NPCs, reported per NPC
+    void BenchNPCBleedFrame() {
+        std::string name = "micro/NPCBleedFrame";
+        if (!ShouldRun(name)) return;
+
+        GameManager gm;
+        CombatSystem* combat = gm.GetCombatSystem();
+
+        {
+            ScopedQuietConsole quiet;
+            for (int i = 0; i < 1000; ++i) {
+                FNPC npc = SyntheticContentGenerator::MakeNPC(i);
+                for (int k = 0; k < 3; ++k) {
+                    FInjury injury;
+                    injury.type = EInjuryType::LACERATION;
+                    injury.location = static_cast<EBodyPart>(k);
+                    injury.SetBleedRate(0.01f);
+                    injury.is_treated = (k == 2);
+                    npc.injuries.push_back(injury);
+                }
+                gm.SpawnNPC(npc);
+            }
+        }
+
+        double ns = MeasureNsPerOp([&]() {
+            combat->AdvanceTime(0.0001f);
+            combat->ProcessTimers(gm.GetAllNPCs());
+            return gm.GetAllNPCs().size();
+        });
+        Report(name, { { "ns_per_npc", ns }, { "scheduled_deaths", static_cast<double>(combat->GetScheduledDeathCount()) } });
+    }
+
+    // Wound 1000 NPCs three times each and treat every wound, reported per wound
+    void BenchInjuries() {
+        std::string name = "micro/Injuries";
+        if (!ShouldRun(name)) return;
+
+        GameManager gm;
+        CombatSystem* combat = gm.GetCombatSystem();
+        {
+            ScopedQuietConsole quiet;
+            for (int i = 0; i < 1000; ++i) gm.SpawnNPC(SyntheticContentGenerator::MakeNPC(i));
+        }
+        std::vector<FNPC>& npcs = gm.GetAllNPCs();
+
+        double ns = 0.0;
+        {
+            ScopedQuietConsole quiet;
+            ns = MeasureNsPerOp([&]() {
+                for (FNPC& npc : npcs) {
+                    npc.injuries.clear();
+                    npc.health = npc.max_health;
+                    for (int k = 0; k < 3; ++k) combat->ApplyDamageToNPC(npc, 1.0f, static_cast<EBodyPart>(k), "bench");
+                    for (int k = 0; k < 3; ++k) combat->TreatInjury(npc, k);
+                }
+                return npcs.size() * 3;
+            });
+        }
+        Report(name, { { "ns_per_wound_and_treatment", ns },
+                       { "bytes_per_wounded_npc", static_cast<double>(sizeof(FInjuryList)) } });
+    }
+
+    // A skirmish where every armed NPC fires and reloads; per weapon per tick, firing included
+    void BenchWeaponTick() {
+        for (int armed_count : TownSizes({ 100, 1000, 10000 })) {
+            std::string name = "micro/WeaponTick/" + std::to_string(armed_count);
+            if (!ShouldRun(name)) continue;
+
+            double ns = 0.0;
+            {
+                ScopedQuietConsole quiet;
+                GameManager gm;
+                gm.Initialize();
+                CombatSystem* combat = gm.GetCombatSystem();
+                const FSymbol weapons[] = { MakeSymbol("weapon_musket"), MakeSymbol("weapon_rifle"), MakeSymbol("weapon_revolver") };
+                std::vector<FSymbol> shooters;
+                for (int i = 0; i < armed_count; ++i) {
+                    shooters.push_back(FSymbol(SyntheticContentGenerator::MakeNPCId(i)));
+                    combat->EquipWeapon(shooters.back(), weapons[i % 3]);
+                }
+
+                const int ticks = 60;
+                ns = MeasureNsPerOp([&]() {
+                    for (FSymbol shooter : shooters) sink = sink + static_cast<uint64_t>(combat->DischargeWeapon(shooter));
+                    for (int tick = 0; tick < ticks; ++tick) combat->AdvanceTime(0.25f);
+                    return shooters.size() * ticks;
+                });
+            }
+            Report(name, { { "ns_per_weapon_tick", ns } });
+        }
+    }
+
+    // A line of militia fires one volley at a single target and reloads, reported per shot
+    void BenchVolley() {
+        for (int line_size : { 50, 500 }) {
+            std::string name = "micro/Volley/" + std::to_string(line_size);
+            if (!ShouldRun(name)) continue;
+
+            double ns = 0.0;
+            {
+                ScopedQuietConsole quiet;
+                GameManager gm;
+                gm.Initialize();
+                CombatSystem* combat = gm.GetCombatSystem();
+                FNPC target;
+                target.id = "bench_volley_target";
+                target.health = target.max_health = 1e9f;
+                target.position = { 0, 60, 0 };
+                gm.SpawnNPC(target);
+                std::vector<FNPC>& npcs = gm.GetAllNPCs();
+                uint32_t target_index = static_cast<uint32_t>(npcs.size() - 1);
+
+                FVolley volley;
+                for (int i = 0; i < line_size; ++i) {
+                    FSymbol militia(SyntheticContentGenerator::MakeNPCId(i));
+                    combat->EquipWeapon(militia, MakeSymbol("weapon_musket"));
+                    volley.AddShot(militia, { static_cast<float>(i) * 0.8f, 0, 0 }, EStance::STANDING, target_index, target.position);
+                }
+                const float ready_time = 60.0f;     // past any musket's reload
+
+                ns = MeasureNsPerOp([&]() {
+                    FVolleyResult result = combat->FireVolley(volley, npcs, gm.GetPlayerState());
+                    sink = sink + static_cast<uint64_t>(result.hits);
+                    combat->AdvanceTime(ready_time);
+                    npcs[target_index].injuries.clear();
+                    combat->RefreshBleeding(npcs[target_index]);
+                    return volley.GetCount();
+                });
+            }
+            Report(name, { { "ns_per_shot", ns } });
+        }
+    }
+
+    // Riots on several fronts: the per-tick encounter pass over every combatant, reported per combatant
+    void BenchEncounters() {
+        for (int combatant_count : { 100, 1000 }) {
+            std::string name = "micro/Encounters/" + std::to_string(combatant_count);
+            if (!ShouldRun(name)) continue;
+
+            double ns = 0.0;
+            {
+                ScopedQuietConsole quiet;
+                GameManager gm;
+                gm.Initialize();
+                FSyntheticContentOptions content;
+                content.npc_count = combatant_count;
+                SyntheticContentGenerator::Populate(gm, content);
+                CombatSystem* combat = gm.GetCombatSystem();
+                EncounterManager& encounters = combat->GetEncounters();
+                std::vector<FNPC>& npcs = gm.GetAllNPCs();
+
+                const int per_front = 24;
+                FEncounterId front = INVALID_ENCOUNTER;
+                for (int i = 0; i < combatant_count; ++i) {
+                    if (i % per_front == 0) front = encounters.StartEncounter(combat->GetClock(), 1e9);
+                    encounters.Join(front, static_cast<uint8_t>(i % 3), npcs, static_cast<uint32_t>(i));
+                }
+
+                const int ticks = 100;
+                ns = MeasureNsPerOp([&]() {
+                    for (int tick = 0; tick < ticks; ++tick) combat->UpdateEncounters(npcs, gm.GetPlayerState());
+                    sink = sink + encounters.GetParticipantCount();
+                    return encounters.GetParticipantCount() * ticks;
+                });
+            }
+            Report(name, { { "ns_per_combatant_tick", ns } });
+        }
+    }
+
+    // 1000 combatants in encounters of 24, half of them armed: every one replanned each update,
+    // then the default rolling replan at 60 fps
+    void BenchCombatAI() {
+        std::string name = "micro/CombatAI/1000";
+        if (!ShouldRun(name)) return;
+
+        const int combatant_count = 1000;
+        double ns_per_decision = 0.0;
+        double us_per_frame = 0.0;
+        {
+            ScopedQuietConsole quiet;
+            GameManager gm;
+            gm.Initialize();
+            FSyntheticContentOptions content;
+            content.npc_count = combatant_count;
+            SyntheticContentGenerator::Populate(gm, content);
+            CombatSystem* combat = gm.GetCombatSystem();
+            EncounterManager& encounters = combat->GetEncounters();
+            std::vector<FNPC>& npcs = gm.GetAllNPCs();
+
+            const int per_front = 24;
+            FEncounterId front = INVALID_ENCOUNTER;
+            for (int i = 0; i < combatant_count; ++i) {
+                if (i % per_front == 0) front = encounters.StartEncounter(combat->GetClock(), 1e9);
+                uint8_t side = static_cast<uint8_t>(i % 2);
+                npcs[i].position = { static_cast<float>(i % per_front), (i / per_front) * 1000.0f + side * 60.0f, 0.0f };
+                npcs[i].faction = side == 0 ? EFaction::LEGION_SOLDIER : EFaction::OUTSIDER;
+                encounters.Join(front, side, npcs, static_cast<uint32_t>(i));
+                if (i % 4 < 2) combat->EquipWeapon(FSymbol(npcs[i].id), MakeSymbol("weapon_musket"));
+            }
+
+            const int updates = 10;
+            combat->SetReplanInterval(0.0f);
+            ns_per_decision = MeasureNsPerOp([&]() {
+                for (int update = 0; update < updates; ++update) combat->UpdateEnemyBehavior(npcs, gm.GetPlayerState(), 1.0f / 60.0f);
+                sink = sink + static_cast<uint64_t>(npcs[0].combat_action);
+                return static_cast<uint64_t>(combatant_count) * updates;
+            });
+
+            const int frames = 60;
+            combat->SetReplanInterval(0.5f);
+            us_per_frame = MeasureNsPerOp([&]() {
+                for (int frame = 0; frame < frames; ++frame) combat->UpdateEnemyBehavior(npcs, gm.GetPlayerState(), 1.0f / 60.0f);
+                sink = sink + static_cast<uint64_t>(npcs[1].combat_action);
+                return static_cast<uint64_t>(frames);
+            }) / 1000.0;
+        }
+        Report(name, { { "ns_per_decision", ns_per_decision }, { "us_per_frame", us_per_frame } });
+    }
+
+    // A 500-strong mob on a 60 m square under steady gunfire, reported per NPC update
+    void BenchCrowdMorale() {
+        std::string name = "micro/CrowdMorale/500";
+        if (!ShouldRun(name)) return;
+
+        const uint32_t crowd_size = 500;
+        std::vector<FNPC> npcs(crowd_size);
+        FNPCTickList crowd;
+        FRandomStream positions(42);
+        for (uint32_t i = 0; i < crowd_size; ++i) {
+            npcs[i].position = { positions.NextFloat() * 60.0f, positions.NextFloat() * 60.0f, 0.0f };
+            npcs[i].is_in_combat = i % 5 == 0;
+            crowd.Add(i, 1.0f / 60.0f);
+        }
+        CrowdMorale morale;
+
+        const int frames = 60;
+        double ns = MeasureNsPerOp([&]() {
+            for (int frame = 0; frame < frames; ++frame) {
+                if (frame % 10 == 0) morale.AddStimulus(npcs[frame].position, CrowdMorale::GUNFIRE_FEAR, 0.0f);
+                morale.Update(npcs, crowd);
+            }
+            sink = sink + morale.GetPanickingCount();
+            return static_cast<uint64_t>(crowd_size) * frames;
+        });
+        Report(name, { { "ns_per_npc_update", ns }, { "us_per_frame", ns * crowd_size / 1000.0 } });
+    }
+
+    // Schedule, cancel half and fire the rest of a day of game-minute timers, reported per timer
+    void BenchTimerWheel() {
+        std::string name = "micro/TimerWheel";
+        if (!ShouldRun(name)) return;
+
+        const int timer_count = 10000;
+        TimerWheel wheel;
+        std::vector<FTimerHandle> handles(timer_count);
+        uint64_t fired = 0;
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+
+        double ns = MeasureNsPerOp([&]() {
+            uint64_t start = wheel.GetCurrentTick();
+            for (int i = 0; i < timer_count; ++i) {
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+                handles[i] = wheel.Schedule(start + 1 + (state >> 33) % 1440, [&fired]() { fired++; });
+            }
+            for (int i = 0; i < timer_count; i += 2) wheel.Cancel(handles[i]);
+            wheel.Advance(start + 1440);
+            return timer_count;
+        });
+        Report(name, { { "ns_per_timer", ns }, { "fired", static_cast<double>(fired) } });
+    }
+
+    // ==================== MACRO ====================
+
+    void BenchTownDay() {
+        for (int npc_count : TownSizes({ 100, 1000, 10000, 100000 })) {
+            std::string name = "macro/TownDay/" + std::to_string(npc_count);
+            if (!ShouldRun(name)) continue;
+
+            const float delta_time = 0.016f;
+            const int ticks = 1440;  // one game minute per tick
+            FSystemTimings timings;
+            double seconds = 0.0;
+
+            {
+                ScopedQuietConsole quiet;
+                GameManager gm;
+                gm.Initialize();
+                FSyntheticContentOptions content;
+                content.npc_count = npc_count;
+                content.wounded_fraction = 0.05f;
+                SyntheticContentGenerator::Populate(gm, content);
+
+                gm.SetTimeScale(1.0f / delta_time);
+                gm.EnableSystemTimings(true);
+
+                auto start = Clock::now();
+                for (int tick = 0; tick < ticks; ++tick) {
+                    gm.Update(delta_time);
+                }
+                seconds = SecondsSince(start);
+                timings = gm.GetSystemTimings();
+            }
+
+            Report(name, {
+                { "wall_ms", seconds * 1000.0 },
+                { "ticks_per_sec", ticks / seconds },
+                { "ns_per_npc_tick", seconds * 1e9 / (static_cast<double>(ticks) * npc_count) },
+                { "schedules_ms", timings.schedule_seconds * 1000.0 },
+                { "enemy_ai_ms", timings.enemy_ai_seconds * 1000.0 },
+                { "npc_health_ms", timings.npc_health_seconds * 1000.0 }
+            });
+        }
+    }
+
+    // ==================== SAVE CODECS ====================
+
+    // Representative mid-campaign world: many NPCs sharing ids, occupations and locations
+    static FWorldState BuildRepresentativeWorld(int npc_count, std::vector<FScheduleActivity>& activities) {
+        FWorldState world;
+        world.current_time = { 1841, 6, 2, 780 };
+        for (const char* event_id : { "event_drill_begins", "event_patrol_at_gate", "event_marks_greeting" }) {
+            world.world_events.Trigger(world.world_events.Intern(event_id));
+        }
+        world.world_events.Complete(world.world_events.Find("event_marks_greeting"));
+
+        FNPCSchedule schedule = SyntheticContentGenerator::MakeSchedule("npc_template", 0);
+        activities = schedule.daily_routine;
+
+        for (int i = 0; i < npc_count; ++i) {
+            FNPC npc = SyntheticContentGenerator::MakeNPC(i);
+            npc.current_activity = &activities[i % activities.size()];
+            if (i % 10 == 0) {
+                FInjury injury;
+                injury.type = EInjuryType::BRUISE;
+                injury.location = EBodyPart::LEFT_ARM;
+                injury.severity = 2;
+                npc.injuries.push_back(injury);
+                npc.health = 85.0f;
+            }
+            world.all_npcs.push_back(npc);
+        }
+
+        return world;
+    }
+
+    void BenchSaveCodecs() {
+        SaveGameManager save_manager;
+
+        for (int npc_count : TownSizes({ 100, 1000, 10000 })) {
+            std::vector<FScheduleActivity> activities;
+            FWorldState world = BuildRepresentativeWorld(npc_count, activities);
+            std::string payload = save_manager.BuildSavePayload(world);
+
+            for (ESaveCodec codec_id : { ESaveCodec::STORE, ESaveCodec::LZ }) {
+                const ISaveCodec* codec = GetSaveCodec(codec_id);
+                std::string name = std::string("save/") + codec->GetName() + "/" + std::to_string(npc_count);
+                if (!ShouldRun(name)) continue;
+
+                std::string encoded, decoded;
+                double encode_ns = MeasureNsPerOp([&]() { codec->Encode(payload, encoded); return 1; });
+                double decode_ns = MeasureNsPerOp([&]() { codec->Decode(encoded, payload.size(), decoded); return 1; });
+
+                double megabytes = payload.size() / (1024.0 * 1024.0);
+                Report(name, {
+                    { "raw_bytes", static_cast<double>(payload.size()) },
+                    { "encoded_bytes", static_cast<double>(encoded.size()) },
+                    { "ratio", static_cast<double>(payload.size()) / encoded.size() },
+                    { "encode_mb_per_sec", megabytes / (encode_ns * 1e-9) },
+                    { "decode_mb_per_sec", megabytes / (decode_ns * 1e-9) },
+                    { "round_trip_ok", decoded == payload ? 1.0 : 0.0 }
+                });
+            }
+        }
+    }
+
+    // ==================== OUTPUT ====================
+
+    void WriteJson() const {
+        if (options.json_file.empty()) return;
+
+        std::ofstream file(options.json_file);
+        if (!file.is_open()) {
+            std::cerr << "[BENCH] Could not write " << options.json_file << std::endl;
+            return;
+        }
+
+        const char* commit = std::getenv("NAUVOO_GIT_COMMIT");
+#ifdef NDEBUG
+        const char* build = "release";
+#else
+        const char* build = "debug";
+#endif
+
+        file << "{\n";
+        file << "  \"suite\": \"nauvoo_bench\",\n";
+        file << "  \"commit\": \"" << (commit ? commit : "unknown") << "\",\n";
+        file << "  \"build\": \"" << build << "\",\n";
+        file << "  \"timestamp\": " << static_cast<long long>(std::time(nullptr)) << ",\n";
+        file << "  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            file << "    { \"name\": \"" << results[i].name << "\"";
+            for (const auto& metric : results[i].metrics) {
+                double value = std::isfinite(metric.second) ? metric.second : 0.0;
+                file << ", \"" << metric.first << "\": " << std::setprecision(6) << value;
+            }
+            file << " }" << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        file << "  ]\n";
+        file << "}\n";
+
+        std::cout << "[BENCH] Results written to " << options.json_file << std::endl;
+    }
+};
+
+}  // namespace Nauvoo
@@ -0,0 +1,31 @@
+#include "Bench/BenchSuite.h"
+#include <iostream>
+#include <string>
+#include <cstdlib>
+
+int main(int argc, char** argv) {
+    Nauvoo::FBenchOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (arg == "--json" && has_value) options.json_file = argv[++i];
+        else if (arg == "--filter" && has_value) options.filter = argv[++i];
+        else if (arg == "--max-npcs" && has_value) options.max_npcs = std::atoi(argv[++i]);
+        else {
+            std::cout << "Usage: " << argv[0] << " [--json FILE] [--filter SUBSTRING] [--max-npcs N]\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    try {
+        Nauvoo::BenchSuite suite(options);
+        suite.RunAllBenchmarks();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "BENCHMARK ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include "FlatMap.h"
+#include "Memory.h"
+#include "Symbol.h"
+#include "WorldEventRegistry.h"
+#include <algorithm>
 #include <string>
 #include <vector>
-#include <map>
-#include <unordered_map>
 #include <cmath>
+#include <cstdint>
 
 namespace Nauvoo {
 
@@ -41,7 +45,7 @@ enum class EActivityType {
     IDLE
 };
 
-enum class EBodyPart {
+enum class EBodyPart : uint8_t {
     HEAD,
     TORSO,
     LEFT_ARM,
@@ -50,7 +54,7 @@ enum class EBodyPart {
     RIGHT_LEG
 };
 
-enum class EInjuryType {
+enum class EInjuryType : uint8_t {
     LACERATION,
     BRUISE,
     FRACTURE,
@@ -83,10 +87,27 @@ enum class EStance {
     BEHIND_COVER
 };
 
+// What an NPC in an encounter has decided to do (see CombatAI.h)
+enum class ECombatAction : uint8_t {
+    NONE,
+    ENGAGE,         // hold position and fire
+    ADVANCE,        // close on the enemy
+    TAKE_COVER,
+    RELOAD,
+    RETREAT         // leave the encounter
+};
+
+// How closely an NPC is simulated (see SimulationLOD.h)
+enum class ESimulationLOD : uint8_t {
+    FULL,           // every frame
+    REDUCED,        // every few frames, catching up on the skipped time
+    DORMANT         // only when something needs the NPC
+};
+
 // ==================== BASIC DATA STRUCTURES ====================
 
 struct FVector3 {
-    float x, y, z;
+    float x = 0.0f, y = 0.0f, z = 0.0f;
     
     FVector3 operator+(const FVector3& other) const {
         return { x + other.x, y + other.y, z + other.z };
@@ -105,15 +126,20 @@ struct FVector3 {
 };
 
 struct FDateTime {
-    int year;
-    int month;      // 1-12
-    int day;        // 1-31
-    int minute;     // 0-1440 (game minutes per day)
+    int year = 0;
+    int month = 1;      // 1-12
+    int day = 1;        // 1-30 (GameManager::AdvanceClock rolls months every 30 days)
+    int minute = 0;     // 0-1440 (game minutes per day)
     
     int GetTotalGameMinutes() const {
         return (year * 525600) + (month * 43800) + (day * 1440) + minute;
     }
     
+    // Minutes since year 0 on the game calendar, so differences match the minutes the clock advanced
+    int64_t GetCalendarMinutes() const {
+        return ((static_cast<int64_t>(year) * 12 + (month - 1)) * 30 + (day - 1)) * 1440 + minute;
+    }
+    
     EFormatSeason GetSeason() const {
         int m = month;
         if (m >= 3 && m <= 5) return EFormatSeason::SPRING;
@@ -126,7 +152,7 @@ struct FDateTime {
 // ==================== NPC RELATED ====================
 
 struct FRelationship {
-    std::string target_npc_id;
+    FSymbol target_npc_id;
     int trust = 0;              // -100 to 100
     int fear = 0;               // 0 to 100
     int respect = 0;            // -100 to 100
@@ -135,11 +161,11 @@ struct FRelationship {
 };
 
 struct FPlayerAction {
-    std::string action_id;
+    FSymbol action_id;
     FDateTime timestamp;
     FVector3 location;
     std::string description;
-    std::vector<std::string> witnesses;  // NPC IDs who saw this
+    std::vector<FSymbol> witnesses;     // NPCs who saw this
 };
 
 struct FActionMemory {
@@ -149,23 +175,101 @@ struct FActionMemory {
     int relevance = 5;  // 1-10, how much they care
 };
 
+// Memories come and go all game; up to four fit one pooled block (see TPoolAllocator)
+using FActionMemoryList = std::vector<FActionMemory, TPoolAllocator<FActionMemory, 4>>;
+
 struct FReputationData {
-    std::string npc_id;
+    FSymbol npc_id;
     int trust = 0;                      // -100 to 100
     int fear = 0;                       // 0 to 100
     int respect = 0;                    // -100 to 100
-    std::vector<FActionMemory> memories;
+    FActionMemoryList memories;
     std::vector<std::string> dialogue_locked;  // dialogue options not available
 };
 
+// Packed to 12 bytes: wounded NPCs carry many and the bleed loops sweep them all
 struct FInjury {
-    EInjuryType type;
-    EBodyPart location;
-    int severity = 1;              // 1-10
-    float bleed_rate = 0.0f;        // HP per second
+    EInjuryType type = EInjuryType::LACERATION;
+    EBodyPart location = EBodyPart::TORSO;
+    uint8_t severity = 1;               // 1-10
     bool is_treated = false;
     bool infection_risk = false;
-    FDateTime timestamp;
+    uint16_t bleed_centi = 0;           // hundredths of HP per second
+    uint32_t wounded_minute = 0;        // game minute on the game timer clock
+    
+    float GetBleedRate() const { return static_cast<float>(bleed_centi) * 0.01f; }
+    void SetBleedRate(float hp_per_second) {
+        float centi = std::round(hp_per_second * 100.0f);
+        bleed_centi = static_cast<uint16_t>(centi < 0.0f ? 0.0f : (centi > 65535.0f ? 65535.0f : centi));
+    }
+};
+
+static_assert(sizeof(FInjury) == 12, "FInjury is packed");
+
+/**
+ * A character's injuries, in the order received. The first INLINE_CAPACITY
+ * live inside the list itself, so most wounded characters never allocate;
+ * past that the whole list moves into one pooled overflow block and stays
+ * there. Either way the injuries are contiguous, and indices are stable
+ * while injuries are only appended.
+ */
+class FInjuryList {
+public:
+    static constexpr uint32_t INLINE_CAPACITY = 4;
+    
+    FInjuryList() = default;
+    FInjuryList(const FInjuryList&) = default;
+    FInjuryList& operator=(const FInjuryList&) = default;
+    // Moving takes the overflow block; the source is left empty rather than counting injuries it no longer holds
+    FInjuryList(FInjuryList&& other) noexcept { *this = std::move(other); }
+    FInjuryList& operator=(FInjuryList&& other) noexcept {
+        if (this == &other) return *this;
+        overflow = std::move(other.overflow);
+        if (overflow.empty()) std::copy(other.slots, other.slots + other.count, slots);
+        count = other.count;
+        other.count = 0;
+        other.overflow.clear();
+        return *this;
+    }
+    
+    void push_back(const FInjury& injury) {
+        if (!overflow.empty() || count == INLINE_CAPACITY) {
+            if (overflow.empty()) overflow.assign(slots, slots + count);
+            overflow.push_back(injury);
+        } else {
+            slots[count] = injury;
+        }
+        count++;
+    }
+    void pop_back() {
+        count--;
+        if (!overflow.empty()) overflow.pop_back();
+    }
+    // Keeps an overflow block for the next wounds; a character wounded that often will be again
+    void clear() {
+        count = 0;
+        overflow.clear();
+    }
+    
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool IsOverflowing() const { return !overflow.empty(); }
+    
+    FInjury* data() { return overflow.empty() ? slots : overflow.data(); }
+    const FInjury* data() const { return overflow.empty() ? slots : overflow.data(); }
+    FInjury* begin() { return data(); }
+    FInjury* end() { return data() + count; }
+    const FInjury* begin() const { return data(); }
+    const FInjury* end() const { return data() + count; }
+    FInjury& operator[](size_t index) { return data()[index]; }
+    const FInjury& operator[](size_t index) const { return data()[index]; }
+    FInjury& back() { return data()[count - 1]; }
+    const FInjury& back() const { return data()[count - 1]; }
+    
+private:
+    FInjury slots[INLINE_CAPACITY];
+    uint32_t count = 0;
+    std::vector<FInjury, TPoolAllocator<FInjury, 16>> overflow;
 };
 
 struct FScheduleActivity {
@@ -180,12 +284,13 @@ struct FScheduleActivity {
 struct FNPCSchedule {
     std::string npc_id;
     std::vector<FScheduleActivity> daily_routine;
-    std::map<EFormatSeason, std::vector<FScheduleActivity>> seasonal_overrides;
+    TFlatSortedMap<EFormatSeason, std::vector<FScheduleActivity>> seasonal_overrides;
     std::vector<std::pair<std::string, std::vector<FScheduleActivity>>> event_overrides;
 };
 
 struct FNPC {
     std::string id;
+    FSymbol symbol;                     // id, interned once by CombatSystem::RegisterNPC (spawn and load)
     std::string name;
     int age = 25;
     std::string occupation;
@@ -196,12 +301,12 @@ struct FNPC {
     FVector3 position;
     float health = 100.0f;
     float max_health = 100.0f;
-    std::vector<FInjury> injuries;
+    FInjuryList injuries;
     
     // Relationships
-    std::map<std::string, FRelationship> relationships;  // NPC_ID -> Relationship
+    TFlatHashMap<FSymbol, FRelationship> relationships;  // NPC -> Relationship
     FReputationData reputation_with_player;
-    std::vector<FActionMemory> memory_of_player;
+    FActionMemoryList memory_of_player;
     
     // Schedule
     FNPCSchedule schedule;
@@ -210,7 +315,23 @@ struct FNPC {
     // Behavior
     bool is_alive = true;
     bool is_in_combat = false;
-    FVector3 combat_target_position;
+    ECombatAction combat_action = ECombatAction::NONE;     // last decision of the combat AI
+    EStance stance = EStance::STANDING;
+    FVector3 combat_target_position;                        // where the enemy side stood at that decision
+    
+    // Crowd morale (maintained by CrowdMorale)
+    float fear = 0.0f;                  // 0-1
+    float anger = 0.0f;                 // 0-1
+    bool is_panicking = false;
+    FVector3 flee_direction;            // unit, away from what frightened them, while panicking
+    
+    // Bleeding (maintained by CombatSystem)
+    float bleed_rate = 0.0f;            // sum over untreated injuries
+    double health_updated_at = 0.0;     // combat clock time `health` is current as of
+    
+    // Simulation level of detail
+    ESimulationLOD simulation_lod = ESimulationLOD::FULL;
+    float unsimulated_seconds = 0.0f;   // time skipped while not ticked, applied on the next tick
 };
 
 // ==================== PLAYER RELATED ====================
@@ -223,7 +344,8 @@ struct FPlayerState {
     float max_health = 100.0f;
     float stamina = 100.0f;
     float max_stamina = 100.0f;
-    std::vector<FInjury> injuries;
+    FInjuryList injuries;
+    float bleed_rate = 0.0f;            // sum over untreated injuries (maintained by CombatSystem)
     EStance stance = EStance::STANDING;
     
     // Equipment
@@ -280,7 +402,7 @@ struct FDialogueNode {
     
     // Condition node
     std::string condition_type;
-    std::map<std::string, std::string> condition_parameters;
+    TFlatSortedMap<std::string, std::string> condition_parameters;
     std::string true_branch_node_id;
     std::string false_branch_node_id;
     
@@ -305,10 +427,14 @@ struct FDialogueTree {
 
 // ==================== WEAPON SYSTEM ====================
 
-struct FWeapon {
+using FWeaponArchetypeId = uint16_t;
+constexpr FWeaponArchetypeId INVALID_WEAPON_ARCHETYPE = 0xFFFF;
+
+// Stats shared by every weapon of one kind; loaded into the WeaponRegistry and never changed
+struct FWeaponArchetype {
     std::string id;
     std::string name;
-    EWeaponType type;
+    EWeaponType type = EWeaponType::MUSKET;
     
     // Stats
     float fire_rate = 1.0f;              // seconds between shots
@@ -319,13 +445,38 @@ struct FWeapon {
     float stamina_cost = 10.0f;
     
     // Ammo
-    int current_ammo = 6;
-    int max_ammo = 6;
+    int max_ammo = 6;                    // 0 = melee, never reloads
     float misfire_chance = 0.05f;        // 5% base misfire rate
+    float fouling_per_shot = 0.0f;       // powder residue each shot leaves (fouling is 0-1)
+};
+
+// One character's weapon: its archetype plus what changes as it is used
+struct FWeaponState {
+    FWeaponArchetypeId archetype = INVALID_WEAPON_ARCHETYPE;
+    uint16_t ammo = 0;
+    float cooldown = 0.0f;               // seconds until it can fire again
+    float reload_remaining = 0.0f;       // seconds; reloading while > 0
+    float fouling = 0.0f;                // 0-1, adds to the misfire chance until cleaned
     
-    // State
-    bool is_reloading = false;
-    float reload_progress = 0.0f;        // 0-1
+    bool IsReloading() const { return reload_remaining > 0.0f; }
+};
+
+// ==================== SCENARIO RELATED ====================
+
+enum class EScenarioStatus : uint8_t {
+    LOCKED,         // waiting on its trigger, prerequisite or start time
+    ACTIVE,
+    COMPLETED,
+    FAILED
+};
+
+// Progress through one scenario (see ScenarioManager); bit i of a mask is objective or event i
+struct FScenarioProgress {
+    FSymbol scenario_id;
+    EScenarioStatus status = EScenarioStatus::LOCKED;
+    uint32_t objectives_done = 0;
+    uint32_t events_fired = 0;
+    uint32_t times_completed = 0;
 };
 
 // ==================== WORLD STATE ====================
@@ -335,13 +486,18 @@ struct FWorldState {
     std::vector<FNPC> all_npcs;
     FDateTime current_time;
     
-    // Flags for world events
-    std::vector<std::string> active_events;
-    std::vector<std::string> completed_events;
-    std::map<std::string, int> event_counters;
+    // World event flags and counters
+    WorldEventRegistry world_events;
+    
+    // Scenario progress, in ScenarioManager definition order
+    std::vector<FScenarioProgress> scenarios;
     
     // Locations
-    std::map<std::string, FVector3> location_positions;
+    TFlatHashMap<FSymbol, FVector3> location_positions;
+    
+    // Random number generation (see RandomService)
+    uint64_t world_seed = 0x4E4155564F4F1841ull;
+    std::vector<uint64_t> rng_stream_states;
     
     // Save metadata
     int save_slot = 0;
@@ -0,0 +1,66 @@
+#include "EventBus.h"
+#include "Log.h"
+#include "Metrics.h"
+#include <atomic>
+
+namespace Nauvoo {
+
+namespace {
+
+struct FEventMetrics {
+    MetricCounter& dispatched = MetricsRegistry::Get().GetCounter("events.dispatched");
+    MetricCounter& ring_grows = MetricsRegistry::Get().GetCounter("events.ring_grows");
+};
+
+FEventMetrics& Metrics() {
+    static FEventMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
+EventBus::EventBus() {
+    Metrics();
+}
+
+EventBus::~EventBus() = default;
+
+size_t EventBus::NextTypeIndex() {
+    static std::atomic<size_t> next_index{ 0 };
+    return next_index.fetch_add(1, std::memory_order_relaxed);
+}
+
+void EventBus::OnRingGrown() {
+    Metrics().ring_grows.Add();
+}
+
+size_t EventBus::Dispatch() {
+    size_t delivered = 0;
+    for (int round = 0; round < MAX_DISPATCH_ROUNDS; ++round) {
+        size_t delivered_this_round = 0;
+        for (IChannel* channel : dispatch_order) {
+            delivered_this_round += channel->Deliver();
+        }
+        delivered += delivered_this_round;
+        if (delivered_this_round == 0) break;
+    }
+
+    for (IChannel* channel : dispatch_order) {
+        if (channel->GetCount() > 0) {
+            NAUVOO_LOG_WARNING(ELogCategory::GAME, "[EventBus] Handlers still publishing after ",
+                               MAX_DISPATCH_ROUNDS, " rounds; the rest waits for the next dispatch");
+            break;
+        }
+    }
+
+    Metrics().dispatched.Add(delivered);
+    return delivered;
+}
+
+void EventBus::Clear() {
+    for (IChannel* channel : dispatch_order) {
+        channel->Clear();
+    }
+}
+
+}  // namespace Nauvoo
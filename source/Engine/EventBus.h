@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Nauvoo {
+
+/**
+ * Typed publish/subscribe between managers. Each event type has its own ring
+ * of plain-data events; publishing copies the event into the ring (growing it
+ * only when full), and Dispatch hands every subscriber the queued events as
+ * contiguous batches. Events published by handlers go out in a later round
+ * of the same Dispatch.
+ *
+ * Publish and Dispatch are not synchronized: systems that publish during a
+ * tick declare ESystemData::EVENTS so the scheduler serializes them.
+ */
+class EventBus {
+public:
+    template <typename TEvent>
+    using FHandler = std::function<void(const TEvent* events, size_t count)>;
+
+    EventBus();
+    ~EventBus();
+
+    template <typename TEvent>
+    void Publish(const TEvent& event) {
+        GetChannel<TEvent>().Push(event);
+    }
+
+    template <typename TEvent>
+    void Subscribe(FHandler<TEvent> handler) {
+        GetChannel<TEvent>().handlers.push_back(std::move(handler));
+    }
+
+    // Delivers everything queued, channel by channel in the order channels were first used
+    size_t Dispatch();
+    // Drops queued events without delivering them
+    void Clear();
+
+    template <typename TEvent>
+    size_t GetPendingCount() {
+        return GetChannel<TEvent>().count;
+    }
+
+private:
+    static constexpr int MAX_DISPATCH_ROUNDS = 8;     // bounds handlers that keep publishing to each other
+
+    struct IChannel {
+        virtual ~IChannel() = default;
+        virtual size_t Deliver() = 0;
+        virtual size_t GetCount() const = 0;
+        virtual void Clear() = 0;
+    };
+
+    template <typename TEvent>
+    struct FChannel : IChannel {
+        static_assert(std::is_trivially_copyable<TEvent>::value, "Events must be plain data");
+
+        std::vector<TEvent> ring = std::vector<TEvent>(64);
+        std::vector<std::vector<TEvent>> retired;  // outgrown mid-dispatch; handlers may still be reading it
+        size_t head = 0;
+        size_t count = 0;
+        std::vector<FHandler<TEvent>> handlers;
+
+        void Push(const TEvent& event) {
+            if (count == ring.size()) Grow();
+            ring[(head + count) & (ring.size() - 1)] = event;
+            count++;
+        }
+
+        void Grow() {
+            std::vector<TEvent> grown(ring.size() * 2);
+            for (size_t i = 0; i < count; ++i) grown[i] = ring[(head + i) & (ring.size() - 1)];
+            retired.push_back(std::move(ring));
+            ring = std::move(grown);
+            head = 0;
+            OnRingGrown();
+        }
+
+        // Delivers the events queued now; the ring wraps, so that is at most two batches
+        size_t Deliver() override {
+            size_t batch = count;
+            if (batch == 0) return 0;
+
+            const TEvent* storage = ring.data();
+            size_t capacity = ring.size();
+            size_t first = std::min(batch, capacity - head);
+            for (const FHandler<TEvent>& handler : handlers) {
+                handler(storage + head, first);
+                if (first < batch) handler(storage, batch - first);
+            }
+
+            // Handlers may have published more (and grown the ring); only consume this batch
+            if (storage == ring.data()) head = (head + batch) & (ring.size() - 1);
+            else head = batch;      // growing re-laid the ring out from index 0
+            count -= batch;
+            retired.clear();
+            return batch;
+        }
+
+        size_t GetCount() const override { return count; }
+
+        void Clear() override {
+            head = 0;
+            count = 0;
+        }
+    };
+
+    std::vector<std::unique_ptr<IChannel>> channels;   // by event type index
+    std::vector<IChannel*> dispatch_order;
+
+    static size_t NextTypeIndex();
+    static void OnRingGrown();
+
+    template <typename TEvent>
+    static size_t GetTypeIndex() {
+        static const size_t index = NextTypeIndex();
+        return index;
+    }
+
+    template <typename TEvent>
+    FChannel<TEvent>& GetChannel() {
+        size_t index = GetTypeIndex<TEvent>();
+        if (index >= channels.size()) channels.resize(index + 1);
+        if (!channels[index]) {
+            channels[index] = std::make_unique<FChannel<TEvent>>();
+            dispatch_order.push_back(channels[index].get());
+        }
+        return static_cast<FChannel<TEvent>&>(*channels[index]);
+    }
+};
+
+}  // namespace Nauvoo
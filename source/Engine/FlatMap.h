@@ -0,0 +1,448 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #define NAUVOO_FLAT_MAP_SSE2 1
+#else
+  #define NAUVOO_FLAT_MAP_SSE2 0
+#endif
+
+#ifdef _MSC_VER
+  #include <intrin.h>
+#endif
+
+namespace Nauvoo {
+
+namespace FlatMapDetail {
+
+constexpr size_t GROUP_WIDTH = 16;
+constexpr int8_t CTRL_EMPTY = -128;
+constexpr int8_t CTRL_DELETED = -2;     // full slots hold the 7-bit hash tag, 0..127
+
+// Bit i is set when control byte i of the group equals value
+inline uint32_t MatchByte(const int8_t* group, int8_t value) {
+#if NAUVOO_FLAT_MAP_SSE2
+    __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(group));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(value))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        if (group[i] == value) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+// Empty and deleted slots are the ones with the sign bit set
+inline uint32_t MatchFree(const int8_t* group) {
+#if NAUVOO_FLAT_MAP_SSE2
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(group))));
+#else
+    uint32_t mask = 0;
+    for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+        if (group[i] < 0) mask |= 1u << i;
+    }
+    return mask;
+#endif
+}
+
+inline size_t LowestBit(uint32_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+}
+
+// Spreads weak hashes (std::hash of an integer is the identity) over all 64 bits
+inline uint64_t MixHash(size_t hash) {
+    uint64_t mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    return mixed ^ (mixed >> 32);
+}
+
+}  // namespace FlatMapDetail
+
+/**
+ * Open-addressing hash map with entries stored inline in one array. Slots are
+ * probed sixteen at a time: a parallel array of one-byte tags (seven hash
+ * bits per full slot) is compared against the key's tag in a single SSE2
+ * instruction, so a lookup usually touches one tag group and one entry.
+ *
+ * Unlike std::unordered_map, inserting may move every entry: do not keep
+ * references or iterators across an insert. Erasing moves nothing. Keys
+ * must not be modified through an iterator. Iteration order follows the
+ * hashes, which is the same every run for the same sequence of operations.
+ */
+template <typename TKey, typename TValue, typename THash = std::hash<TKey>, typename TKeyEqual = std::equal_to<TKey>>
+class TFlatHashMap {
+public:
+    using key_type = TKey;
+    using mapped_type = TValue;
+    using value_type = std::pair<TKey, TValue>;
+    using size_type = size_t;
+
+    template <bool IS_CONST>
+    class TIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = TFlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IS_CONST, const value_type*, value_type*>;
+        using reference = std::conditional_t<IS_CONST, const value_type&, value_type&>;
+
+        TIterator() = default;
+        // Mutable iterators convert to const ones
+        template <bool OTHER_CONST, typename = std::enable_if_t<IS_CONST && !OTHER_CONST>>
+        TIterator(const TIterator<OTHER_CONST>& other) : control(other.control), slots(other.slots), index(other.index), capacity(other.capacity) {}
+
+        reference operator*() const { return slots[index]; }
+        pointer operator->() const { return &slots[index]; }
+
+        TIterator& operator++() {
+            index++;
+            SkipFree();
+            return *this;
+        }
+        TIterator operator++(int) {
+            TIterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const TIterator& other) const { return index == other.index && slots == other.slots; }
+        bool operator!=(const TIterator& other) const { return !(*this == other); }
+
+    private:
+        friend class TFlatHashMap;
+        template <bool>
+        friend class TIterator;
+
+        const int8_t* control = nullptr;
+        pointer slots = nullptr;
+        size_t index = 0;
+        size_t capacity = 0;
+
+        TIterator(const int8_t* map_control, pointer map_slots, size_t start, size_t map_capacity)
+            : control(map_control), slots(map_slots), index(start), capacity(map_capacity) {}
+
+        void SkipFree() {
+            while (index < capacity && control[index] < 0) index++;
+        }
+    };
+
+    using iterator = TIterator<false>;
+    using const_iterator = TIterator<true>;
+
+    TFlatHashMap() = default;
+
+    TFlatHashMap(const TFlatHashMap& other) : hasher(other.hasher), key_equal(other.key_equal) {
+        reserve(other.entry_count);
+        for (const value_type& entry : other) InsertNew(HashOf(entry.first), entry);
+    }
+
+    TFlatHashMap(TFlatHashMap&& other) noexcept { swap(other); }
+
+    TFlatHashMap& operator=(TFlatHashMap other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~TFlatHashMap() { Release(); }
+
+    void swap(TFlatHashMap& other) noexcept {
+        std::swap(control, other.control);
+        std::swap(slots, other.slots);
+        std::swap(capacity, other.capacity);
+        std::swap(entry_count, other.entry_count);
+        std::swap(growth_left, other.growth_left);
+        std::swap(hasher, other.hasher);
+        std::swap(key_equal, other.key_equal);
+    }
+
+    size_t size() const { return entry_count; }
+    bool empty() const { return entry_count == 0; }
+    size_t bucket_count() const { return capacity; }
+
+    iterator begin() { return MakeBegin<iterator>(slots); }
+    iterator end() { return iterator(control, slots, capacity, capacity); }
+    const_iterator begin() const { return MakeBegin<const_iterator>(static_cast<const value_type*>(slots)); }
+    const_iterator end() const { return const_iterator(control, slots, capacity, capacity); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+    iterator find(const TKey& key) {
+        size_t index = FindIndex(key, HashOf(key));
+        return index == NOT_FOUND ? end() : iterator(control, slots, index, capacity);
+    }
+
+    const_iterator find(const TKey& key) const {
+        size_t index = FindIndex(key, HashOf(key));
+        return index == NOT_FOUND ? end() : const_iterator(control, slots, index, capacity);
+    }
+
+    size_t count(const TKey& key) const { return FindIndex(key, HashOf(key)) != NOT_FOUND ? 1 : 0; }
+    bool contains(const TKey& key) const { return count(key) != 0; }
+
+    TValue& operator[](const TKey& key) { return try_emplace(key).first->second; }
+
+    template <typename... TArgs>
+    std::pair<iterator, bool> try_emplace(const TKey& key, TArgs&&... args) {
+        uint64_t hash = HashOf(key);
+        size_t index = FindIndex(key, hash);
+        if (index != NOT_FOUND) return { iterator(control, slots, index, capacity), false };
+
+        index = InsertNew(hash, std::piecewise_construct, std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<TArgs>(args)...));
+        return { iterator(control, slots, index, capacity), true };
+    }
+
+    std::pair<iterator, bool> insert(const value_type& entry) { return try_emplace(entry.first, entry.second); }
+    std::pair<iterator, bool> insert(value_type&& entry) { return try_emplace(entry.first, std::move(entry.second)); }
+
+    template <typename TKeyArg, typename... TArgs>
+    std::pair<iterator, bool> emplace(TKeyArg&& key, TArgs&&... args) {
+        return try_emplace(TKey(std::forward<TKeyArg>(key)), std::forward<TArgs>(args)...);
+    }
+
+    size_t erase(const TKey& key) {
+        size_t index = FindIndex(key, HashOf(key));
+        if (index == NOT_FOUND) return 0;
+        EraseAt(index);
+        return 1;
+    }
+
+    // Returns the entry after the erased one; nothing else moves
+    iterator erase(const_iterator position) {
+        EraseAt(position.index);
+        iterator next(control, slots, position.index + 1, capacity);
+        next.SkipFree();
+        return next;
+    }
+    iterator erase(iterator position) { return erase(const_iterator(position)); }
+
+    // Keeps the allocation
+    void clear() {
+        if (capacity == 0) return;
+        for (size_t i = 0; i < capacity; ++i) {
+            if (control[i] >= 0) slots[i].~value_type();
+        }
+        std::memset(control, static_cast<uint8_t>(FlatMapDetail::CTRL_EMPTY), capacity);
+        entry_count = 0;
+        growth_left = MaxLoad(capacity);
+    }
+
+    void reserve(size_t entries) {
+        if (entries == 0) return;
+        size_t wanted = FlatMapDetail::GROUP_WIDTH;
+        while (MaxLoad(wanted) < entries) wanted *= 2;
+        if (wanted > capacity) Rehash(wanted);
+    }
+
+private:
+    static constexpr size_t NOT_FOUND = ~size_t(0);
+
+    int8_t* control = nullptr;
+    value_type* slots = nullptr;
+    size_t capacity = 0;        // zero or a power of two, at least one group
+    size_t entry_count = 0;
+    size_t growth_left = 0;     // inserts into empty slots before the next rehash; deleted slots count as used
+    THash hasher;
+    TKeyEqual key_equal;
+
+    static size_t MaxLoad(size_t slot_count) { return slot_count - slot_count / 8; }
+
+    uint64_t HashOf(const TKey& key) const { return FlatMapDetail::MixHash(hasher(key)); }
+    static int8_t TagOf(uint64_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+    template <typename TIt, typename TSlots>
+    TIt MakeBegin(TSlots map_slots) const {
+        TIt it(control, map_slots, 0, capacity);
+        it.SkipFree();
+        return it;
+    }
+
+    // Groups are probed at offsets 0, 1, 3, 6, ... which visits every group of a power-of-two table
+    size_t FindIndex(const TKey& key, uint64_t hash) const {
+        if (capacity == 0) return NOT_FOUND;
+        size_t group_mask = capacity / FlatMapDetail::GROUP_WIDTH - 1;
+        size_t group = static_cast<size_t>(hash >> 7) & group_mask;
+        int8_t tag = TagOf(hash);
+        for (size_t step = 1;; ++step) {
+            const int8_t* group_control = control + group * FlatMapDetail::GROUP_WIDTH;
+            for (uint32_t match = FlatMapDetail::MatchByte(group_control, tag); match; match &= match - 1) {
+                size_t index = group * FlatMapDetail::GROUP_WIDTH + FlatMapDetail::LowestBit(match);
+                if (key_equal(slots[index].first, key)) return index;
+            }
+            // An empty slot means the key would have been placed here
+            if (FlatMapDetail::MatchByte(group_control, FlatMapDetail::CTRL_EMPTY)) return NOT_FOUND;
+            group = (group + step) & group_mask;
+        }
+    }
+
+    size_t FindFreeIndex(uint64_t hash) const {
+        size_t group_mask = capacity / FlatMapDetail::GROUP_WIDTH - 1;
+        size_t group = static_cast<size_t>(hash >> 7) & group_mask;
+        for (size_t step = 1;; ++step) {
+            uint32_t free = FlatMapDetail::MatchFree(control + group * FlatMapDetail::GROUP_WIDTH);
+            if (free) return group * FlatMapDetail::GROUP_WIDTH + FlatMapDetail::LowestBit(free);
+            group = (group + step) & group_mask;
+        }
+    }
+
+    // The key must not be present
+    template <typename... TArgs>
+    size_t InsertNew(uint64_t hash, TArgs&&... args) {
+        if (growth_left == 0) {
+            // Mostly tombstones: rebuild at the same size; otherwise double
+            size_t live_after = entry_count + 1;
+            Rehash(capacity == 0 ? FlatMapDetail::GROUP_WIDTH : (live_after > MaxLoad(capacity) / 2 ? capacity * 2 : capacity));
+        }
+
+        size_t index = FindFreeIndex(hash);
+        new (&slots[index]) value_type(std::forward<TArgs>(args)...);
+        if (control[index] == FlatMapDetail::CTRL_EMPTY) growth_left--;
+        control[index] = TagOf(hash);
+        entry_count++;
+        return index;
+    }
+
+    void EraseAt(size_t index) {
+        slots[index].~value_type();
+        entry_count--;
+        // A group that still has an empty slot never sent a probe past it, so the slot can be empty again
+        const int8_t* group_control = control + index / FlatMapDetail::GROUP_WIDTH * FlatMapDetail::GROUP_WIDTH;
+        if (FlatMapDetail::MatchByte(group_control, FlatMapDetail::CTRL_EMPTY)) {
+            control[index] = FlatMapDetail::CTRL_EMPTY;
+            growth_left++;
+        } else {
+            control[index] = FlatMapDetail::CTRL_DELETED;
+        }
+    }
+
+    void Rehash(size_t new_capacity) {
+        int8_t* old_control = control;
+        value_type* old_slots = slots;
+        size_t old_capacity = capacity;
+
+        control = static_cast<int8_t*>(::operator new(new_capacity, std::align_val_t(FlatMapDetail::GROUP_WIDTH)));
+        std::memset(control, static_cast<uint8_t>(FlatMapDetail::CTRL_EMPTY), new_capacity);
+        slots = static_cast<value_type*>(::operator new(new_capacity * sizeof(value_type), std::align_val_t(alignof(value_type))));
+        capacity = new_capacity;
+        growth_left = MaxLoad(new_capacity) - entry_count;
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (old_control[i] < 0) continue;
+            uint64_t hash = HashOf(old_slots[i].first);
+            size_t index = FindFreeIndex(hash);
+            new (&slots[index]) value_type(std::move(old_slots[i]));
+            control[index] = TagOf(hash);
+            old_slots[i].~value_type();
+        }
+        FreeArrays(old_control, old_slots);
+    }
+
+    void Release() {
+        if (capacity == 0) return;
+        for (size_t i = 0; i < capacity; ++i) {
+            if (control[i] >= 0) slots[i].~value_type();
+        }
+        FreeArrays(control, slots);
+        control = nullptr;
+        slots = nullptr;
+        capacity = entry_count = growth_left = 0;
+    }
+
+    static void FreeArrays(int8_t* old_control, value_type* old_slots) {
+        if (!old_control) return;
+        ::operator delete(old_control, std::align_val_t(FlatMapDetail::GROUP_WIDTH));
+        ::operator delete(old_slots, std::align_val_t(alignof(value_type)));
+    }
+};
+
+/**
+ * Ordered map over a sorted vector: binary-search lookups, contiguous ordered
+ * iteration, linear inserts. For small maps that are built once and read
+ * often. Inserting and erasing move later entries.
+ */
+template <typename TKey, typename TValue, typename TCompare = std::less<TKey>>
+class TFlatSortedMap {
+public:
+    using key_type = TKey;
+    using mapped_type = TValue;
+    using value_type = std::pair<TKey, TValue>;
+    using iterator = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+    void clear() { entries.clear(); }
+    void reserve(size_t count) { entries.reserve(count); }
+
+    iterator begin() { return entries.begin(); }
+    iterator end() { return entries.end(); }
+    const_iterator begin() const { return entries.begin(); }
+    const_iterator end() const { return entries.end(); }
+
+    iterator lower_bound(const TKey& key) {
+        return std::lower_bound(entries.begin(), entries.end(), key, KeyLess());
+    }
+    const_iterator lower_bound(const TKey& key) const {
+        return std::lower_bound(entries.begin(), entries.end(), key, KeyLess());
+    }
+
+    iterator find(const TKey& key) {
+        iterator it = lower_bound(key);
+        return it != entries.end() && !TCompare()(key, it->first) ? it : entries.end();
+    }
+    const_iterator find(const TKey& key) const {
+        const_iterator it = lower_bound(key);
+        return it != entries.end() && !TCompare()(key, it->first) ? it : entries.end();
+    }
+
+    size_t count(const TKey& key) const { return find(key) != end() ? 1 : 0; }
+    bool contains(const TKey& key) const { return find(key) != end(); }
+
+    TValue& operator[](const TKey& key) { return try_emplace(key).first->second; }
+
+    template <typename... TArgs>
+    std::pair<iterator, bool> try_emplace(const TKey& key, TArgs&&... args) {
+        iterator it = lower_bound(key);
+        if (it != entries.end() && !TCompare()(key, it->first)) return { it, false };
+        it = entries.emplace(it, std::piecewise_construct, std::forward_as_tuple(key),
+                             std::forward_as_tuple(std::forward<TArgs>(args)...));
+        return { it, true };
+    }
+
+    std::pair<iterator, bool> insert(const value_type& entry) { return try_emplace(entry.first, entry.second); }
+
+    size_t erase(const TKey& key) {
+        iterator it = find(key);
+        if (it == entries.end()) return 0;
+        entries.erase(it);
+        return 1;
+    }
+    iterator erase(const_iterator position) { return entries.erase(position); }
+
+private:
+    struct KeyLess {
+        bool operator()(const value_type& entry, const TKey& key) const { return TCompare()(entry.first, key); }
+    };
+
+    std::vector<value_type> entries;
+};
+
+}  // namespace Nauvoo
@@ -1,7 +1,14 @@
 #include "Game.h"
 #include "../Systems/DialogueManager.h"
+#include "Log.h"
+#include "Profiler.h"
+#include "ReplaySystem.h"
+#include "SyntheticContent.h"
 #include <iostream>
 #include <fstream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
 
 namespace Nauvoo {
 
@@ -25,13 +32,13 @@ void NauvooGame::Initialize() {
 }
 
 void NauvooGame::LoadContent() {
-    std::cout << "[Game] Loading content..." << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[Game] Loading content...");
     // Would load textures, models, audio, etc.
-    std::cout << "[Game] Content loaded" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[Game] Content loaded");
 }
 
 void NauvooGame::Run() {
-    std::cout << "[Game] Starting main game loop..." << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[Game] Starting main game loop...");
     
     const float DELTA_TIME = 0.016f;  // ~60 FPS
     int frame_count = 0;
@@ -43,11 +50,113 @@ void NauvooGame::Run() {
         frame_count++;
     }
     
-    std::cout << "[Game] Main loop exited" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[Game] Main loop exited");
+}
+
+FHeadlessReport NauvooGame::RunHeadless(const FHeadlessOptions& options) {
+    using Clock = std::chrono::steady_clock;
+    FHeadlessReport report;
+
+    // System chatter is discarded unless verbose; the report is printed by the caller
+    ScopedQuietConsole quiet(!options.verbose);
+
+    Initialize();
+    if (options.world_seed != 0) {
+        game_manager->SetWorldSeed(options.world_seed);
+    }
+    SpawnSyntheticPopulation(options.extra_npcs);
+
+    game_manager->SetTimeScale(options.game_minutes_per_tick / options.delta_time);
+    game_manager->ResetSystemTimings();
+    game_manager->EnableSystemTimings(true);
+
+    if (!options.metrics_file.empty()) {
+        game_manager->EnableMetricsDump(options.metrics_file, 60);
+    }
+    if (!options.trace_file.empty()) {
+        Profiler::Get().BeginTraceCapture();
+    }
+
+    const long long start_minutes = game_manager->GetCurrentTime().GetCalendarMinutes();
+    auto start = Clock::now();
+
+    if (!options.replay_file.empty()) {
+        ReplayPlayer player;
+        if (player.LoadFromFile(options.replay_file)) {
+            FReplayResult result = player.Run(*game_manager);
+            report.ticks = result.ticks;
+            report.replay_diverged = result.diverged;
+        } else {
+            report.replay_diverged = true;
+        }
+    } else {
+        if (!options.record_file.empty()) {
+            game_manager->BeginRecording();
+        }
+
+        const uint64_t ticks_needed = static_cast<uint64_t>(
+            std::ceil(options.days * 1440.0 / options.game_minutes_per_tick));
+        while (is_running && report.ticks < ticks_needed) {
+            game_manager->Update(options.delta_time);
+            NAUVOO_PROFILE_FRAME();
+            report.ticks++;
+        }
+
+        if (!options.record_file.empty()) {
+            game_manager->FinishRecording(options.record_file);
+        }
+    }
+
+    report.wall_seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    report.simulated_days = (game_manager->GetCurrentTime().GetCalendarMinutes() - start_minutes) / 1440.0;
+    report.npc_count = game_manager->GetAllNPCs().size();
+    report.timings = game_manager->GetSystemTimings();
+    if (report.wall_seconds > 0.0) {
+        report.days_per_second = report.simulated_days / report.wall_seconds;
+        report.ticks_per_second = report.ticks / report.wall_seconds;
+    }
+
+    game_manager->EnableSystemTimings(false);
+    game_manager->DisableMetricsDump();
+
+    if (!options.trace_file.empty()) {
+        Profiler::Get().EndTraceCapture();
+        Profiler::Get().WriteChromeTrace(options.trace_file);
+    }
+
+    return report;
+}
+
+void FHeadlessReport::Print() const {
+    auto per_tick_us = [this](double seconds) { return ticks ? seconds * 1e6 / ticks : 0.0; };
+    auto row = [&](const char* name, double seconds) {
+        std::cout << "  " << std::left << std::setw(16) << name << std::right
+                  << std::setw(10) << std::fixed << std::setprecision(2) << seconds * 1000.0 << " ms"
+                  << std::setw(12) << std::setprecision(3) << per_tick_us(seconds) << " us/tick" << std::endl;
+    };
+
+    std::cout << "\n=== HEADLESS SIMULATION ===" << std::endl;
+    std::cout << "NPCs:            " << npc_count << std::endl;
+    std::cout << "Simulated days:  " << std::fixed << std::setprecision(2) << simulated_days << std::endl;
+    std::cout << "Ticks:           " << ticks << std::endl;
+    std::cout << "Wall time:       " << std::setprecision(3) << wall_seconds << " s" << std::endl;
+    std::cout << "Days/sec:        " << std::setprecision(2) << days_per_second << std::endl;
+    std::cout << "Ticks/sec:       " << std::setprecision(0) << ticks_per_second << std::endl;
+    if (replay_diverged) {
+        std::cout << "Replay:          DIVERGED" << std::endl;
+    }
+    std::cout << "Per-system time:" << std::endl;
+    row("time advance", timings.time_advance_seconds);
+    row("schedules", timings.schedule_seconds);
+    row("crowd morale", timings.crowd_morale_seconds);
+    row("enemy AI", timings.enemy_ai_seconds);
+    row("player health", timings.player_health_seconds);
+    row("NPC health", timings.npc_health_seconds);
 }
 
 bool NauvooGame::Update(float delta_time) {
     game_manager->Update(delta_time);
+    NAUVOO_PROFILE_FRAME();
     
     // Every 100 frames (roughly 1.6 seconds), print time
     static int frame_counter = 0;
@@ -55,9 +164,8 @@ bool NauvooGame::Update(float delta_time) {
     
     if (frame_counter % 100 == 0) {
         FDateTime time = game_manager->GetCurrentTime();
-        std::cout << "Game Time: " << time.year << "-" << time.month << "-" << time.day 
-                  << " " << (time.minute / 60) << ":" << (time.minute % 60 < 10 ? "0" : "") 
-                  << (time.minute % 60) << std::endl;
+        NAUVOO_LOG_INFO(ELogCategory::GAME, "Game Time: ", time.year, "-", time.month, "-", time.day,
+                        " ", time.minute / 60, ":", time.minute % 60 < 10 ? "0" : "", time.minute % 60);
     }
     
     return is_running;
@@ -69,7 +177,7 @@ void NauvooGame::Render() {
 }
 
 void NauvooGame::CreateInitialNPCs() {
-    std::cout << "[Game] Creating initial NPCs..." << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[Game] Creating initial NPCs...");
     
     // Load NPCs from JSON or create programmatically
     // For MVP, create a few key NPCs
@@ -136,11 +244,11 @@ void NauvooGame::CreateInitialNPCs() {
     commander.position = {5, 0, 0};
     game_manager->SpawnNPC(commander);
     
-    std::cout << "  Created 5 initial NPCs" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "  Created 5 initial NPCs");
 }
 
 void NauvooGame::CreateDialogueTrees() {
-    std::cout << "[Game] Creating dialogue trees..." << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[Game] Creating dialogue trees...");
     
     // Would load from dialogue_trees.json
     // For MVP, create basic dialogue trees
@@ -183,17 +291,24 @@ void NauvooGame::CreateDialogueTrees() {
     
     dialogue_mgr->AddDialogueTree(marks_tree);
     
-    std::cout << "  Created basic dialogue trees" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "  Created basic dialogue trees");
+}
+
+void NauvooGame::SpawnSyntheticPopulation(int count) {
+    FSyntheticContentOptions options;
+    options.npc_count = count;
+    options.quiet = false;  // RunHeadless decides what reaches the console
+    SyntheticContentGenerator::Populate(*game_manager, options);
 }
 
 void NauvooGame::CreateStartingLocation() {
-    std::cout << "[Game] Setting starting location..." << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[Game] Setting starting location...");
     
     // Set player starting position
     FPlayerState& player = game_manager->GetPlayerState();
     player.position = {0, 0, 0};  // Town square
     
-    std::cout << "  Player starting position set" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "  Player starting position set");
 }
 
 }  // namespace Nauvoo
@@ -2,9 +2,39 @@
 
 #include "../Engine/GameManager.h"
 #include <memory>
+#include <string>
 
 namespace Nauvoo {
 
+/**
+ * Command-line driven settings for headless simulation runs
+ */
+struct FHeadlessOptions {
+    int days = 1;                       // game days to simulate
+    int extra_npcs = 0;                 // synthetic NPCs added on top of the initial cast
+    float delta_time = 0.016f;          // simulated seconds per tick
+    float game_minutes_per_tick = 1.0f;
+    uint64_t world_seed = 0;            // 0 keeps the default seed
+    bool verbose = false;               // keep per-system console output
+    std::string record_file;            // record inputs to this replay file
+    std::string replay_file;            // replay this file instead of free-running
+    std::string metrics_file;           // append a metrics snapshot every game hour
+    std::string trace_file;             // write a Chrome trace of profiler zones (profiling builds)
+};
+
+struct FHeadlessReport {
+    double simulated_days = 0.0;
+    uint64_t ticks = 0;
+    double wall_seconds = 0.0;
+    double days_per_second = 0.0;
+    double ticks_per_second = 0.0;
+    size_t npc_count = 0;
+    bool replay_diverged = false;
+    FSystemTimings timings;
+
+    void Print() const;
+};
+
 /**
  * Main game application class
  * Handles initialization, main loop, and shutdown
@@ -20,6 +50,7 @@ public:
 
     // Main loop
     void Run();
+    FHeadlessReport RunHeadless(const FHeadlessOptions& options);
     bool Update(float delta_time);
     void Render();
 
@@ -38,6 +69,7 @@ private:
     void CreateInitialNPCs();
     void CreateDialogueTrees();
     void CreateStartingLocation();
+    void SpawnSyntheticPopulation(int count);
 };
 
 }  // namespace Nauvoo
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "Symbol.h"
+#include <cstdint>
+
+namespace Nauvoo {
+
+// ==================== EVENT KEYS ====================
+
+// Events are plain data, so ids travel as symbols
+constexpr FSymbol PLAYER_SYMBOL = PreinternedSymbol("player");
+
+// ==================== GAMEPLAY EVENTS ====================
+
+enum class EDeathCause : uint8_t {
+    WOUNDS,         // killed outright by damage
+    BLED_OUT
+};
+
+struct FCharacterDiedEvent {
+    FSymbol npc_id;
+    EDeathCause cause = EDeathCause::WOUNDS;
+    FVector3 position;              // where they fell
+};
+
+struct FCharacterInjuredEvent {
+    FSymbol character_id;           // PLAYER_SYMBOL for the player
+    EInjuryType type = EInjuryType::GUNSHOT;
+    EBodyPart location = EBodyPart::TORSO;
+    int severity = 1;
+};
+
+// One per shot that left a barrel
+struct FGunfireEvent {
+    FSymbol shooter_id;
+    FVector3 position;
+};
+
+struct FCombatStateEvent {
+    FSymbol enemy_id;               // invalid when combat ends
+    bool in_combat = false;
+};
+
+struct FPlayerActionEvent {
+    FSymbol action_id;
+};
+
+struct FDialogueStartedEvent {
+    FSymbol npc_id;
+    FSymbol tree_id;
+};
+
+// Published by the world event registry for every flag or counter change
+struct FWorldEventChangedEvent {
+    FWorldEventId event_id = INVALID_WORLD_EVENT;
+    EWorldEventChange change = EWorldEventChange::TRIGGERED;
+};
+
+}  // namespace Nauvoo
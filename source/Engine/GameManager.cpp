@@ -3,31 +3,115 @@
 #include "../Systems/ReputationManager.h"
 #include "../Systems/DialogueManager.h"
 #include "../Systems/CombatSystem.h"
+#include "../Systems/CrowdMorale.h"
 #include "../Systems/SaveGameManager.h"
+#include "../Systems/ScenarioManager.h"
+#include "../Systems/WeaponRegistry.h"
+#include "EventBus.h"
+#include "GameEvents.h"
+#include "JobSystem.h"
+#include "Log.h"
+#include "Metrics.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "ReplaySystem.h"
+#include "SimulationLOD.h"
+#include "SystemScheduler.h"
+#include "TimerWheel.h"
 #include <iostream>
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
 
 namespace Nauvoo {
 
+namespace {
+
+// Adds the lifetime of the scope to a timing total when enabled
+class ScopedSystemTimer {
+public:
+    ScopedSystemTimer(bool enabled, double& total_seconds)
+        : total(enabled ? &total_seconds : nullptr) {
+        if (total) start = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedSystemTimer() {
+        if (total) *total += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    double* total;
+    std::chrono::steady_clock::time_point start;
+};
+
+struct FGameMetrics {
+    MetricCounter& ticks = MetricsRegistry::Get().GetCounter("game.ticks");
+    MetricGauge& npcs_alive = MetricsRegistry::Get().GetGauge("game.npcs_alive");
+    MetricHistogram& allocations_per_tick = MetricsRegistry::Get().GetHistogram("game.allocations_per_tick");
+};
+
+FGameMetrics& Metrics() {
+    static FGameMetrics metrics;
+    return metrics;
+}
+
+std::string FormatGameTime(const FDateTime& time) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d", time.year, time.month, time.day,
+                  time.minute / 60, time.minute % 60);
+    return buffer;
+}
+
+}  // namespace
+
 GameManager::GameManager() {
+    random_service = std::make_unique<RandomService>();
     schedule_manager = std::make_unique<NPCScheduleManager>();
     reputation_manager = std::make_unique<ReputationManager>();
     dialogue_manager = std::make_unique<DialogueManager>(reputation_manager.get());
-    combat_system = std::make_unique<CombatSystem>(reputation_manager.get());
+    weapon_registry = std::make_unique<WeaponRegistry>();
+    combat_system = std::make_unique<CombatSystem>(reputation_manager.get(), random_service.get());
+    combat_system->SetWeaponRegistry(weapon_registry.get());
+    crowd_morale = std::make_unique<CrowdMorale>();
     save_manager = std::make_unique<SaveGameManager>();
+
+    job_system = &JobSystem::Get();
+    combat_system->SetJobSystem(job_system);
+    system_scheduler = std::make_unique<SystemScheduler>();
+    frame_arena = std::make_unique<FrameArena>();
+    system_scheduler->SetFrameMemory(frame_arena.get());
+    simulation_lod = std::make_unique<SimulationLOD>();
+    game_timers = std::make_unique<TimerWheel>();
+    combat_system->SetGameTimers(game_timers.get());
+    event_bus = std::make_unique<EventBus>();
+    combat_system->SetEventBus(event_bus.get());
+    dialogue_manager->SetEventBus(event_bus.get());
+    scenario_manager = std::make_unique<ScenarioManager>(world_state, reputation_manager.get(), game_timers.get());
+    world_state.world_events.AddListener([this](FWorldEventId id, EWorldEventChange change) {
+        event_bus->Publish(FWorldEventChangedEvent{ id, change });
+    });
+    RegisterCoreSystems();
+    RegisterEventSubscribers();
 }
 
-GameManager::~GameManager() = default;
+GameManager::~GameManager() {
+    DisableMetricsDump();
+}
 
 void GameManager::Initialize() {
-    std::cout << "[GameManager] Initializing Nauvoo: Legion" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Initializing Nauvoo: Legion");
     
     // Initialize systems
+    random_service->SetWorldSeed(world_state.world_seed);
     reputation_manager->Initialize();
     
     // Load schedules, dialogue, etc.
     schedule_manager->LoadSchedules("source/Data/npc_schedules.json");
     dialogue_manager->LoadDialogueTrees("source/Data/Dialogue/dialogue_trees.json");
+    scenario_manager->LoadScenarios("source/Data/phase_1_scenarios.json");
+    // Weapons carried from before refer to the archetypes being replaced
+    combat_system->ClearWeapons();
+    weapon_registry->LoadWeapons("source/Data/weapons.json");
     
     // Initialize world state
     world_state.current_time = { 1841, 5, 15, 360 };  // 9/15/1841 at 6:00 AM
@@ -36,47 +120,84 @@ void GameManager::Initialize() {
     world_state.player.stamina = 100.0f;
     world_state.player.max_stamina = 100.0f;
     world_state.player.legion_rank = ELegionRank::RECRUIT;
+    system_scheduler->SetGameMinutes(world_state.current_time.GetTotalGameMinutes());
+    ResetGameTimers();
+    scenario_manager->ResetProgress();
     
-    std::cout << "[GameManager] Initialization complete" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Initialization complete");
 }
 
 void GameManager::StartNewGame() {
-    std::cout << "[GameManager] Starting new game" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Starting new game");
     Initialize();
     
     // Spawn initial NPCs and set to starting positions
     // Load from NPC definition file
     world_state.current_time = { 1841, 5, 15, 360 };  // Game starts May 15, 1841 at 6 AM
+    TriggerEvent("game_start");
+}
+
+void GameManager::LoadGame(const std::string& save_slot) {
+    if (save_manager->LoadGame(save_slot, world_state)) {
+        random_service->RestoreState(world_state.world_seed, world_state.rng_stream_states);
+        system_scheduler->SetGameMinutes(world_state.current_time.GetTotalGameMinutes());
+        ResetGameTimers();
+        scenario_manager->RestoreProgress();
+        combat_system->RebuildBleeding(world_state.all_npcs, world_state.player);
+        combat_system->ClearWeapons();
+        // Encounters hold indices into the NPC list just replaced
+        combat_system->GetEncounters().Clear();
+        crowd_morale->Clear();
+        event_bus->Clear();
+        unsaved_changes = 0;
+        NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Game loaded from slot: ", save_slot);
+    }
 }
 
 void GameManager::Update(float delta_time) {
     if (is_paused) return;
+    NAUVOO_PROFILE_ZONE("GameManager::Update");
+    FAllocationStats allocations_before = GetAllocationStats();
+    frame_arena->Reset();
 
-    // Advance game time
-    float game_minutes = delta_time * time_scale;
-    int minutes_to_advance = static_cast<int>(game_minutes);
-    
-    if (minutes_to_advance > 0) {
-        AdvanceGameTime(minutes_to_advance);
+    if (IsRecording() && delta_time != recorded_delta_time) {
+        FReplayEvent event;
+        event.type = EReplayEvent::DELTA_TIME;
+        event.delta_time = delta_time;
+        RecordInput(event);
+        recorded_delta_time = delta_time;
     }
 
-    // Update all NPCs
-    UpdateAllNPCs(delta_time);
+    system_scheduler->Tick(delta_time, *job_system);
 
-    // Update player health (bleeding, injuries)
-    if (combat_system->IsInCombat()) {
-        combat_system->UpdateHealth(world_state.player, delta_time);
-    }
+    tick_count++;
+    system_timings.ticks++;
+    Metrics().ticks.Add();
 
-    // Update NPC health
-    for (auto& npc : world_state.all_npcs) {
-        if (!npc.is_alive) continue;
-        combat_system->UpdateNPCHealth(npc, delta_time);
+    if (IsRecording() && checkpoint_interval > 0
+        && (tick_count - recording_base_tick) % checkpoint_interval == 0) {
+        FReplayEvent event;
+        event.type = EReplayEvent::CHECKPOINT;
+        event.state_hash = ComputeStateHash();
+        RecordInput(event);
     }
+
+    last_tick_allocations = GetAllocationStats().allocations - allocations_before.allocations;
+    Metrics().allocations_per_tick.Record(last_tick_allocations);
 }
 
 void GameManager::AdvanceGameTime(int minutes) {
+    FReplayEvent event;
+    event.type = EReplayEvent::ADVANCE_TIME;
+    event.value = minutes;
+    RecordInput(event);
+
+    AdvanceClock(minutes);
+}
+
+void GameManager::AdvanceClock(int minutes) {
     world_state.current_time.minute += minutes;
+    system_scheduler->AdvanceGameMinutes(minutes);
     
     // Roll over to next day
     while (world_state.current_time.minute >= 1440) {
@@ -93,15 +214,38 @@ void GameManager::AdvanceGameTime(int minutes) {
                 world_state.current_time.year++;
             }
         }
-        
-        // Daily maintenance
-        reputation_manager->ApplyDailyDecay();
     }
+
+    // Fire everything due along the way, after the date has caught up
+    game_timers->Advance(static_cast<uint64_t>(system_scheduler->GetGameMinutes()));
+
+    if (metrics_dump_interval > 0) {
+        minutes_since_metrics_dump += minutes;
+        if (minutes_since_metrics_dump >= metrics_dump_interval) {
+            minutes_since_metrics_dump %= metrics_dump_interval;
+            WriteMetricsSnapshot();
+        }
+    }
+}
+
+void GameManager::ResetGameTimers() {
+    // The wheel counts the scheduler's game minutes, which restart from the calendar date
+    game_timers->Reset(static_cast<uint64_t>(system_scheduler->GetGameMinutes()));
+    ScheduleDailyMaintenance(game_timers->GetCurrentTick() + (1440 - world_state.current_time.minute));
+}
+
+void GameManager::ScheduleDailyMaintenance(uint64_t due_minute) {
+    // Midnight; re-arms itself so a multi-day skip decays once per day
+    game_timers->Schedule(due_minute, [this]() {
+        reputation_manager->ApplyDailyDecay();
+        ScheduleDailyMaintenance(game_timers->GetCurrentTick() + 1440);
+    });
 }
 
 FNPC* GameManager::GetNPCById(const std::string& npc_id) {
     for (auto& npc : world_state.all_npcs) {
         if (npc.id == npc_id) {
+            ResolveNPC(npc);
             return &npc;
         }
     }
@@ -109,91 +253,438 @@ FNPC* GameManager::GetNPCById(const std::string& npc_id) {
 }
 
 void GameManager::UpdateAllNPCs(float delta_time) {
+    FSystemTickContext context;
+    context.delta_time = delta_time;
+    SelectSimulatedNPCsSystem(context);
+    UpdateSchedulesSystem(context);
+    UpdateCrowdMoraleSystem(context);
+    UpdateEnemyAISystem(context);
+}
+
+void GameManager::ResolveNPC(FNPC& npc) {
+    combat_system->SettleNPCHealth(npc);
+    if (!npc.is_alive || npc.unsimulated_seconds <= 0.0f) return;
+
+    // Jump to the current activity
+    npc.unsimulated_seconds = 0.0f;
+    if (FScheduleActivity* activity = schedule_manager->GetCurrentActivity(npc, world_state.current_time)) {
+        npc.current_activity = activity;
+    }
+}
+
+void GameManager::ResolveAllNPCs() {
     for (auto& npc : world_state.all_npcs) {
-        if (!npc.is_alive) continue;
+        ResolveNPC(npc);
+    }
+}
+
+void GameManager::SetJobSystem(JobSystem* jobs) {
+    job_system = jobs ? jobs : &JobSystem::Get();
+    combat_system->SetJobSystem(job_system);
+}
+
+// ==================== Core Systems ====================
+
+void GameManager::RegisterCoreSystems() {
+    using D = ESystemData;
+
+    // Game timers fire inside the clock advance: daily reputation decay, wound infection, scenario start times
+    system_scheduler->RegisterSystem({ "Time", ETickPhase::TIME,
+        D::NONE, D::CLOCK | D::REPUTATION | D::PLAYER, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext& context) { AdvanceTimeSystem(context); } });
+
+    // Picks the NPCs the systems below tick this frame
+    system_scheduler->RegisterSystem({ "SimulationLOD", ETickPhase::SIMULATION,
+        D::PLAYER | D::NPC_HEALTH | D::NPC_BEHAVIOR, D::NPC_LOD, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext& context) { SelectSimulatedNPCsSystem(context); } });
 
-        // Update schedule based on current time
-        schedule_manager->UpdateNPCSchedules(world_state.current_time, world_state.all_npcs);
+    system_scheduler->RegisterSystem({ "Schedules", ETickPhase::SIMULATION,
+        D::CLOCK | D::NPC_LOD | D::NPC_HEALTH, D::NPC_ROUTINE, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext& context) { UpdateSchedulesSystem(context); } });
 
-        // Update NPC relationships (gossip, memory decay)
-        // Update NPC AI behavior
-        if (npc.is_in_combat) {
-            combat_system->UpdateEnemyBehavior(npc, world_state.player, delta_time);
+    // Before the AI, so those who panic this frame have already left the fight
+    system_scheduler->RegisterSystem({ "CrowdMorale", ETickPhase::SIMULATION,
+        D::NPC_LOD | D::NPC_HEALTH, D::NPC_BEHAVIOR, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext& context) { UpdateCrowdMoraleSystem(context); } });
+
+    // Replans a share of the combatants each frame; starts reloads
+    system_scheduler->RegisterSystem({ "EnemyAI", ETickPhase::SIMULATION,
+        D::NPC_HEALTH | D::PLAYER, D::NPC_BEHAVIOR | D::COMBAT, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext& context) { UpdateEnemyAISystem(context); } });
+
+    system_scheduler->RegisterSystem({ "PlayerHealth", ETickPhase::RESOLUTION,
+        D::COMBAT, D::PLAYER, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext& context) { UpdatePlayerHealthSystem(context); } });
+
+    // Bleeding is analytic; only combat timers cost anything: deaths are published
+    system_scheduler->RegisterSystem({ "NPCHealth", ETickPhase::RESOLUTION,
+        D::NONE, D::NPC_HEALTH | D::COMBAT | D::EVENTS, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext& context) { UpdateNPCHealthSystem(context); } });
+
+    // After NPCHealth, so this tick's dead leave their encounters; quiet or one-sided encounters end
+    system_scheduler->RegisterSystem({ "Encounters", ETickPhase::RESOLUTION,
+        D::NPC_HEALTH | D::PLAYER, D::COMBAT | D::NPC_BEHAVIOR | D::EVENTS, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext&) { combat_system->UpdateEncounters(world_state.all_npcs, world_state.player); } });
+
+    // Delivers this tick's events (and any published between ticks) to their subscribers
+    system_scheduler->RegisterSystem({ "Events", ETickPhase::POST,
+        D::NONE, D::EVENTS | D::REPUTATION, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext&) { event_bus->Dispatch(); } });
+
+    // After Events, so world events and dialogue opened this tick are already marked
+    system_scheduler->RegisterSystem({ "Scenarios", ETickPhase::POST,
+        D::CLOCK | D::PLAYER | D::NPC_ROUTINE, D::WORLD_EVENTS | D::REPUTATION | D::EVENTS, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext&) { scenario_manager->Update(); } });
+
+    // Runs after every NPC system so the LOD budget learns what a tick costs; only the systems that
+    // walk the tick list (Schedules, CrowdMorale) are counted, the rest scale with combatants
+    system_scheduler->RegisterSystem({ "SimulationBudget", ETickPhase::POST,
+        D::NPC_ROUTINE | D::NPC_BEHAVIOR | D::NPC_HEALTH, D::NPC_LOD, ETickRate::EVERY_FRAME, 1,
+        [this](const FSystemTickContext&) {
+            simulation_lod->EndFrame(npc_tick_seconds);
+            npc_tick_seconds = 0.0;
+        } });
+}
+
+void GameManager::RegisterEventSubscribers() {
+    static const FSymbol KILL_ACTION = MakeSymbol("kill_in_combat");
+
+    event_bus->Subscribe<FCharacterDiedEvent>([this](const FCharacterDiedEvent*, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            reputation_manager->RecordAction(KILL_ACTION, {});
+        }
+    });
+
+    // Shots and deaths frighten the crowd around them
+    event_bus->Subscribe<FCharacterDiedEvent>([this](const FCharacterDiedEvent* events, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            crowd_morale->AddStimulus(events[i].position, CrowdMorale::DEATH_FEAR, CrowdMorale::DEATH_ANGER);
+        }
+    });
+    event_bus->Subscribe<FGunfireEvent>([this](const FGunfireEvent* events, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            crowd_morale->AddStimulus(events[i].position, CrowdMorale::GUNFIRE_FEAR, 0.0f);
         }
+    });
+
+    // Scenario triggers are indexed by world event and dialogue tree
+    event_bus->Subscribe<FWorldEventChangedEvent>([this](const FWorldEventChangedEvent* events, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            scenario_manager->OnWorldEventChanged(events[i].event_id, events[i].change);
+        }
+    });
+    event_bus->Subscribe<FDialogueStartedEvent>([this](const FDialogueStartedEvent* events, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            scenario_manager->OnDialogueStarted(events[i].tree_id);
+        }
+    });
+
+    // Save dirty-tracking: anything worth a save prompt arrives as an event
+    auto count_changes = [this](size_t count) { unsaved_changes += count; };
+    event_bus->Subscribe<FCharacterDiedEvent>([=](const FCharacterDiedEvent*, size_t count) { count_changes(count); });
+    event_bus->Subscribe<FCharacterInjuredEvent>([=](const FCharacterInjuredEvent*, size_t count) { count_changes(count); });
+    event_bus->Subscribe<FPlayerActionEvent>([=](const FPlayerActionEvent*, size_t count) { count_changes(count); });
+    event_bus->Subscribe<FWorldEventChangedEvent>([=](const FWorldEventChangedEvent*, size_t count) { count_changes(count); });
+}
+
+void GameManager::AdvanceTimeSystem(const FSystemTickContext& context) {
+    // Carry fractional minutes so small frame times still progress
+    ScopedSystemTimer timer(collect_timings, system_timings.time_advance_seconds);
+    pending_game_minutes += context.delta_time * time_scale;
+    int minutes_to_advance = static_cast<int>(pending_game_minutes);
+    
+    if (minutes_to_advance > 0) {
+        pending_game_minutes -= static_cast<float>(minutes_to_advance);
+        AdvanceClock(minutes_to_advance);
     }
 }
 
+void GameManager::SelectSimulatedNPCsSystem(const FSystemTickContext& context) {
+    simulation_lod->BuildTickList(world_state.all_npcs, world_state.player.position, context.delta_time);
+    Metrics().npcs_alive.Set(static_cast<int64_t>(simulation_lod->GetAliveCount()));
+}
+
+void GameManager::UpdateSchedulesSystem(const FSystemTickContext&) {
+    // NPCs skipped for a while jump straight to their current activity
+    ScopedSystemTimer timer(collect_timings, system_timings.schedule_seconds);
+    ScopedSystemTimer budget_timer(true, npc_tick_seconds);
+    schedule_manager->UpdateNPCSchedules(world_state.current_time, world_state.all_npcs,
+                                         simulation_lod->GetTickList(), *job_system);
+}
+
+void GameManager::UpdateCrowdMoraleSystem(const FSystemTickContext&) {
+    ScopedSystemTimer timer(collect_timings, system_timings.crowd_morale_seconds);
+    ScopedSystemTimer budget_timer(true, npc_tick_seconds);
+    crowd_morale->Update(world_state.all_npcs, simulation_lod->GetTickList());
+}
+
+void GameManager::UpdateEnemyAISystem(const FSystemTickContext& context) {
+    // Combatants are always simulated in full (see SimulationLOD), so the AI works from the encounters
+    ScopedSystemTimer timer(collect_timings, system_timings.enemy_ai_seconds);
+    combat_system->UpdateEnemyBehavior(world_state.all_npcs, world_state.player, context.delta_time);
+}
+
+void GameManager::UpdatePlayerHealthSystem(const FSystemTickContext& context) {
+    // Bleeding, injuries
+    ScopedSystemTimer timer(collect_timings, system_timings.player_health_seconds);
+    if (combat_system->IsInCombat()) {
+        combat_system->UpdateHealth(world_state.player, context.delta_time);
+    }
+}
+
+void GameManager::UpdateNPCHealthSystem(const FSystemTickContext& context) {
+    ScopedSystemTimer timer(collect_timings, system_timings.npc_health_seconds);
+    combat_system->AdvanceTime(context.delta_time);
+    combat_system->ProcessTimers(world_state.all_npcs);
+}
+
 void GameManager::SpawnNPC(const FNPC& npc_definition) {
     world_state.all_npcs.push_back(npc_definition);
-    std::cout << "[GameManager] Spawned NPC: " << npc_definition.name << std::endl;
+    combat_system->RegisterNPC(world_state.all_npcs.back());
+    NAUVOO_LOG_DEBUG(ELogCategory::GAME, "[GameManager] Spawned NPC: ", npc_definition.name);
 }
 
 void GameManager::RecordPlayerAction(const std::string& action_id) {
-    reputation_manager->RecordAction(action_id, {});  // Will be populated with witnesses
-    std::cout << "[GameManager] Player action recorded: " << action_id << std::endl;
+    FReplayEvent event;
+    event.type = EReplayEvent::PLAYER_ACTION;
+    event.id = action_id;
+    RecordInput(event);
+
+    FSymbol action = SymbolTable::Get().Intern(action_id);
+    reputation_manager->RecordAction(action, {});  // Will be populated with witnesses
+    event_bus->Publish(FPlayerActionEvent{ action });
+    NAUVOO_LOG_DEBUG(ELogCategory::GAME, "[GameManager] Player action recorded: ", action_id);
 }
 
 void GameManager::StartDialogueWithNPC(const std::string& npc_id) {
+    FReplayEvent event;
+    event.type = EReplayEvent::START_DIALOGUE;
+    event.id = npc_id;
+    RecordInput(event);
+
     FNPC* npc = GetNPCById(npc_id);
     if (!npc) {
-        std::cout << "[GameManager] Error: NPC not found: " << npc_id << std::endl;
+        NAUVOO_LOG_WARNING(ELogCategory::GAME, "[GameManager] Error: NPC not found: ", npc_id);
         return;
     }
     
-    std::cout << "[GameManager] Started dialogue with " << npc->name << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Started dialogue with ", npc->name);
     // Dialogue manager will handle tree selection
 }
 
+void GameManager::SelectDialogueChoice(int choice_index) {
+    FReplayEvent event;
+    event.type = EReplayEvent::SELECT_CHOICE;
+    event.value = choice_index;
+    RecordInput(event);
+
+    dialogue_manager->SelectChoice(choice_index, dialogue_manager->GetCurrentNPCId());
+}
+
 void GameManager::EndDialogue() {
-    std::cout << "[GameManager] Dialogue ended" << std::endl;
+    FReplayEvent event;
+    event.type = EReplayEvent::END_DIALOGUE;
+    RecordInput(event);
+
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Dialogue ended");
 }
 
 void GameManager::InitiateCombat(const std::string& enemy_npc_id) {
+    FReplayEvent event;
+    event.type = EReplayEvent::INITIATE_COMBAT;
+    event.id = enemy_npc_id;
+    RecordInput(event);
+
     FNPC* enemy = GetNPCById(enemy_npc_id);
     if (!enemy) {
-        std::cout << "[GameManager] Error: Enemy NPC not found: " << enemy_npc_id << std::endl;
+        NAUVOO_LOG_WARNING(ELogCategory::GAME, "[GameManager] Error: Enemy NPC not found: ", enemy_npc_id);
         return;
     }
     
-    std::cout << "[GameManager] Combat initiated with " << enemy->name << std::endl;
-    combat_system->StartCombat(enemy_npc_id, *enemy, world_state.player);
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Combat initiated with ", enemy->name);
+    combat_system->StartCombat(world_state.all_npcs, static_cast<uint32_t>(enemy - world_state.all_npcs.data()));
+}
+
+void GameManager::FireWeapon(const FVector3& target_position, const std::string& enemy_npc_id) {
+    FReplayEvent event;
+    event.type = EReplayEvent::FIRE_WEAPON;
+    event.id = enemy_npc_id;
+    event.position = target_position;
+    RecordInput(event);
+
+    combat_system->FireWeapon(world_state.player, target_position, world_state.all_npcs, enemy_npc_id);
 }
 
 void GameManager::EndCombat() {
-    std::cout << "[GameManager] Combat ended" << std::endl;
+    FReplayEvent event;
+    event.type = EReplayEvent::END_COMBAT;
+    RecordInput(event);
+
+    combat_system->EndCombat(world_state.all_npcs);
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Combat ended");
 }
 
 void GameManager::TriggerEvent(const std::string& event_id) {
-    world_state.active_events.push_back(event_id);
-    std::cout << "[GameManager] Event triggered: " << event_id << std::endl;
+    if (world_state.world_events.Trigger(world_state.world_events.Intern(event_id))) {
+        NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Event triggered: ", event_id);
+    }
 }
 
 void GameManager::CompleteEvent(const std::string& event_id) {
     // Move from active to completed
-    auto it = std::find(world_state.active_events.begin(), 
-                       world_state.active_events.end(), event_id);
-    if (it != world_state.active_events.end()) {
-        world_state.active_events.erase(it);
-        world_state.completed_events.push_back(event_id);
-        std::cout << "[GameManager] Event completed: " << event_id << std::endl;
+    FWorldEventId id = world_state.world_events.Find(event_id);
+    if (id != INVALID_WORLD_EVENT && world_state.world_events.Complete(id)) {
+        NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Event completed: ", event_id);
     }
 }
 
 bool GameManager::IsEventActive(const std::string& event_id) const {
-    return std::find(world_state.active_events.begin(), 
-                    world_state.active_events.end(), event_id) != world_state.active_events.end();
+    FWorldEventId id = world_state.world_events.Find(event_id);
+    return id != INVALID_WORLD_EVENT && world_state.world_events.IsActive(id);
+}
+
+void GameManager::SetWorldSeed(uint64_t seed) {
+    world_state.world_seed = seed;
+    random_service->SetWorldSeed(seed);
 }
 
 void GameManager::SaveGame(const std::string& save_slot) {
+    // Skipped time and queued events are not saved, so settle them first
+    event_bus->Dispatch();
+    ResolveAllNPCs();
+    world_state.rng_stream_states = random_service->SaveState();
     save_manager->SaveGame(world_state, save_slot);
-    std::cout << "[GameManager] Game saved to slot: " << save_slot << std::endl;
+    unsaved_changes = 0;
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[GameManager] Game saved to slot: ", save_slot);
 }
 
 bool GameManager::CanLoad(const std::string& save_slot) const {
     return save_manager->SaveExists(save_slot);
 }
 
+void GameManager::BeginRecording(int checkpoint_interval_ticks) {
+    if (!replay_recorder) {
+        replay_recorder = std::make_unique<ReplayRecorder>();
+    }
+
+    FReplayHeader header;
+    header.world_seed = world_state.world_seed;
+    header.rng_stream_states = random_service->SaveState();
+    header.start_time = world_state.current_time;
+    header.time_scale = time_scale;
+    header.npc_count = static_cast<uint32_t>(world_state.all_npcs.size());
+    header.initial_state_hash = ComputeStateHash();
+
+    // The measured LOD budget varies with machine load; playback must tick the same NPCs
+    FSimulationLODSettings lod_settings = simulation_lod->GetSettings();
+    lod_settings.budget_ms = 0.0;
+    simulation_lod->SetSettings(lod_settings);
+
+    replay_recorder->Begin(header);
+    recording_base_tick = tick_count;
+    recorded_delta_time = -1.0f;
+    checkpoint_interval = checkpoint_interval_ticks;
+    NAUVOO_LOG_INFO(ELogCategory::REPLAY, "[GameManager] Recording started at tick ", tick_count);
+}
+
+bool GameManager::FinishRecording(const std::string& filename) {
+    if (!IsRecording()) return false;
+
+    size_t event_count = replay_recorder->GetEventCount();
+    bool written = replay_recorder->FinishToFile(filename, tick_count - recording_base_tick);
+    NAUVOO_LOG_INFO(ELogCategory::REPLAY, "[GameManager] Recording of ", event_count, " events ",
+                    written ? "written to " : "failed to write to ", filename);
+    return written;
+}
+
+bool GameManager::IsRecording() const {
+    return replay_recorder && replay_recorder->IsRecording();
+}
+
+void GameManager::RecordInput(const FReplayEvent& event) {
+    if (!IsRecording()) return;
+
+    FReplayEvent stamped = event;
+    stamped.tick = tick_count - recording_base_tick;
+    replay_recorder->Record(stamped);
+}
+
+uint64_t GameManager::ComputeStateHash() const {
+    uint64_t hash = 14695981039346656037ull;  // FNV-1a 64
+    auto mix = [&hash](const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    auto mix_int = [&mix](int value) { mix(&value, sizeof(value)); };
+    auto mix_float = [&mix](float value) { mix(&value, sizeof(value)); };
+
+    const FDateTime& time = world_state.current_time;
+    mix_int(time.year);
+    mix_int(time.month);
+    mix_int(time.day);
+    mix_int(time.minute);
+
+    const FPlayerState& player = world_state.player;
+    mix_float(player.health);
+    mix_float(player.stamina);
+    mix_int(static_cast<int>(player.injuries.size()));
+    mix_int(reputation_manager->GetLegionReputation());
+    mix_int(reputation_manager->GetCommunityReputation());
+    mix_int(reputation_manager->GetOutsiderReputation());
+    mix_int(combat_system->IsInCombat() ? 1 : 0);
+
+    for (const auto& npc : world_state.all_npcs) {
+        mix_float(combat_system->GetNPCHealth(npc));
+        mix_float(npc.position.x);
+        mix_float(npc.position.y);
+        mix_float(npc.position.z);
+        mix_int(npc.is_alive ? 1 : 0);
+        mix_int(npc.is_in_combat ? 1 : 0);
+        mix_int(static_cast<int>(npc.injuries.size()));
+        mix_int(reputation_manager->GetNPCTrust(npc.id));
+        mix_float(npc.fear);
+        mix_float(npc.anger);
+        mix_int(npc.is_panicking ? 1 : 0);
+    }
+
+    mix_int(static_cast<int>(world_state.world_events.GetActiveCount()));
+    mix_int(static_cast<int>(world_state.world_events.GetCompletedCount()));
+    for (const FScenarioProgress& progress : world_state.scenarios) {
+        mix_int(static_cast<int>(progress.status));
+        mix_int(static_cast<int>(progress.objectives_done));
+    }
+    return hash;
+}
+
+bool GameManager::EnableMetricsDump(const std::string& filename, int interval_game_minutes) {
+    if (interval_game_minutes <= 0 || !MetricsRegistry::Get().OpenSnapshotFile(filename)) {
+        return false;
+    }
+
+    metrics_dump_interval = interval_game_minutes;
+    minutes_since_metrics_dump = 0;
+    WriteMetricsSnapshot();
+    return true;
+}
+
+void GameManager::DisableMetricsDump() {
+    if (metrics_dump_interval > 0) {
+        WriteMetricsSnapshot();
+        MetricsRegistry::Get().CloseSnapshotFile();
+    }
+    metrics_dump_interval = 0;
+}
+
+void GameManager::WriteMetricsSnapshot() {
+    MetricsRegistry::Get().WriteSnapshot(FormatGameTime(world_state.current_time), tick_count);
+}
+
 void GameManager::PrintWorldState() const {
+    Logger::Get().Flush();
+
     std::cout << "\n=== WORLD STATE ===" << std::endl;
     std::cout << "Date: " << world_state.current_time.year << "-" 
               << world_state.current_time.month << "-" 
@@ -208,9 +699,11 @@ void GameManager::PrintWorldState() const {
         case EFormatSeason::WINTER: std::cout << "Winter"; break;
     }
     std::cout << std::endl;
-    std::cout << "Active events: " << world_state.active_events.size() << std::endl;
-    std::cout << "Completed events: " << world_state.completed_events.size() << std::endl;
+    std::cout << "Active events: " << world_state.world_events.GetActiveCount() << std::endl;
+    std::cout << "Completed events: " << world_state.world_events.GetCompletedCount() << std::endl;
     std::cout << "Spawned NPCs: " << world_state.all_npcs.size() << std::endl;
+
+    MetricsRegistry::Get().Print(std::cout);
 }
 
 void GameManager::PrintNPCStates() const {
@@ -218,7 +711,7 @@ void GameManager::PrintNPCStates() const {
     for (const auto& npc : world_state.all_npcs) {
         std::cout << npc.name << " (" << npc.id << ")" << std::endl;
         std::cout << "  Faction: " << static_cast<int>(npc.faction) << std::endl;
-        std::cout << "  Health: " << npc.health << "/" << npc.max_health << std::endl;
+        std::cout << "  Health: " << combat_system->GetNPCHealth(npc) << "/" << npc.max_health << std::endl;
         std::cout << "  Status: " << (npc.is_alive ? "Alive" : "Dead") << std::endl;
     }
 }
@@ -3,7 +3,6 @@
 #include "CoreTypes.h"
 #include <memory>
 #include <vector>
-#include <map>
 
 namespace Nauvoo {
 
@@ -11,7 +10,32 @@ class NPCScheduleManager;
 class ReputationManager;
 class DialogueManager;
 class CombatSystem;
+class CrowdMorale;
 class SaveGameManager;
+class RandomService;
+class ReplayRecorder;
+class JobSystem;
+class SystemScheduler;
+class SimulationLOD;
+class TimerWheel;
+class EventBus;
+class ScenarioManager;
+class WeaponRegistry;
+struct FSystemTickContext;
+struct FReplayEvent;
+
+/**
+ * Accumulated wall-clock time spent in each stage of GameManager::Update
+ */
+struct FSystemTimings {
+    double time_advance_seconds = 0.0;
+    double schedule_seconds = 0.0;
+    double crowd_morale_seconds = 0.0;
+    double enemy_ai_seconds = 0.0;
+    double player_health_seconds = 0.0;
+    double npc_health_seconds = 0.0;
+    uint64_t ticks = 0;
+};
 
 /**
  * Central game manager coordinating all systems
@@ -36,6 +60,10 @@ public:
     FDateTime GetCurrentTime() const { return world_state.current_time; }
     EFormatSeason GetCurrentSeason() const { return world_state.current_time.GetSeason(); }
     float GetTimeScale() const { return time_scale; }
+    void SetTimeScale(float game_minutes_per_second) { time_scale = game_minutes_per_second; }
+
+    // Schedules
+    NPCScheduleManager* GetScheduleManager() { return schedule_manager.get(); }
 
     // NPC management
     FNPC* GetNPCById(const std::string& npc_id);
@@ -56,12 +84,24 @@ public:
     // Dialogue system
     DialogueManager* GetDialogueManager() { return dialogue_manager.get(); }
     void StartDialogueWithNPC(const std::string& npc_id);
+    void SelectDialogueChoice(int choice_index);
     void EndDialogue();
 
+    // Scenarios from phase_1_scenarios.json (see ScenarioManager.h)
+    ScenarioManager* GetScenarioManager() { return scenario_manager.get(); }
+
     // Combat system
     CombatSystem* GetCombatSystem() { return combat_system.get(); }
+    WeaponRegistry* GetWeaponRegistry() { return weapon_registry.get(); }
     void InitiateCombat(const std::string& enemy_npc_id);
+    void FireWeapon(const FVector3& target_position, const std::string& enemy_npc_id);
     void EndCombat();
+    // Fear, anger and panic of the crowd around the player (see CrowdMorale.h)
+    CrowdMorale* GetCrowdMorale() { return crowd_morale.get(); }
+
+    // Random numbers
+    RandomService* GetRandomService() { return random_service.get(); }
+    void SetWorldSeed(uint64_t seed);
 
     // World state
     FWorldState& GetWorldState() { return world_state; }
@@ -71,29 +111,119 @@ public:
     void TriggerEvent(const std::string& event_id);
     void CompleteEvent(const std::string& event_id);
     bool IsEventActive(const std::string& event_id) const;
+    // Interned ids, flags and counters behind the calls above (see WorldEventRegistry.h)
+    WorldEventRegistry& GetWorldEvents() { return world_state.world_events; }
 
     // Save/Load
     void SaveGame(const std::string& save_slot);
     bool CanLoad(const std::string& save_slot) const;
-
-    // Debug
+    // Gameplay events (injuries, deaths, actions, world events) since the last save or load
+    uint64_t GetUnsavedChangeCount() const { return unsaved_changes; }
+
+    // Record/replay of external inputs (see ReplaySystem.h)
+    void BeginRecording(int checkpoint_interval_ticks = 600);
+    bool FinishRecording(const std::string& filename);
+    bool IsRecording() const;
+    uint64_t GetTickCount() const { return tick_count; }
+    uint64_t ComputeStateHash() const;
+
+    // Per-system timing
+    void EnableSystemTimings(bool enable) { collect_timings = enable; }
+    const FSystemTimings& GetSystemTimings() const { return system_timings; }
+    void ResetSystemTimings() { system_timings = FSystemTimings(); }
+
+    // Metrics snapshots (see Metrics.h), appended every interval of game time
+    bool EnableMetricsDump(const std::string& filename, int interval_game_minutes = 60);
+    void DisableMetricsDump();
+    void WriteMetricsSnapshot();
+
+    // Debug (PrintWorldState includes the live metrics view)
     void PrintWorldState() const;
     void PrintNPCStates() const;
 
+    // Systems run by Update; register more to extend the tick (see SystemScheduler.h)
+    SystemScheduler* GetSystemScheduler() { return system_scheduler.get(); }
+
+    // Callbacks keyed on the game clock in minutes, fired as the clock advances (see TimerWheel.h)
+    TimerWheel* GetGameTimers() { return game_timers.get(); }
+
+    // Typed events between managers, dispatched once per tick (see EventBus.h, GameEvents.h)
+    EventBus* GetEventBus() { return event_bus.get(); }
+
+    // Which NPCs tick each frame (see SimulationLOD.h)
+    SimulationLOD* GetSimulationLOD() { return simulation_lod.get(); }
+    // Brings an NPC skipped by the LOD up to date (GetNPCById does this for you)
+    void ResolveNPC(FNPC& npc);
+    void ResolveAllNPCs();
+
+    // Scratch memory for one tick, rewound at the start of every Update and handed to
+    // systems as FSystemTickContext::frame_memory (see Memory.h)
+    FrameArena* GetFrameArena() { return frame_arena.get(); }
+    // Heap allocations made during the last Update; the steady-state target is zero
+    uint64_t GetLastTickAllocations() const { return last_tick_allocations; }
+
+    // Worker pool the systems run on (defaults to the shared JobSystem::Get() pool)
+    void SetJobSystem(JobSystem* jobs);
+    JobSystem* GetJobSystem() const { return job_system; }
+
 private:
     FWorldState world_state;
     
+    std::unique_ptr<RandomService> random_service;
     std::unique_ptr<NPCScheduleManager> schedule_manager;
     std::unique_ptr<ReputationManager> reputation_manager;
     std::unique_ptr<DialogueManager> dialogue_manager;
+    std::unique_ptr<WeaponRegistry> weapon_registry;       // combat keeps archetype ids, so declared before it
     std::unique_ptr<CombatSystem> combat_system;
+    std::unique_ptr<CrowdMorale> crowd_morale;
     std::unique_ptr<SaveGameManager> save_manager;
+    std::unique_ptr<ReplayRecorder> replay_recorder;
+
+    JobSystem* job_system = nullptr;
+    std::unique_ptr<SystemScheduler> system_scheduler;
+    std::unique_ptr<SimulationLOD> simulation_lod;
+    std::unique_ptr<TimerWheel> game_timers;
+    std::unique_ptr<EventBus> event_bus;
+    std::unique_ptr<ScenarioManager> scenario_manager;     // holds game timers, so declared after them
+    std::unique_ptr<FrameArena> frame_arena;
+    uint64_t last_tick_allocations = 0;
+    uint64_t unsaved_changes = 0;
 
     float time_scale = 0.02f;  // 1 real second = 1.2 game minutes
+    float pending_game_minutes = 0.0f;  // fractional minutes carried between frames
     bool is_paused = false;
 
+    bool collect_timings = false;
+    FSystemTimings system_timings;
+    double npc_tick_seconds = 0.0;     // this frame's schedule and crowd morale time, for the LOD budget
+
+    int metrics_dump_interval = 0;  // game minutes; 0 = disabled
+    int minutes_since_metrics_dump = 0;
+
+    // Replay bookkeeping
+    uint64_t tick_count = 0;
+    uint64_t recording_base_tick = 0;
+    float recorded_delta_time = -1.0f;
+    int checkpoint_interval = 600;
+
+    void AdvanceClock(int minutes);
+    void ResetGameTimers();
+    void ScheduleDailyMaintenance(uint64_t due_minute);
+    void RegisterCoreSystems();
+    void RegisterEventSubscribers();
+
+    // Core systems (see RegisterCoreSystems for their data and rates)
+    void AdvanceTimeSystem(const FSystemTickContext& context);
+    void SelectSimulatedNPCsSystem(const FSystemTickContext& context);
+    void UpdateSchedulesSystem(const FSystemTickContext& context);
+    void UpdateCrowdMoraleSystem(const FSystemTickContext& context);
+    void UpdateEnemyAISystem(const FSystemTickContext& context);
+    void UpdatePlayerHealthSystem(const FSystemTickContext& context);
+    void UpdateNPCHealthSystem(const FSystemTickContext& context);
+    void RecordInput(const FReplayEvent& event);
+
     // NPC daily routine tracking
-    std::map<std::string, std::string> npc_current_activity;  // NPC_ID -> Activity_ID
+    TFlatHashMap<FSymbol, FSymbol> npc_current_activity;  // NPC -> activity
 };
 
 }  // namespace Nauvoo
@@ -0,0 +1,171 @@
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <chrono>
+
+namespace Nauvoo {
+
+namespace {
+
+// Pool and queue the current thread works for (workers only)
+thread_local const JobSystem* current_pool = nullptr;
+thread_local size_t current_queue = 0;
+
+}  // namespace
+
+// ==================== JobSystem ====================
+
+JobSystem& JobSystem::Get() {
+    static JobSystem instance(std::thread::hardware_concurrency() > 1
+                                  ? std::thread::hardware_concurrency() - 1 : 0);
+    return instance;
+}
+
+JobSystem::JobSystem(unsigned worker_count) {
+    queues.reserve(worker_count + 1);
+    for (unsigned i = 0; i <= worker_count; ++i) {
+        queues.push_back(std::make_unique<FWorkerQueue>());
+    }
+
+    workers.reserve(worker_count);
+    for (unsigned i = 0; i < worker_count; ++i) {
+        workers.emplace_back(&JobSystem::WorkerLoop, this, static_cast<size_t>(i) + 1);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stopping.store(true, std::memory_order_release);
+    }
+    wake.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t JobSystem::GetHomeQueue() const {
+    return current_pool == this ? current_queue : 0;
+}
+
+void JobSystem::Submit(FJobCounter& counter, FJob job) {
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+    FWorkerQueue& queue = *queues[GetHomeQueue()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back({ std::move(job), &counter });
+    }
+
+    queued_jobs.fetch_add(1, std::memory_order_release);
+    wake.notify_one();
+}
+
+void JobSystem::Wait(FJobCounter& counter) {
+    size_t home_queue = GetHomeQueue();
+    while (!counter.IsDone()) {
+        if (!TryRunOne(home_queue)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::TryRunOne(size_t home_queue) {
+    FQueuedJob job;
+    bool found = false;
+
+    // Own queue first, newest job (its data is most likely still in cache)
+    {
+        FWorkerQueue& own = *queues[home_queue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+
+    // Otherwise steal the oldest job from another queue
+    for (size_t offset = 1; !found && offset < queues.size(); ++offset) {
+        FWorkerQueue& victim = *queues[(home_queue + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found) return false;
+
+    queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+    job.work();
+    job.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+void JobSystem::WorkerLoop(size_t home_queue) {
+    current_pool = this;
+    current_queue = home_queue;
+
+    while (!stopping.load(std::memory_order_acquire)) {
+        if (TryRunOne(home_queue)) continue;
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        wake.wait_for(lock, std::chrono::milliseconds(1), [this]() {
+            return stopping.load(std::memory_order_acquire) || queued_jobs.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+// ==================== JobGraph ====================
+
+JobGraph::FNodeId JobGraph::AddNode(const char* name, std::function<void()> work) {
+    auto node = std::make_unique<FNode>();
+    node->name = name;
+    node->work = std::move(work);
+    nodes.push_back(std::move(node));
+    return nodes.size() - 1;
+}
+
+void JobGraph::AddDependency(FNodeId before, FNodeId after) {
+    nodes[before]->successors.push_back(after);
+    nodes[after]->dependency_count++;
+}
+
+void JobGraph::Run(JobSystem& jobs) {
+    for (auto& node : nodes) {
+        node->remaining.store(node->dependency_count, std::memory_order_relaxed);
+    }
+
+    FJobCounter counter;
+    run_jobs = &jobs;
+    run_counter = &counter;
+    for (FNodeId node = 0; node < nodes.size(); ++node) {
+        if (nodes[node]->dependency_count == 0) {
+            Schedule(node);
+        }
+    }
+    jobs.Wait(counter);
+    run_jobs = nullptr;
+    run_counter = nullptr;
+}
+
+void JobGraph::Schedule(FNodeId node) {
+    run_jobs->Submit(*run_counter, [this, node]() {
+        FNode& current = *nodes[node];
+        {
+            NAUVOO_PROFILE_ZONE(current.name);
+            current.work();
+        }
+
+        // The last finished dependency releases each successor
+        for (FNodeId successor : current.successors) {
+            if (nodes[successor]->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                Schedule(successor);
+            }
+        }
+    });
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nauvoo {
+
+/**
+ * Number of outstanding jobs in a batch; JobSystem::Wait returns once it reaches zero
+ */
+struct FJobCounter {
+    std::atomic<int> pending{ 0 };
+
+    bool IsDone() const { return pending.load(std::memory_order_acquire) == 0; }
+};
+
+/**
+ * Work-stealing thread pool. Each worker owns a deque: it pushes and pops at
+ * the back (LIFO, cache-warm) and idle workers steal from the front of others.
+ * Threads that wait on a counter run queued jobs instead of blocking, so nested
+ * parallel work cannot deadlock and a pool with zero workers runs everything
+ * inline on the calling thread.
+ */
+class JobSystem {
+public:
+    using FJob = std::function<void()>;
+
+    // Shared pool sized to the machine (hardware threads - 1, the caller being the last one)
+    static JobSystem& Get();
+
+    explicit JobSystem(unsigned worker_count);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned GetWorkerCount() const { return static_cast<unsigned>(workers.size()); }
+
+    void Submit(FJobCounter& counter, FJob job);
+    void Wait(FJobCounter& counter);
+
+    /**
+     * Calls fn(chunk_index, begin, end) over [0, count) in chunks of grain items.
+     * Chunk boundaries depend only on count and grain, never on the worker count,
+     * so per-chunk results merged in chunk order are deterministic.
+     */
+    template <typename Fn>
+    void ParallelFor(size_t count, size_t grain, Fn&& fn) {
+        if (count == 0) return;
+        if (grain == 0) grain = 1;
+
+        size_t chunk_count = GetChunkCount(count, grain);
+        if (workers.empty() || chunk_count == 1) {
+            for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+                fn(chunk, chunk * grain, std::min(count, (chunk + 1) * grain));
+            }
+            return;
+        }
+
+        FJobCounter counter;
+        for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+            size_t begin = chunk * grain;
+            size_t end = std::min(count, begin + grain);
+            Submit(counter, [&fn, chunk, begin, end]() { fn(chunk, begin, end); });
+        }
+        Wait(counter);
+    }
+
+    static size_t GetChunkCount(size_t count, size_t grain) {
+        return grain == 0 ? count : (count + grain - 1) / grain;
+    }
+
+private:
+    struct FQueuedJob {
+        FJob work;
+        FJobCounter* counter;
+    };
+
+    struct FWorkerQueue {
+        std::mutex mutex;
+        std::deque<FQueuedJob> jobs;
+    };
+
+    // Queue 0 belongs to threads outside the pool; worker i uses queue i + 1
+    std::vector<std::unique_ptr<FWorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    std::atomic<bool> stopping{ false };
+    std::atomic<int64_t> queued_jobs{ 0 };
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+
+    size_t GetHomeQueue() const;
+    bool TryRunOne(size_t home_queue);
+    void WorkerLoop(size_t home_queue);
+};
+
+/**
+ * Dependency graph of jobs, e.g. the phases of a simulation tick. A node starts
+ * once every node it depends on has finished; independent nodes run in parallel.
+ * Build once and Run every frame.
+ */
+class JobGraph {
+public:
+    using FNodeId = size_t;
+
+    FNodeId AddNode(const char* name, std::function<void()> work);
+    void AddDependency(FNodeId before, FNodeId after);
+
+    void Run(JobSystem& jobs);
+
+    size_t GetNodeCount() const { return nodes.size(); }
+    const char* GetNodeName(FNodeId node) const { return nodes[node]->name; }
+
+private:
+    struct FNode {
+        const char* name;
+        std::function<void()> work;
+        std::vector<FNodeId> successors;
+        int dependency_count = 0;
+        std::atomic<int> remaining{ 0 };
+    };
+
+    std::vector<std::unique_ptr<FNode>> nodes;
+
+    // Set for the duration of Run so a scheduled job captures only (this, node),
+    // which std::function stores inline instead of on the heap
+    JobSystem* run_jobs = nullptr;
+    FJobCounter* run_counter = nullptr;
+
+    void Schedule(FNodeId node);
+};
+
+/**
+ * Commands recorded by parallel chunks and applied afterwards on one thread.
+ * Commands are replayed in chunk order, then recording order, so the result
+ * matches a serial loop over the same range.
+ */
+template <typename TCommand>
+class CommandBuffer {
+public:
+    void Reset(size_t chunk_count) {
+        if (chunks.size() < chunk_count) chunks.resize(chunk_count);
+        for (auto& chunk : chunks) chunk.clear();
+        used_chunks = chunk_count;
+    }
+
+    // Each chunk may only be written by the job processing it
+    void Push(size_t chunk, const TCommand& command) { chunks[chunk].push_back(command); }
+
+    template <typename Fn>
+    void Apply(Fn&& apply) {
+        for (size_t chunk = 0; chunk < used_chunks; ++chunk) {
+            for (const TCommand& command : chunks[chunk]) apply(command);
+            chunks[chunk].clear();
+        }
+    }
+
+    bool IsEmpty() const {
+        for (size_t chunk = 0; chunk < used_chunks; ++chunk) {
+            if (!chunks[chunk].empty()) return false;
+        }
+        return true;
+    }
+
+private:
+    std::vector<std::vector<TCommand>> chunks;
+    size_t used_chunks = 0;
+};
+
+}  // namespace Nauvoo
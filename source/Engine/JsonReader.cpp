@@ -0,0 +1,315 @@
+#include "JsonReader.h"
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace Nauvoo {
+
+namespace {
+
+constexpr int MAX_DEPTH = 128;     // nesting bound so hostile input cannot exhaust the stack
+
+class FJsonParser {
+public:
+    explicit FJsonParser(const std::string& source) : text(source) {}
+
+    bool ParseDocument(FJsonValue& out) {
+        SkipWhitespace();
+        if (!ParseValue(out, 0)) return false;
+        SkipWhitespace();
+        if (pos != text.size()) return Fail("unexpected trailing characters");
+        return true;
+    }
+
+    std::string GetError() const {
+        // Line and column of the failure, both 1-based
+        size_t line = 1, column = 1;
+        for (size_t i = 0; i < error_pos && i < text.size(); ++i) {
+            if (text[i] == '\n') {
+                line++;
+                column = 1;
+            } else {
+                column++;
+            }
+        }
+        return std::to_string(line) + ":" + std::to_string(column) + ": " + error;
+    }
+
+private:
+    const std::string& text;
+    size_t pos = 0;
+    std::string error;
+    size_t error_pos = 0;
+
+    bool Fail(const char* message) {
+        error = message;
+        error_pos = pos;
+        return false;
+    }
+
+    void SkipWhitespace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+            pos++;
+        }
+    }
+
+    bool Consume(char expected) {
+        if (pos < text.size() && text[pos] == expected) {
+            pos++;
+            return true;
+        }
+        return false;
+    }
+
+    bool ConsumeLiteral(const char* literal) {
+        size_t start = pos;
+        for (const char* c = literal; *c; ++c) {
+            if (!Consume(*c)) {
+                pos = start;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool ParseValue(FJsonValue& out, int depth) {
+        if (depth > MAX_DEPTH) return Fail("nesting too deep");
+        if (pos >= text.size()) return Fail("unexpected end of input");
+
+        switch (text[pos]) {
+            case '{': return ParseObject(out, depth);
+            case '[': return ParseArray(out, depth);
+            case '"':
+                out.type = EJsonType::STRING;
+                return ParseString(out.string);
+            case 't':
+            case 'f':
+                out.type = EJsonType::BOOLEAN;
+                out.boolean = text[pos] == 't';
+                return ConsumeLiteral(out.boolean ? "true" : "false") || Fail("invalid literal");
+            case 'n':
+                out.type = EJsonType::NUL;
+                return ConsumeLiteral("null") || Fail("invalid literal");
+            default:
+                return ParseNumber(out);
+        }
+    }
+
+    bool ParseObject(FJsonValue& out, int depth) {
+        out.type = EJsonType::OBJECT;
+        pos++;
+        SkipWhitespace();
+        if (Consume('}')) return true;
+
+        while (true) {
+            SkipWhitespace();
+            if (pos >= text.size() || text[pos] != '"') return Fail("expected member name");
+            out.keys.emplace_back();
+            if (!ParseString(out.keys.back())) return false;
+
+            SkipWhitespace();
+            if (!Consume(':')) return Fail("expected ':'");
+            SkipWhitespace();
+            out.elements.emplace_back();
+            if (!ParseValue(out.elements.back(), depth + 1)) return false;
+
+            SkipWhitespace();
+            if (Consume('}')) return true;
+            if (!Consume(',')) return Fail("expected ',' or '}'");
+        }
+    }
+
+    bool ParseArray(FJsonValue& out, int depth) {
+        out.type = EJsonType::ARRAY;
+        pos++;
+        SkipWhitespace();
+        if (Consume(']')) return true;
+
+        while (true) {
+            SkipWhitespace();
+            out.elements.emplace_back();
+            if (!ParseValue(out.elements.back(), depth + 1)) return false;
+
+            SkipWhitespace();
+            if (Consume(']')) return true;
+            if (!Consume(',')) return Fail("expected ',' or ']'");
+        }
+    }
+
+    bool ParseNumber(FJsonValue& out) {
+        // Validate the JSON grammar first; strtod accepts more (hex, inf, leading '+')
+        size_t start = pos;
+        Consume('-');
+        if (!Consume('0')) {
+            if (pos >= text.size() || text[pos] < '1' || text[pos] > '9') return Fail("unexpected character");
+            ConsumeDigits();
+        }
+        if (Consume('.')) {
+            if (!ConsumeDigits()) return Fail("expected digits after '.'");
+        }
+        if (Consume('e') || Consume('E')) {
+            if (!Consume('+')) Consume('-');
+            if (!ConsumeDigits()) return Fail("expected exponent digits");
+        }
+
+        out.type = EJsonType::NUMBER;
+        out.number = std::strtod(text.substr(start, pos - start).c_str(), nullptr);
+        return true;
+    }
+
+    bool ConsumeDigits() {
+        size_t start = pos;
+        while (pos < text.size() && std::isdigit(static_cast<unsigned char>(text[pos]))) pos++;
+        return pos > start;
+    }
+
+    bool ParseString(std::string& out) {
+        pos++;  // opening quote
+        while (true) {
+            if (pos >= text.size()) return Fail("unterminated string");
+            char c = text[pos];
+            if (c == '"') {
+                pos++;
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) return Fail("control character in string");
+            if (c != '\\') {
+                out.push_back(c);
+                pos++;
+                continue;
+            }
+
+            pos++;
+            if (pos >= text.size()) return Fail("unterminated string");
+            char escape = text[pos++];
+            switch (escape) {
+                case '"': out.push_back('"'); break;
+                case '\\': out.push_back('\\'); break;
+                case '/': out.push_back('/'); break;
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'n': out.push_back('\n'); break;
+                case 'r': out.push_back('\r'); break;
+                case 't': out.push_back('\t'); break;
+                case 'u':
+                    if (!ParseUnicodeEscape(out)) return false;
+                    break;
+                default:
+                    pos--;
+                    return Fail("invalid escape");
+            }
+        }
+    }
+
+    bool ParseHex4(uint32_t& code) {
+        if (pos + 4 > text.size()) return Fail("truncated \\u escape");
+        code = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = text[pos++];
+            code <<= 4;
+            if (c >= '0' && c <= '9') code |= static_cast<uint32_t>(c - '0');
+            else if (c >= 'a' && c <= 'f') code |= static_cast<uint32_t>(c - 'a' + 10);
+            else if (c >= 'A' && c <= 'F') code |= static_cast<uint32_t>(c - 'A' + 10);
+            else return Fail("invalid \\u escape");
+        }
+        return true;
+    }
+
+    bool ParseUnicodeEscape(std::string& out) {
+        uint32_t code = 0;
+        if (!ParseHex4(code)) return false;
+
+        // Surrogate pairs arrive as two escapes
+        if (code >= 0xD800 && code <= 0xDBFF) {
+            uint32_t low = 0;
+            if (!ConsumeLiteral("\\u") || !ParseHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                return Fail("unpaired surrogate");
+            }
+            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+        } else if (code >= 0xDC00 && code <= 0xDFFF) {
+            return Fail("unpaired surrogate");
+        }
+
+        // UTF-8 encode
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+        return true;
+    }
+};
+
+const FJsonValue& NullValue() {
+    static const FJsonValue null_value;
+    return null_value;
+}
+
+}  // namespace
+
+// ==================== FJsonValue ====================
+
+const FJsonValue* FJsonValue::Find(const std::string& key) const {
+    if (type != EJsonType::OBJECT) return nullptr;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i] == key) return &elements[i];
+    }
+    return nullptr;
+}
+
+const FJsonValue& FJsonValue::operator[](const std::string& key) const {
+    const FJsonValue* value = Find(key);
+    return value ? *value : NullValue();
+}
+
+std::string FJsonValue::GetString(const std::string& key, const std::string& fallback) const {
+    const FJsonValue* value = Find(key);
+    return value && value->type == EJsonType::STRING ? value->string : fallback;
+}
+
+double FJsonValue::GetNumber(const std::string& key, double fallback) const {
+    const FJsonValue* value = Find(key);
+    return value && value->type == EJsonType::NUMBER ? value->number : fallback;
+}
+
+bool FJsonValue::GetBool(const std::string& key, bool fallback) const {
+    const FJsonValue* value = Find(key);
+    return value && value->type == EJsonType::BOOLEAN ? value->boolean : fallback;
+}
+
+// ==================== JsonReader ====================
+
+bool JsonReader::Parse(const std::string& text, FJsonValue& out, std::string* error) {
+    out = FJsonValue();
+    FJsonParser parser(text);
+    if (parser.ParseDocument(out)) return true;
+
+    if (error) *error = parser.GetError();
+    out = FJsonValue();
+    return false;
+}
+
+bool JsonReader::ParseFile(const std::string& filename, FJsonValue& out, std::string* error) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        if (error) *error = "cannot open " + filename;
+        return false;
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return Parse(contents.str(), out, error);
+}
+
+}  // namespace Nauvoo
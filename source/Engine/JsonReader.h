@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Nauvoo {
+
+enum class EJsonType : uint8_t {
+    NUL,
+    BOOLEAN,
+    NUMBER,
+    STRING,
+    ARRAY,
+    OBJECT
+};
+
+/**
+ * One node of a parsed JSON document. Objects keep their members in file
+ * order as parallel key/value lists; lookups are linear, which suits the
+ * small data files loaded at startup. Missing keys read as null.
+ */
+struct FJsonValue {
+    EJsonType type = EJsonType::NUL;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<FJsonValue> elements;   // array items, or object values
+    std::vector<std::string> keys;      // object keys, parallel to elements
+
+    bool IsNull() const { return type == EJsonType::NUL; }
+    bool IsArray() const { return type == EJsonType::ARRAY; }
+    bool IsObject() const { return type == EJsonType::OBJECT; }
+    size_t GetSize() const { return elements.size(); }
+
+    const FJsonValue* Find(const std::string& key) const;
+    const FJsonValue& operator[](const std::string& key) const;
+    const FJsonValue& operator[](size_t index) const { return elements[index]; }
+
+    // Typed member reads; the fallback covers missing keys and type mismatches
+    std::string GetString(const std::string& key, const std::string& fallback = std::string()) const;
+    double GetNumber(const std::string& key, double fallback = 0.0) const;
+    bool GetBool(const std::string& key, bool fallback = false) const;
+};
+
+/**
+ * Strict RFC 8259 parser producing an FJsonValue tree. Errors report the
+ * line and column of the first offending character.
+ */
+class JsonReader {
+public:
+    static bool Parse(const std::string& text, FJsonValue& out, std::string* error = nullptr);
+    static bool ParseFile(const std::string& filename, FJsonValue& out, std::string* error = nullptr);
+};
+
+}  // namespace Nauvoo
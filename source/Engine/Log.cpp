@@ -0,0 +1,192 @@
+#include "Log.h"
+#include "Memory.h"
+#include <chrono>
+#include <sstream>
+
+namespace Nauvoo {
+
+namespace {
+
+uint64_t SteadyNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+}  // namespace
+
+// ==================== FLogQueue ====================
+
+FLogQueue::FLogQueue(size_t capacity) {
+    size_t size = RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+    cells = std::make_unique<FCell[]>(size);
+    mask = size - 1;
+    for (size_t i = 0; i < size; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+FLogRecord* FLogQueue::TryClaim(uint64_t& position) {
+    uint64_t pos = enqueue_position.load(std::memory_order_relaxed);
+    for (;;) {
+        FCell& cell = cells[pos & mask];
+        uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+
+        if (diff == 0) {
+            if (enqueue_position.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                position = pos;
+                return &cell.record;
+            }
+        } else if (diff < 0) {
+            return nullptr;     // full: the writer has not caught up
+        } else {
+            pos = enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void FLogQueue::Publish(uint64_t position) {
+    cells[position & mask].sequence.store(position + 1, std::memory_order_release);
+}
+
+// ==================== Logger ====================
+
+Logger& Logger::Get() {
+    static Logger instance;
+    return instance;
+}
+
+Logger::Logger()
+    : queue(QUEUE_CAPACITY),
+      epoch_ns(SteadyNs()) {
+    writer = std::thread(&Logger::WriterLoop, this);
+}
+
+Logger::~Logger() {
+    stopping.store(true, std::memory_order_release);
+    if (writer.joinable()) {
+        writer.join();
+    }
+    CloseFile();
+}
+
+uint64_t Logger::NowNs() const {
+    return SteadyNs() - epoch_ns;
+}
+
+void Logger::WriterLoop() {
+    // Formatting runs beside the simulation, not in it; keep it out of the per-tick allocation counts
+    SetThreadAllocationsTracked(false);
+    for (;;) {
+        bool stop_requested = stopping.load(std::memory_order_acquire);
+        if (Drain() == 0) {
+            if (stop_requested) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+size_t Logger::Drain() {
+    std::lock_guard<std::mutex> lock(sink_mutex);
+
+    std::string line;
+    size_t count = queue.ConsumeAll([&](const FLogRecord& record) {
+        line = FormatMessage(record);
+        line += '\n';
+
+        if (console_enabled) {
+            std::fwrite(line.data(), 1, line.size(), stdout);
+        }
+        if (file) {
+            std::fprintf(file, "[%10.6f] %-7s %-10s ", record.timestamp_ns / 1e9,
+                         GetLevelName(record.level), GetCategoryName(record.category));
+            std::fwrite(line.data(), 1, line.size(), file);
+        }
+    });
+
+    // One flush per batch rather than per line
+    if (count > 0) {
+        if (console_enabled) std::fflush(stdout);
+        if (file) std::fflush(file);
+        written.fetch_add(count, std::memory_order_release);
+    }
+    return count;
+}
+
+void Logger::Flush() {
+    // Dropped calls never claim a cell, so every claimed cell will be written
+    uint64_t target = queue.GetClaimedCount();
+    while (written.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+}
+
+void Logger::SetConsoleEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock(sink_mutex);
+    console_enabled = enabled;
+}
+
+bool Logger::OpenFile(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(sink_mutex);
+    if (file) std::fclose(file);
+    file = std::fopen(filename.c_str(), "w");
+    return file != nullptr;
+}
+
+void Logger::CloseFile() {
+    std::lock_guard<std::mutex> lock(sink_mutex);
+    if (file) {
+        std::fclose(file);
+        file = nullptr;
+    }
+}
+
+const char* Logger::GetLevelName(ELogLevel level) {
+    switch (level) {
+        case ELogLevel::TRACE: return "TRACE";
+        case ELogLevel::DEBUG: return "DEBUG";
+        case ELogLevel::INFO: return "INFO";
+        case ELogLevel::WARNING: return "WARNING";
+        case ELogLevel::ERROR: return "ERROR";
+        case ELogLevel::OFF: return "OFF";
+    }
+    return "?";
+}
+
+const char* Logger::GetCategoryName(ELogCategory category) {
+    switch (category) {
+        case ELogCategory::GAME: return "Game";
+        case ELogCategory::REPUTATION: return "Reputation";
+        case ELogCategory::SCHEDULE: return "Schedule";
+        case ELogCategory::DIALOGUE: return "Dialogue";
+        case ELogCategory::COMBAT: return "Combat";
+        case ELogCategory::SAVE: return "Save";
+        case ELogCategory::REPLAY: return "Replay";
+    }
+    return "?";
+}
+
+std::string Logger::FormatMessage(const FLogRecord& record) {
+    // Same rules as streaming the arguments to std::cout
+    std::ostringstream out;
+    for (uint8_t i = 0; i < record.arg_count; ++i) {
+        const FLogRecord::FArgValue& value = record.values[i];
+        switch (record.types[i]) {
+            case ELogArgType::INT: out << value.i; break;
+            case ELogArgType::UINT: out << value.u; break;
+            case ELogArgType::DOUBLE: out << value.d; break;
+            case ELogArgType::BOOL: out << (value.u != 0); break;
+            case ELogArgType::CHAR: out << static_cast<char>(value.u); break;
+            case ELogArgType::TEXT: out.write(record.text + value.text.offset, value.text.length); break;
+        }
+    }
+    return out.str();
+}
+
+}  // namespace Nauvoo
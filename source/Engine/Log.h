@@ -0,0 +1,309 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+namespace Nauvoo {
+
+enum class ELogLevel : uint8_t {
+    TRACE = 0,
+    DEBUG = 1,
+    INFO = 2,
+    WARNING = 3,
+    ERROR = 4,
+    OFF = 5
+};
+
+// Bit flags so categories can be masked together
+enum class ELogCategory : uint32_t {
+    GAME = 1u << 0,
+    REPUTATION = 1u << 1,
+    SCHEDULE = 1u << 2,
+    DIALOGUE = 1u << 3,
+    COMBAT = 1u << 4,
+    SAVE = 1u << 5,
+    REPLAY = 1u << 6
+};
+
+constexpr uint32_t LOG_CATEGORY_ALL = 0xFFFFFFFFu;
+
+}  // namespace Nauvoo
+
+// Calls below this level are compiled out. Release builds keep INFO and above.
+#ifndef NAUVOO_LOG_MIN_LEVEL
+  #ifdef NDEBUG
+    #define NAUVOO_LOG_MIN_LEVEL 2
+  #else
+    #define NAUVOO_LOG_MIN_LEVEL 0
+  #endif
+#endif
+
+namespace Nauvoo {
+
+constexpr bool IsLogLevelCompiled(int level) {
+    return level >= NAUVOO_LOG_MIN_LEVEL;
+}
+
+}  // namespace Nauvoo
+
+// Arguments are captured by type and formatted on the writer thread, e.g.
+// NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] Hit! Dealt ", damage, " damage");
+#define NAUVOO_LOG(level, category, ...)                                                        \
+    do {                                                                                       \
+        if constexpr (::Nauvoo::IsLogLevelCompiled(static_cast<int>(level))) {                \
+            if (::Nauvoo::Logger::IsEnabled(level, category)) {                                \
+                ::Nauvoo::Logger::Get().Write(level, category, __VA_ARGS__);                   \
+            }                                                                                  \
+        }                                                                                      \
+    } while (0)
+
+#define NAUVOO_LOG_TRACE(category, ...) NAUVOO_LOG(::Nauvoo::ELogLevel::TRACE, category, __VA_ARGS__)
+#define NAUVOO_LOG_DEBUG(category, ...) NAUVOO_LOG(::Nauvoo::ELogLevel::DEBUG, category, __VA_ARGS__)
+#define NAUVOO_LOG_INFO(category, ...) NAUVOO_LOG(::Nauvoo::ELogLevel::INFO, category, __VA_ARGS__)
+#define NAUVOO_LOG_WARNING(category, ...) NAUVOO_LOG(::Nauvoo::ELogLevel::WARNING, category, __VA_ARGS__)
+#define NAUVOO_LOG_ERROR(category, ...) NAUVOO_LOG(::Nauvoo::ELogLevel::ERROR, category, __VA_ARGS__)
+
+namespace Nauvoo {
+
+enum class ELogArgType : uint8_t {
+    INT,
+    UINT,
+    DOUBLE,
+    BOOL,
+    CHAR,
+    TEXT
+};
+
+/**
+ * One log call, stored as typed arguments rather than formatted text.
+ * String arguments are copied into an inline buffer (truncated if it fills).
+ */
+struct FLogRecord {
+    static constexpr size_t MAX_ARGS = 12;
+    static constexpr size_t TEXT_CAPACITY = 192;
+
+    union FArgValue {
+        int64_t i;
+        uint64_t u;
+        double d;
+        struct { uint16_t offset; uint16_t length; } text;
+    };
+
+    uint64_t timestamp_ns = 0;
+    ELogLevel level = ELogLevel::INFO;
+    ELogCategory category = ELogCategory::GAME;
+    uint8_t arg_count = 0;
+    uint16_t text_used = 0;
+    ELogArgType types[MAX_ARGS];
+    FArgValue values[MAX_ARGS];
+    char text[TEXT_CAPACITY];
+
+    void Begin(ELogLevel record_level, ELogCategory record_category, uint64_t now_ns) {
+        timestamp_ns = now_ns;
+        level = record_level;
+        category = record_category;
+        arg_count = 0;
+        text_used = 0;
+    }
+
+    template <typename T>
+    void Append(const T& value) {
+        if (arg_count >= MAX_ARGS) return;
+
+        FArgValue& slot = values[arg_count];
+        ELogArgType& type = types[arg_count];
+
+        if constexpr (std::is_same_v<T, bool>) {
+            type = ELogArgType::BOOL;
+            slot.u = value ? 1 : 0;
+        } else if constexpr (std::is_same_v<T, char>) {
+            type = ELogArgType::CHAR;
+            slot.u = static_cast<unsigned char>(value);
+        } else if constexpr (std::is_enum_v<T>) {
+            type = ELogArgType::INT;
+            slot.i = static_cast<int64_t>(value);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            type = ELogArgType::INT;
+            slot.i = value;
+        } else if constexpr (std::is_integral_v<T>) {
+            type = ELogArgType::UINT;
+            slot.u = value;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            type = ELogArgType::DOUBLE;
+            slot.d = value;
+        } else {
+            std::string_view view(value);
+            size_t length = std::min(view.size(), TEXT_CAPACITY - text_used);
+            view.copy(text + text_used, length);
+            type = ELogArgType::TEXT;
+            slot.text.offset = text_used;
+            slot.text.length = static_cast<uint16_t>(length);
+            text_used = static_cast<uint16_t>(text_used + length);
+        }
+
+        arg_count++;
+    }
+};
+
+/**
+ * Bounded multi-producer/single-consumer queue (Vyukov). Producers claim a
+ * cell, fill it in place and publish; a full queue drops instead of blocking.
+ */
+class FLogQueue {
+public:
+    explicit FLogQueue(size_t capacity);
+
+    FLogRecord* TryClaim(uint64_t& position);
+    void Publish(uint64_t position);
+
+    template <typename Fn>
+    size_t ConsumeAll(Fn&& consume) {
+        size_t consumed = 0;
+        for (;;) {
+            FCell& cell = cells[dequeue_position & mask];
+            if (cell.sequence.load(std::memory_order_acquire) != dequeue_position + 1) break;
+
+            consume(cell.record);
+            cell.sequence.store(dequeue_position + mask + 1, std::memory_order_release);
+            dequeue_position++;
+            consumed++;
+        }
+        return consumed;
+    }
+
+    uint64_t GetClaimedCount() const { return enqueue_position.load(std::memory_order_acquire); }
+
+private:
+    struct FCell {
+        std::atomic<uint64_t> sequence;
+        FLogRecord record;
+    };
+
+    std::unique_ptr<FCell[]> cells;
+    uint64_t mask;
+    alignas(64) std::atomic<uint64_t> enqueue_position{ 0 };
+    alignas(64) uint64_t dequeue_position = 0;     // writer thread only
+};
+
+/**
+ * Asynchronous logger. Hot-path calls only capture arguments into the queue;
+ * a background thread formats them and writes to stdout and/or a log file.
+ */
+class Logger {
+public:
+    static constexpr size_t QUEUE_CAPACITY = 4096;
+
+    static Logger& Get();
+    ~Logger();
+
+    // Runtime filtering on top of NAUVOO_LOG_MIN_LEVEL
+    static bool IsEnabled(ELogLevel level, ELogCategory category) {
+        return static_cast<int>(level) >= runtime_level.load(std::memory_order_relaxed)
+            && (category_mask.load(std::memory_order_relaxed) & static_cast<uint32_t>(category)) != 0;
+    }
+    static void SetLevel(ELogLevel level) { runtime_level.store(static_cast<int>(level), std::memory_order_relaxed); }
+    static ELogLevel GetLevel() { return static_cast<ELogLevel>(runtime_level.load(std::memory_order_relaxed)); }
+    static void SetCategoryMask(uint32_t mask) { category_mask.store(mask, std::memory_order_relaxed); }
+    static uint32_t GetCategoryMask() { return category_mask.load(std::memory_order_relaxed); }
+
+    template <typename... Args>
+    void Write(ELogLevel level, ELogCategory category, const Args&... args) {
+        uint64_t position;
+        FLogRecord* record = queue.TryClaim(position);
+        if (!record) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        record->Begin(level, category, NowNs());
+        (record->Append(args), ...);
+        queue.Publish(position);
+    }
+
+    // Blocks until everything logged so far has been written
+    void Flush();
+
+    // Sinks: console is stdout; the file sink adds timestamps, level and category
+    void SetConsoleEnabled(bool enabled);
+    bool OpenFile(const std::string& filename);
+    void CloseFile();
+
+    uint64_t GetWrittenCount() const { return written.load(std::memory_order_acquire); }
+    uint64_t GetDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+    static const char* GetLevelName(ELogLevel level);
+    static const char* GetCategoryName(ELogCategory category);
+    static std::string FormatMessage(const FLogRecord& record);
+
+private:
+    Logger();
+
+    static inline std::atomic<int> runtime_level{ NAUVOO_LOG_MIN_LEVEL };
+    static inline std::atomic<uint32_t> category_mask{ LOG_CATEGORY_ALL };
+
+    FLogQueue queue;
+    uint64_t epoch_ns;
+
+    std::mutex sink_mutex;
+    bool console_enabled = true;
+    std::FILE* file = nullptr;
+
+    std::atomic<uint64_t> written{ 0 };
+    std::atomic<uint64_t> dropped{ 0 };
+    std::atomic<bool> stopping{ false };
+    std::thread writer;
+
+    uint64_t NowNs() const;
+    void WriterLoop();
+    size_t Drain();
+};
+
+/**
+ * Temporarily changes the runtime log level (e.g. to silence per-entity chatter)
+ */
+class ScopedLogLevel {
+public:
+    explicit ScopedLogLevel(ELogLevel level) : previous(Logger::GetLevel()) { Logger::SetLevel(level); }
+    ~ScopedLogLevel() { Logger::SetLevel(previous); }
+
+    ScopedLogLevel(const ScopedLogLevel&) = delete;
+    ScopedLogLevel& operator=(const ScopedLogLevel&) = delete;
+
+private:
+    ELogLevel previous;
+};
+
+/**
+ * Discards std::cout and lowers logging to warnings while in scope (e.g. around
+ * headless runs and benchmarks); constructed disabled it leaves both alone
+ */
+class ScopedQuietConsole {
+public:
+    explicit ScopedQuietConsole(bool enabled = true)
+        : previous(enabled ? std::cout.rdbuf(nullptr) : nullptr),
+          log_level(enabled ? ELogLevel::WARNING : Logger::GetLevel()) {}
+
+    ~ScopedQuietConsole() {
+        if (!previous) return;
+        std::cout.rdbuf(previous);
+        std::cout.clear();
+    }
+
+    ScopedQuietConsole(const ScopedQuietConsole&) = delete;
+    ScopedQuietConsole& operator=(const ScopedQuietConsole&) = delete;
+
+private:
+    std::streambuf* previous;       // null when disabled or already quiet
+    ScopedLogLevel log_level;
+};
+
+}  // namespace Nauvoo
@@ -0,0 +1,245 @@
+#include "Memory.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace Nauvoo {
+
+namespace {
+
+struct FMemoryMetrics {
+    MetricCounter& arena_spills = MetricsRegistry::Get().GetCounter("memory.frame_arena_spills");
+    MetricGauge& arena_high_water = MetricsRegistry::Get().GetGauge("memory.frame_arena_high_water");
+    MetricGauge& pool_chunks = MetricsRegistry::Get().GetGauge("memory.pool_chunks");
+};
+
+FMemoryMetrics& Metrics() {
+    static FMemoryMetrics metrics;
+    return metrics;
+}
+
+std::atomic<uint64_t> allocation_count{ 0 };
+std::atomic<uint64_t> free_count{ 0 };
+std::atomic<uint64_t> allocated_bytes{ 0 };
+thread_local bool thread_tracked = true;
+
+constexpr size_t ARENA_GRANULARITY = 4096;
+
+}  // namespace
+
+// ==================== Allocation tracking ====================
+
+FAllocationStats GetAllocationStats() {
+    FAllocationStats stats;
+    stats.allocations = allocation_count.load(std::memory_order_relaxed);
+    stats.frees = free_count.load(std::memory_order_relaxed);
+    stats.bytes = allocated_bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void SetThreadAllocationsTracked(bool tracked) {
+    thread_tracked = tracked;
+}
+
+// ==================== FrameArena ====================
+
+FrameArena::FrameArena(size_t initial_capacity) {
+    Metrics();
+    capacity = std::max(initial_capacity, ARENA_GRANULARITY);
+    buffer = static_cast<std::byte*>(::operator new(capacity));
+}
+
+FrameArena::~FrameArena() {
+    Reset();
+    ::operator delete(buffer);
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(buffer);
+    size_t offset = used.load(std::memory_order_relaxed);
+    while (true) {
+        size_t start = static_cast<size_t>(((base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1)) - base);
+        size_t end = start + bytes;
+        if (end > capacity) break;
+        if (used.compare_exchange_weak(offset, end, std::memory_order_relaxed)) return buffer + start;
+    }
+
+    // Still counted in `used`, so the next Reset sizes the buffer for the whole tick
+    used.fetch_add(bytes, std::memory_order_relaxed);
+    void* block = ::operator new(bytes, std::align_val_t(alignment));
+    std::lock_guard<std::mutex> lock(spill_mutex);
+    spilled.emplace_back(block, alignment);
+    spills++;
+    Metrics().arena_spills.Add();
+    return block;
+}
+
+void FrameArena::Reset() {
+    high_water = std::max(high_water, used.load(std::memory_order_relaxed));
+    for (const auto& [block, alignment] : spilled) {
+        ::operator delete(block, std::align_val_t(alignment));
+    }
+    spilled.clear();
+
+    if (high_water > capacity) {
+        // Headroom for alignment padding the spilled sizes did not include
+        size_t grown = high_water + high_water / 4;
+        capacity = (grown + ARENA_GRANULARITY - 1) / ARENA_GRANULARITY * ARENA_GRANULARITY;
+        ::operator delete(buffer);
+        buffer = static_cast<std::byte*>(::operator new(capacity));
+    }
+    used.store(0, std::memory_order_relaxed);
+    Metrics().arena_high_water.Set(static_cast<int64_t>(high_water));
+}
+
+// ==================== FixedBlockPool ====================
+
+FixedBlockPool::FixedBlockPool(size_t requested_block_size, size_t chunk_blocks)
+    : blocks_per_chunk(std::max<size_t>(chunk_blocks, 1)) {
+    Metrics();
+    constexpr size_t ALIGN = alignof(std::max_align_t);
+    block_size = std::max(requested_block_size, sizeof(FFreeBlock));
+    block_size = (block_size + ALIGN - 1) / ALIGN * ALIGN;
+}
+
+FixedBlockPool::~FixedBlockPool() {
+    for (std::byte* chunk : chunks) ::operator delete(chunk);
+    Metrics().pool_chunks.Add(-static_cast<int64_t>(chunks.size()));
+}
+
+size_t FixedBlockPool::GetLiveBlocks() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return live_blocks;
+}
+
+size_t FixedBlockPool::GetChunkCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return chunks.size();
+}
+
+bool FixedBlockPool::Fits(size_t bytes, size_t alignment) const {
+    return bytes <= block_size && alignment <= alignof(std::max_align_t);
+}
+
+void* FixedBlockPool::do_allocate(size_t bytes, size_t alignment) {
+    if (!Fits(bytes, alignment)) return ::operator new(bytes, std::align_val_t(alignment));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!free_list) {
+        std::byte* chunk = static_cast<std::byte*>(::operator new(block_size * blocks_per_chunk));
+        chunks.push_back(chunk);
+        Metrics().pool_chunks.Add(1);
+        for (size_t i = blocks_per_chunk; i-- > 0;) {
+            FFreeBlock* block = reinterpret_cast<FFreeBlock*>(chunk + i * block_size);
+            block->next = free_list;
+            free_list = block;
+        }
+    }
+
+    FFreeBlock* block = free_list;
+    free_list = block->next;
+    live_blocks++;
+    return block;
+}
+
+void FixedBlockPool::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+    if (!Fits(bytes, alignment)) {
+        ::operator delete(pointer, std::align_val_t(alignment));
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    FFreeBlock* block = static_cast<FFreeBlock*>(pointer);
+    block->next = free_list;
+    free_list = block;
+    live_blocks--;
+}
+
+}  // namespace Nauvoo
+
+// ==================== Global operator new/delete ====================
+
+#if NAUVOO_ALLOCATION_TRACKING
+
+namespace {
+
+inline void CountAllocation(size_t bytes) {
+    if (!Nauvoo::thread_tracked) return;
+    Nauvoo::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    Nauvoo::allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+inline void CountFree(void* pointer) {
+    if (pointer && Nauvoo::thread_tracked) Nauvoo::free_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* TrackedAllocate(size_t bytes) {
+    CountAllocation(bytes);
+    if (void* pointer = std::malloc(bytes ? bytes : 1)) return pointer;
+    throw std::bad_alloc();
+}
+
+void* TrackedAllocateAligned(size_t bytes, std::align_val_t alignment) {
+    CountAllocation(bytes);
+    size_t align = static_cast<size_t>(alignment);
+#ifdef _MSC_VER
+    void* pointer = _aligned_malloc(bytes ? bytes : 1, align);
+#else
+    // aligned_alloc wants the size to be a multiple of the alignment
+    size_t rounded = ((bytes ? bytes : 1) + align - 1) / align * align;
+    void* pointer = std::aligned_alloc(align, rounded);
+#endif
+    if (pointer) return pointer;
+    throw std::bad_alloc();
+}
+
+void TrackedFree(void* pointer) {
+    CountFree(pointer);
+    std::free(pointer);
+}
+
+void TrackedFreeAligned(void* pointer) {
+    CountFree(pointer);
+#ifdef _MSC_VER
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+}
+
+}  // namespace
+
+void* operator new(size_t bytes) { return TrackedAllocate(bytes); }
+void* operator new[](size_t bytes) { return TrackedAllocate(bytes); }
+void* operator new(size_t bytes, std::align_val_t alignment) { return TrackedAllocateAligned(bytes, alignment); }
+void* operator new[](size_t bytes, std::align_val_t alignment) { return TrackedAllocateAligned(bytes, alignment); }
+
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept {
+    try { return TrackedAllocate(bytes); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept {
+    try { return TrackedAllocate(bytes); } catch (...) { return nullptr; }
+}
+void* operator new(size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try { return TrackedAllocateAligned(bytes, alignment); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try { return TrackedAllocateAligned(bytes, alignment); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { TrackedFree(pointer); }
+
+void operator delete(void* pointer, std::align_val_t) noexcept { TrackedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { TrackedFreeAligned(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { TrackedFreeAligned(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { TrackedFreeAligned(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFreeAligned(pointer); }
+
+#endif
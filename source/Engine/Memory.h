@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+// Heap allocations are counted through replaced global operator new/delete.
+// Define NAUVOO_ALLOCATION_TRACKING=0 (CMake: -DNAUVOO_TRACK_ALLOCATIONS=OFF) to keep the library's.
+#ifndef NAUVOO_ALLOCATION_TRACKING
+  #define NAUVOO_ALLOCATION_TRACKING 1
+#endif
+
+namespace Nauvoo {
+
+// ==================== ALLOCATION TRACKING ====================
+
+struct FAllocationStats {
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t bytes = 0;         // requested by allocations; frees are not sized
+};
+
+// Heap traffic since startup from every tracked thread; zero when tracking is compiled out
+FAllocationStats GetAllocationStats();
+constexpr bool IsAllocationTrackingEnabled() { return NAUVOO_ALLOCATION_TRACKING != 0; }
+// Background threads that are not part of the simulation (the log writer) opt out
+void SetThreadAllocationsTracked(bool tracked);
+
+// ==================== FRAME ARENA ====================
+
+/**
+ * Linear allocator for data that lives for one tick. Allocation bumps an
+ * atomic offset, so systems running in parallel can share it; deallocation
+ * does nothing and Reset rewinds everything at once. A tick that outgrows
+ * the buffer spills to the heap, and the next Reset grows the buffer to the
+ * high-water mark so the spill does not repeat.
+ *
+ * Reset must not overlap allocations; GameManager resets before each tick.
+ */
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void Reset();
+
+    size_t GetUsed() const { return used.load(std::memory_order_relaxed); }
+    size_t GetCapacity() const { return capacity; }
+    size_t GetHighWater() const { return high_water; }
+    uint64_t GetSpillCount() const { return spills; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    std::byte* buffer = nullptr;
+    size_t capacity = 0;
+    std::atomic<size_t> used{ 0 };      // bytes claimed this tick, spills included
+    size_t high_water = 0;
+
+    std::mutex spill_mutex;
+    std::vector<std::pair<void*, size_t>> spilled;  // (block, alignment) freed at Reset
+    uint64_t spills = 0;
+};
+
+// ==================== FIXED BLOCK POOL ====================
+
+/**
+ * Hands out blocks of one size from chunks that are never returned to the
+ * heap, recycling freed blocks through a free list. Requests larger than the
+ * block go to the heap. Usable as a pmr resource or through TPoolAllocator.
+ */
+class FixedBlockPool : public std::pmr::memory_resource {
+public:
+    FixedBlockPool(size_t block_size, size_t blocks_per_chunk);
+    ~FixedBlockPool() override;
+
+    FixedBlockPool(const FixedBlockPool&) = delete;
+    FixedBlockPool& operator=(const FixedBlockPool&) = delete;
+
+    size_t GetBlockSize() const { return block_size; }
+    size_t GetLiveBlocks() const;
+    size_t GetChunkCount() const;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    struct FFreeBlock {
+        FFreeBlock* next;
+    };
+
+    size_t block_size;
+    size_t blocks_per_chunk;
+
+    mutable std::mutex mutex;
+    FFreeBlock* free_list = nullptr;
+    std::vector<std::byte*> chunks;
+    size_t live_blocks = 0;
+
+    bool Fits(size_t bytes, size_t alignment) const;
+};
+
+/**
+ * Stateless allocator over one process-wide FixedBlockPool per element type.
+ * A container of up to BLOCK_ELEMENTS elements lives in a single pooled
+ * block however it grew, so adding and removing elements stops touching the
+ * heap once the pool has warmed up. Copies of a container stay pooled.
+ */
+template <typename T, size_t BLOCK_ELEMENTS>
+class TPoolAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = TPoolAllocator<U, BLOCK_ELEMENTS>;
+    };
+
+    TPoolAllocator() = default;
+    template <typename U>
+    TPoolAllocator(const TPoolAllocator<U, BLOCK_ELEMENTS>&) {}
+
+    T* allocate(size_t count) { return static_cast<T*>(GetPool().allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T* pointer, size_t count) { GetPool().deallocate(pointer, count * sizeof(T), alignof(T)); }
+
+    static FixedBlockPool& GetPool() {
+        // Never destroyed: containers in static storage may free into it during exit
+        static FixedBlockPool* pool = new FixedBlockPool(sizeof(T) * BLOCK_ELEMENTS, 256);
+        return *pool;
+    }
+
+    template <typename U>
+    bool operator==(const TPoolAllocator<U, BLOCK_ELEMENTS>&) const { return true; }
+    template <typename U>
+    bool operator!=(const TPoolAllocator<U, BLOCK_ELEMENTS>&) const { return false; }
+};
+
+}  // namespace Nauvoo
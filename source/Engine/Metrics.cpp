@@ -0,0 +1,208 @@
+#include "Metrics.h"
+#include <iomanip>
+#include <sstream>
+
+namespace Nauvoo {
+
+namespace {
+
+int HighestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int bit = 0;
+    while (value >>= 1) bit++;
+    return bit;
+#endif
+}
+
+}  // namespace
+
+// ==================== MetricHistogram ====================
+
+size_t MetricHistogram::BucketIndex(uint64_t value) {
+    if (value < static_cast<uint64_t>(SUB_BUCKETS)) {
+        return static_cast<size_t>(value);
+    }
+
+    // The top SUB_BUCKET_BITS + 1 bits pick the bucket; lower bits are the resolution lost
+    int shift = HighestBit(value) - SUB_BUCKET_BITS;
+    uint64_t sub_bucket = (value >> shift) - SUB_BUCKETS;
+    return static_cast<size_t>(shift + 1) * SUB_BUCKETS + static_cast<size_t>(sub_bucket);
+}
+
+uint64_t MetricHistogram::BucketUpperBound(size_t index) {
+    if (index < static_cast<size_t>(SUB_BUCKETS)) {
+        return index;
+    }
+
+    int shift = static_cast<int>(index / SUB_BUCKETS) - 1;
+    uint64_t sub_bucket = index % SUB_BUCKETS;
+    uint64_t lower = (SUB_BUCKETS + sub_bucket) << shift;
+    return lower + ((uint64_t{ 1 } << shift) - 1);
+}
+
+void MetricHistogram::Record(uint64_t value) {
+    buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current = max_value.load(std::memory_order_relaxed);
+    while (value > current
+           && !max_value.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+double MetricHistogram::GetMean() const {
+    uint64_t samples = GetCount();
+    return samples ? static_cast<double>(sum.load(std::memory_order_relaxed)) / samples : 0.0;
+}
+
+uint64_t MetricHistogram::GetPercentile(double percentile) const {
+    uint64_t samples = GetCount();
+    if (samples == 0) return 0;
+
+    uint64_t target = static_cast<uint64_t>(percentile / 100.0 * samples + 0.5);
+    if (target < 1) target = 1;
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            uint64_t bound = BucketUpperBound(i);
+            uint64_t max_seen = GetMax();
+            return bound < max_seen ? bound : max_seen;
+        }
+    }
+    return GetMax();
+}
+
+void MetricHistogram::Reset() {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    max_value.store(0, std::memory_order_relaxed);
+}
+
+// ==================== MetricsRegistry ====================
+
+MetricsRegistry& MetricsRegistry::Get() {
+    static MetricsRegistry instance;
+    return instance;
+}
+
+MetricsRegistry::~MetricsRegistry() {
+    CloseSnapshotFile();
+}
+
+MetricCounter& MetricsRegistry::GetCounter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& slot = counters[name];
+    if (!slot) slot = std::make_unique<MetricCounter>();
+    return *slot;
+}
+
+MetricGauge& MetricsRegistry::GetGauge(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& slot = gauges[name];
+    if (!slot) slot = std::make_unique<MetricGauge>();
+    return *slot;
+}
+
+MetricHistogram& MetricsRegistry::GetHistogram(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& slot = histograms[name];
+    if (!slot) slot = std::make_unique<MetricHistogram>();
+    return *slot;
+}
+
+void MetricsRegistry::ResetAll() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& [name, counter] : counters) counter->Reset();
+    for (auto& [name, gauge] : gauges) gauge->Reset();
+    for (auto& [name, histogram] : histograms) histogram->Reset();
+    counter_values_at_last_snapshot.clear();
+}
+
+std::string MetricsRegistry::BuildSnapshotJson(const std::string& label, uint64_t tick) {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(2);
+
+    out << "{\"label\":\"" << label << "\",\"tick\":" << tick << ",\"counters\":{";
+    bool first = true;
+    for (const auto& [name, counter] : counters) {
+        uint64_t value = counter->Get();
+        uint64_t& previous = counter_values_at_last_snapshot[name];
+        out << (first ? "" : ",") << "\"" << name << "\":{\"value\":" << value
+            << ",\"delta\":" << value - previous << "}";
+        previous = value;
+        first = false;
+    }
+
+    out << "},\"gauges\":{";
+    first = true;
+    for (const auto& [name, gauge] : gauges) {
+        out << (first ? "" : ",") << "\"" << name << "\":" << gauge->Get();
+        first = false;
+    }
+
+    out << "},\"histograms\":{";
+    first = true;
+    for (const auto& [name, histogram] : histograms) {
+        out << (first ? "" : ",") << "\"" << name << "\":{"
+            << "\"count\":" << histogram->GetCount()
+            << ",\"mean\":" << histogram->GetMean()
+            << ",\"p50\":" << histogram->GetPercentile(50.0)
+            << ",\"p90\":" << histogram->GetPercentile(90.0)
+            << ",\"p99\":" << histogram->GetPercentile(99.0)
+            << ",\"max\":" << histogram->GetMax() << "}";
+        first = false;
+    }
+    out << "}}";
+
+    return out.str();
+}
+
+bool MetricsRegistry::OpenSnapshotFile(const std::string& filename) {
+    CloseSnapshotFile();
+    snapshot_file = std::fopen(filename.c_str(), "w");
+    return snapshot_file != nullptr;
+}
+
+void MetricsRegistry::CloseSnapshotFile() {
+    if (snapshot_file) {
+        std::fclose(snapshot_file);
+        snapshot_file = nullptr;
+    }
+}
+
+void MetricsRegistry::WriteSnapshot(const std::string& label, uint64_t tick) {
+    if (!snapshot_file) return;
+
+    std::string line = BuildSnapshotJson(label, tick);
+    line += '\n';
+    std::fwrite(line.data(), 1, line.size(), snapshot_file);
+    std::fflush(snapshot_file);
+}
+
+void MetricsRegistry::Print(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    out << "\n=== METRICS ===" << std::endl;
+    for (const auto& [name, counter] : counters) {
+        out << "  " << std::left << std::setw(34) << name << std::right << counter->Get() << std::endl;
+    }
+    for (const auto& [name, gauge] : gauges) {
+        out << "  " << std::left << std::setw(34) << name << std::right << gauge->Get() << std::endl;
+    }
+    for (const auto& [name, histogram] : histograms) {
+        out << "  " << std::left << std::setw(34) << name << std::right
+            << "n=" << histogram->GetCount()
+            << " p50=" << histogram->GetPercentile(50.0)
+            << " p99=" << histogram->GetPercentile(99.0)
+            << " max=" << histogram->GetMax() << std::endl;
+    }
+}
+
+}  // namespace Nauvoo
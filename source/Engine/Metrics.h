@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace Nauvoo {
+
+/**
+ * Monotonic event count (actions recorded, bytes written, ...)
+ */
+class MetricCounter {
+public:
+    void Add(uint64_t amount = 1) { value.fetch_add(amount, std::memory_order_relaxed); }
+    uint64_t Get() const { return value.load(std::memory_order_relaxed); }
+    void Reset() { value.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value{ 0 };
+};
+
+/**
+ * Point-in-time level (active dialogues, bleeding injuries, ...)
+ */
+class MetricGauge {
+public:
+    void Set(int64_t new_value) { value.store(new_value, std::memory_order_relaxed); }
+    void Add(int64_t delta) { value.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t Get() const { return value.load(std::memory_order_relaxed); }
+    void Reset() { value.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value{ 0 };
+};
+
+/**
+ * HDR-style log-linear histogram of non-negative integers. Each power of two is
+ * split into SUB_BUCKETS linear buckets, so percentiles are within 1/SUB_BUCKETS
+ * of the true value across the full 64-bit range with a fixed ~8 KB footprint.
+ */
+class MetricHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 4;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    void Record(uint64_t value);
+
+    uint64_t GetCount() const { return count.load(std::memory_order_relaxed); }
+    uint64_t GetMax() const { return max_value.load(std::memory_order_relaxed); }
+    double GetMean() const;
+    // Highest value equivalent to the requested percentile (0..100)
+    uint64_t GetPercentile(double percentile) const;
+    void Reset();
+
+    static size_t BucketIndex(uint64_t value);
+    static uint64_t BucketUpperBound(size_t index);
+
+private:
+    std::atomic<uint64_t> buckets[BUCKET_COUNT] = {};
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> sum{ 0 };
+    std::atomic<uint64_t> max_value{ 0 };
+};
+
+/**
+ * Process-wide named metrics. Managers look their metrics up once at construction
+ * and update them lock-free; snapshots and the live view read them by name.
+ */
+class MetricsRegistry {
+public:
+    static MetricsRegistry& Get();
+    ~MetricsRegistry();
+
+    // Returns the existing metric when the name is already registered
+    MetricCounter& GetCounter(const std::string& name);
+    MetricGauge& GetGauge(const std::string& name);
+    MetricHistogram& GetHistogram(const std::string& name);
+
+    void ResetAll();
+
+    // One JSON object: counters (with delta since the previous snapshot), gauges, histogram summaries
+    std::string BuildSnapshotJson(const std::string& label, uint64_t tick);
+
+    // Periodic dumps append one snapshot per line (JSON Lines)
+    bool OpenSnapshotFile(const std::string& filename);
+    void CloseSnapshotFile();
+    bool IsSnapshotFileOpen() const { return snapshot_file != nullptr; }
+    void WriteSnapshot(const std::string& label, uint64_t tick);
+
+    void Print(std::ostream& out) const;
+
+private:
+    MetricsRegistry() = default;
+
+    mutable std::mutex mutex;
+    std::map<std::string, std::unique_ptr<MetricCounter>> counters;
+    std::map<std::string, std::unique_ptr<MetricGauge>> gauges;
+    std::map<std::string, std::unique_ptr<MetricHistogram>> histograms;
+    std::map<std::string, uint64_t> counter_values_at_last_snapshot;
+
+    std::FILE* snapshot_file = nullptr;
+};
+
+}  // namespace Nauvoo
@@ -0,0 +1,188 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace Nauvoo {
+
+namespace {
+
+uint64_t SteadyNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void WriteJsonString(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+}  // namespace
+
+Profiler& Profiler::Get() {
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler() : epoch_ns(SteadyNs()) {
+}
+
+uint64_t Profiler::NowNs() const {
+    return SteadyNs() - epoch_ns;
+}
+
+FProfileRing& Profiler::GetThreadRing() {
+    // Rings are owned by the profiler so events survive their thread exiting
+    thread_local FProfileRing* ring = nullptr;
+    if (!ring) {
+        std::lock_guard<std::mutex> lock(rings_mutex);
+        rings.push_back(std::make_unique<FProfileRing>(static_cast<uint32_t>(rings.size())));
+        ring = rings.back().get();
+    }
+    return *ring;
+}
+
+size_t Profiler::FindOrAddZone(const char* name) {
+    auto pointer_it = zone_by_pointer.find(name);
+    if (pointer_it != zone_by_pointer.end()) return pointer_it->second;
+
+    // The same literal may have different addresses across translation units
+    auto name_it = zone_by_name.find(name);
+    size_t index;
+    if (name_it != zone_by_name.end()) {
+        index = name_it->second;
+    } else {
+        index = zones.size();
+        FZoneWindow zone;
+        zone.name = name;
+        zone.samples_ns.reserve(WINDOW_SIZE);
+        zones.push_back(std::move(zone));
+        zone_by_name.emplace(name, index);
+    }
+
+    zone_by_pointer.emplace(name, index);
+    return index;
+}
+
+void Profiler::EndFrame() {
+    std::lock_guard<std::mutex> lock(rings_mutex);
+
+    for (auto& ring : rings) {
+        uint32_t thread_index = ring->GetThreadIndex();
+        ring->Drain([&](const FProfileEvent& event) {
+            FZoneWindow& zone = zones[FindOrAddZone(event.name)];
+            uint64_t duration = event.end_ns - event.start_ns;
+            uint32_t sample = static_cast<uint32_t>(std::min<uint64_t>(duration, UINT32_MAX));
+
+            if (zone.samples_ns.size() < WINDOW_SIZE) {
+                zone.samples_ns.push_back(sample);
+            } else {
+                zone.samples_ns[zone.next_sample] = sample;
+            }
+            zone.next_sample = (zone.next_sample + 1) % WINDOW_SIZE;
+            zone.count++;
+
+            if (capturing_trace) {
+                trace_events.push_back({ event, thread_index });
+            }
+        });
+    }
+}
+
+FZoneStats Profiler::ComputeStats(const FZoneWindow& zone) const {
+    FZoneStats stats;
+    stats.name = zone.name;
+    stats.count = zone.count;
+    if (zone.samples_ns.empty()) return stats;
+
+    std::vector<uint32_t> sorted = zone.samples_ns;
+    std::sort(sorted.begin(), sorted.end());
+
+    double total = 0.0;
+    for (uint32_t sample : sorted) total += sample;
+
+    auto percentile = [&](double p) {
+        size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[index] / 1000.0;
+    };
+
+    stats.mean_us = total / static_cast<double>(sorted.size()) / 1000.0;
+    stats.p50_us = percentile(0.50);
+    stats.p99_us = percentile(0.99);
+    stats.max_us = sorted.back() / 1000.0;
+    return stats;
+}
+
+std::vector<FZoneStats> Profiler::GetAllZoneStats() const {
+    std::vector<FZoneStats> result;
+    result.reserve(zones.size());
+    for (const FZoneWindow& zone : zones) {
+        result.push_back(ComputeStats(zone));
+    }
+    return result;
+}
+
+bool Profiler::GetZoneStats(const std::string& name, FZoneStats& stats) const {
+    auto it = zone_by_name.find(name);
+    if (it == zone_by_name.end()) return false;
+
+    stats = ComputeStats(zones[it->second]);
+    return true;
+}
+
+void Profiler::ResetStats() {
+    for (FZoneWindow& zone : zones) {
+        zone.samples_ns.clear();
+        zone.next_sample = 0;
+        zone.count = 0;
+    }
+}
+
+void Profiler::PrintStats() const {
+    std::cout << "\n[Profiler] Zone timings (last " << WINDOW_SIZE << " samples, microseconds):" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    for (const FZoneStats& stats : GetAllZoneStats()) {
+        std::cout << "  " << std::left << std::setw(28) << stats.name << std::right
+                  << " p50 " << std::setw(10) << stats.p50_us
+                  << "  p99 " << std::setw(10) << stats.p99_us
+                  << "  max " << std::setw(10) << stats.max_us
+                  << "  (" << stats.count << " samples)" << std::endl;
+    }
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+}
+
+void Profiler::BeginTraceCapture() {
+    trace_events.clear();
+    capturing_trace = true;
+}
+
+bool Profiler::WriteChromeTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) return false;
+
+    // Complete ("X") events with microsecond timestamps, as chrome://tracing expects
+    file << "{\"traceEvents\":[";
+    file << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < trace_events.size(); ++i) {
+        const FTraceEvent& trace = trace_events[i];
+        if (i > 0) file << ",";
+        file << "\n{\"name\":";
+        WriteJsonString(file, trace.event.name);
+        file << ",\"cat\":\"nauvoo\",\"ph\":\"X\",\"pid\":1"
+             << ",\"tid\":" << trace.thread_index
+             << ",\"ts\":" << trace.event.start_ns / 1000.0
+             << ",\"dur\":" << (trace.event.end_ns - trace.event.start_ns) / 1000.0 << "}";
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return file.good();
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Profiler zones are compiled in for debug builds and out for release builds.
+// Define NAUVOO_PROFILING=1 (CMake: -DNAUVOO_FORCE_PROFILER=ON) to keep them in release.
+#ifndef NAUVOO_PROFILING
+  #ifdef NDEBUG
+    #define NAUVOO_PROFILING 0
+  #else
+    #define NAUVOO_PROFILING 1
+  #endif
+#endif
+
+#define NAUVOO_PROFILE_CONCAT_INNER(a, b) a##b
+#define NAUVOO_PROFILE_CONCAT(a, b) NAUVOO_PROFILE_CONCAT_INNER(a, b)
+
+#if NAUVOO_PROFILING
+  // Times the enclosing scope; name must be a string literal
+  #define NAUVOO_PROFILE_ZONE(name) ::Nauvoo::ProfileZone NAUVOO_PROFILE_CONCAT(profile_zone_, __LINE__)(name)
+  // Drains per-thread buffers into rolling statistics; call once per frame
+  #define NAUVOO_PROFILE_FRAME() ::Nauvoo::Profiler::Get().EndFrame()
+#else
+  #define NAUVOO_PROFILE_ZONE(name) ((void)0)
+  #define NAUVOO_PROFILE_FRAME() ((void)0)
+#endif
+
+namespace Nauvoo {
+
+struct FProfileEvent {
+    const char* name = nullptr;
+    uint64_t start_ns = 0;
+    uint64_t end_ns = 0;
+};
+
+/**
+ * Single-producer/single-consumer ring of completed zones for one thread.
+ * The owning thread writes; Profiler::EndFrame drains. No locks on either side.
+ */
+class FProfileRing {
+public:
+    static constexpr uint64_t CAPACITY = 1 << 14;
+
+    explicit FProfileRing(uint32_t thread_index) : thread_index(thread_index) {}
+
+    void Push(const FProfileEvent& event) {
+        uint64_t head_value = head.load(std::memory_order_relaxed);
+        if (head_value - tail.load(std::memory_order_acquire) >= CAPACITY) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        events[head_value & (CAPACITY - 1)] = event;
+        head.store(head_value + 1, std::memory_order_release);
+    }
+
+    template <typename Fn>
+    void Drain(Fn&& consume) {
+        uint64_t tail_value = tail.load(std::memory_order_relaxed);
+        uint64_t head_value = head.load(std::memory_order_acquire);
+        for (; tail_value != head_value; ++tail_value) {
+            consume(events[tail_value & (CAPACITY - 1)]);
+        }
+        tail.store(tail_value, std::memory_order_release);
+    }
+
+    uint32_t GetThreadIndex() const { return thread_index; }
+    uint64_t GetDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    uint32_t thread_index;
+    std::atomic<uint64_t> head{ 0 };
+    std::atomic<uint64_t> tail{ 0 };
+    std::atomic<uint64_t> dropped{ 0 };
+    FProfileEvent events[CAPACITY];
+};
+
+struct FZoneStats {
+    std::string name;
+    uint64_t count = 0;             // total samples seen
+    double mean_us = 0.0;           // over the rolling window
+    double p50_us = 0.0;
+    double p99_us = 0.0;
+    double max_us = 0.0;
+};
+
+/**
+ * Collects scoped zone timings from every thread, keeps per-zone rolling
+ * statistics and exports Chrome trace-event JSON (chrome://tracing, Perfetto)
+ */
+class Profiler {
+public:
+    static constexpr size_t WINDOW_SIZE = 512;     // samples kept per zone for percentiles
+
+    static Profiler& Get();
+
+    // Nanoseconds since the profiler was created
+    uint64_t NowNs() const;
+
+    // Current thread's ring, registered on first use
+    FProfileRing& GetThreadRing();
+
+    void EndFrame();
+
+    // Rolling statistics
+    std::vector<FZoneStats> GetAllZoneStats() const;
+    bool GetZoneStats(const std::string& name, FZoneStats& stats) const;
+    void ResetStats();
+    void PrintStats() const;
+
+    // Trace capture between Begin/End is kept in memory until written
+    void BeginTraceCapture();
+    void EndTraceCapture() { capturing_trace = false; }
+    bool WriteChromeTrace(const std::string& filename) const;
+    size_t GetCapturedEventCount() const { return trace_events.size(); }
+
+private:
+    Profiler();
+
+    struct FZoneWindow {
+        std::string name;
+        uint64_t count = 0;
+        std::vector<uint32_t> samples_ns;   // ring of the last WINDOW_SIZE durations
+        size_t next_sample = 0;
+    };
+
+    struct FTraceEvent {
+        FProfileEvent event;
+        uint32_t thread_index;
+    };
+
+    uint64_t epoch_ns;
+
+    std::mutex rings_mutex;
+    std::vector<std::unique_ptr<FProfileRing>> rings;
+
+    std::vector<FZoneWindow> zones;
+    std::unordered_map<const char*, size_t> zone_by_pointer;
+    std::unordered_map<std::string, size_t> zone_by_name;
+
+    bool capturing_trace = false;
+    std::vector<FTraceEvent> trace_events;
+
+    size_t FindOrAddZone(const char* name);
+    FZoneStats ComputeStats(const FZoneWindow& zone) const;
+};
+
+/**
+ * RAII zone; prefer the NAUVOO_PROFILE_ZONE macro so release builds compile it out
+ */
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* zone_name)
+        : name(zone_name), start_ns(Profiler::Get().NowNs()) {}
+
+    ~ProfileZone() {
+        Profiler& profiler = Profiler::Get();
+        profiler.GetThreadRing().Push({ name, start_ns, profiler.NowNs() });
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name;
+    uint64_t start_ns;
+};
+
+}  // namespace Nauvoo
@@ -0,0 +1,105 @@
+#include "Random.h"
+
+namespace Nauvoo {
+
+namespace {
+
+uint64_t SplitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+uint64_t Mix(uint64_t value) {
+    uint64_t x = value;
+    return SplitMix64(x);
+}
+
+constexpr size_t STREAM_COUNT = static_cast<size_t>(ERandomStream::COUNT);
+
+}  // namespace
+
+// ==================== FRandomStream ====================
+
+void FRandomStream::Seed(uint64_t seed) {
+    uint64_t x = seed;
+    for (uint64_t& word : state) {
+        word = SplitMix64(x);
+    }
+}
+
+void FRandomStream::FillUniform(float* out, size_t count) {
+    const float scale = 1.0f / 16777216.0f;
+    size_t i = 0;
+
+    // Two 24-bit uniforms per 64-bit draw
+    for (; i + 1 < count; i += 2) {
+        uint64_t bits = NextU64();
+        out[i] = static_cast<float>(bits >> 40) * scale;
+        out[i + 1] = static_cast<float>((bits >> 8) & 0xFFFFFF) * scale;
+    }
+    if (i < count) {
+        out[i] = NextFloat();
+    }
+}
+
+void FRandomStream::GetState(uint64_t out_state[4]) const {
+    for (int i = 0; i < 4; ++i) out_state[i] = state[i];
+}
+
+void FRandomStream::SetState(const uint64_t in_state[4]) {
+    for (int i = 0; i < 4; ++i) state[i] = in_state[i];
+}
+
+// ==================== RandomService ====================
+
+RandomService::RandomService(uint64_t world_seed) {
+    SetWorldSeed(world_seed);
+}
+
+void RandomService::SetWorldSeed(uint64_t seed) {
+    world_seed = seed;
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        system_streams[i].Seed(Mix(world_seed ^ Mix(i + 1)));
+    }
+}
+
+FRandomStream RandomService::DeriveStream(ERandomStream system, uint64_t key, uint64_t counter) const {
+    uint64_t seed = world_seed;
+    seed = Mix(seed ^ (static_cast<uint64_t>(system) + 1));
+    seed = Mix(seed ^ key);
+    seed = Mix(seed ^ counter);
+    return FRandomStream(seed);
+}
+
+uint64_t RandomService::HashKey(const std::string& id) {
+    uint64_t hash = 14695981039346656037ull;  // FNV-1a 64
+    for (char c : id) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::vector<uint64_t> RandomService::SaveState() const {
+    std::vector<uint64_t> stream_states(STREAM_COUNT * 4);
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        system_streams[i].GetState(&stream_states[i * 4]);
+    }
+    return stream_states;
+}
+
+bool RandomService::RestoreState(uint64_t seed, const std::vector<uint64_t>& stream_states) {
+    SetWorldSeed(seed);
+    if (stream_states.size() != STREAM_COUNT * 4) {
+        return false;  // streams restart from the seed
+    }
+
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        system_streams[i].SetState(&stream_states[i * 4]);
+    }
+    return true;
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Nauvoo {
+
+// Independent sequential streams, one per simulation system
+enum class ERandomStream : uint32_t {
+    COMBAT,
+    AI,
+    SCHEDULE,
+    DIALOGUE,
+    WORLD,
+    COUNT
+};
+
+/**
+ * xoshiro256** generator. Small, fast and fully deterministic across platforms.
+ */
+class FRandomStream {
+public:
+    FRandomStream() { Seed(0); }
+    explicit FRandomStream(uint64_t seed) { Seed(seed); }
+
+    void Seed(uint64_t seed);
+
+    uint64_t NextU64() {
+        const uint64_t result = Rotl(state[1] * 5, 7) * 9;
+        const uint64_t t = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = Rotl(state[3], 45);
+        return result;
+    }
+
+    uint32_t NextU32() { return static_cast<uint32_t>(NextU64() >> 32); }
+
+    // Uniform in [0, 1) with 24 bits of precision
+    float NextFloat() { return static_cast<float>(NextU64() >> 40) * (1.0f / 16777216.0f); }
+
+    // Uniform integer in [min_value, max_value]
+    int NextInt(int min_value, int max_value) {
+        uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max_value) - min_value) + 1;
+        return min_value + static_cast<int>(((NextU64() >> 32) * range) >> 32);
+    }
+
+    bool Chance(float probability) { return NextFloat() < probability; }
+
+    // Batch draws for vectorized combat and AI rolls
+    void FillUniform(float* out, size_t count);
+    void FillUniform(std::vector<float>& out, size_t count) { out.resize(count); FillUniform(out.data(), count); }
+
+    // Raw state for save games
+    void GetState(uint64_t out_state[4]) const;
+    void SetState(const uint64_t in_state[4]);
+
+private:
+    uint64_t state[4];
+
+    static uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+/**
+ * Engine-wide random number service.
+ * Every stream is derived from a single world seed so that simulation
+ * outcomes are reproducible from the seed plus player inputs.
+ */
+class RandomService {
+public:
+    static constexpr uint64_t DEFAULT_WORLD_SEED = 0x4E4155564F4F1841ull;
+
+    explicit RandomService(uint64_t world_seed = DEFAULT_WORLD_SEED);
+
+    // Reseeds every system stream
+    void SetWorldSeed(uint64_t seed);
+    uint64_t GetWorldSeed() const { return world_seed; }
+
+    // Sequential per-system stream (single-threaded callers)
+    FRandomStream& GetStream(ERandomStream system) { return system_streams[static_cast<size_t>(system)]; }
+
+    // Stateless keyed stream, e.g. per NPC and per tick. Safe to call from any thread.
+    FRandomStream DeriveStream(ERandomStream system, uint64_t key, uint64_t counter = 0) const;
+
+    // Stable 64-bit key for string ids (NPC ids etc.)
+    static uint64_t HashKey(const std::string& id);
+
+    // Save/restore of seed and stream positions
+    std::vector<uint64_t> SaveState() const;
+    bool RestoreState(uint64_t seed, const std::vector<uint64_t>& stream_states);
+
+private:
+    uint64_t world_seed;
+    FRandomStream system_streams[static_cast<size_t>(ERandomStream::COUNT)];
+};
+
+}  // namespace Nauvoo
@@ -0,0 +1,317 @@
+#include "ReplaySystem.h"
+#include "GameManager.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "SimulationLOD.h"
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Nauvoo {
+
+namespace {
+
+uint32_t FloatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsToFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+}  // namespace
+
+// ==================== ReplayRecorder ====================
+
+void ReplayRecorder::Begin(const FReplayHeader& replay_header) {
+    header = replay_header;
+    events = FSaveWriter();
+    string_ids.clear();
+    last_tick = 0;
+    event_count = 0;
+    is_recording = true;
+}
+
+void ReplayRecorder::PutId(const std::string& id) {
+    // Known ids are written as (index << 1); first occurrences as (index << 1) | 1 followed by the text
+    auto it = string_ids.find(id);
+    if (it != string_ids.end()) {
+        events.PutVarint(static_cast<uint64_t>(it->second) << 1);
+        return;
+    }
+
+    uint32_t index = static_cast<uint32_t>(string_ids.size());
+    string_ids.emplace(id, index);
+    events.PutVarint((static_cast<uint64_t>(index) << 1) | 1);
+    events.PutString(id);
+}
+
+void ReplayRecorder::Record(const FReplayEvent& event) {
+    if (!is_recording) return;
+
+    events.PutU8(static_cast<uint8_t>(event.type));
+    events.PutVarint(event.tick - last_tick);
+    last_tick = event.tick;
+
+    switch (event.type) {
+        case EReplayEvent::DELTA_TIME:
+            events.PutU32(FloatBits(event.delta_time));
+            break;
+        case EReplayEvent::ADVANCE_TIME:
+        case EReplayEvent::SELECT_CHOICE:
+            events.PutZigZag(event.value);
+            break;
+        case EReplayEvent::PLAYER_ACTION:
+        case EReplayEvent::START_DIALOGUE:
+        case EReplayEvent::INITIATE_COMBAT:
+            PutId(event.id);
+            break;
+        case EReplayEvent::FIRE_WEAPON:
+            PutId(event.id);
+            events.PutU32(FloatBits(event.position.x));
+            events.PutU32(FloatBits(event.position.y));
+            events.PutU32(FloatBits(event.position.z));
+            break;
+        case EReplayEvent::CHECKPOINT:
+            events.PutVarint(event.state_hash);
+            break;
+        case EReplayEvent::END_DIALOGUE:
+        case EReplayEvent::END_COMBAT:
+            break;
+    }
+
+    event_count++;
+}
+
+std::string ReplayRecorder::Finish(uint64_t total_ticks) {
+    is_recording = false;
+    header.total_ticks = total_ticks;
+
+    FSaveWriter raw;
+    raw.PutVarint(header.world_seed);
+    raw.PutVarint(header.rng_stream_states.size());
+    for (uint64_t word : header.rng_stream_states) raw.PutVarint(word);
+    raw.PutZigZag(header.start_time.year);
+    raw.PutZigZag(header.start_time.month);
+    raw.PutZigZag(header.start_time.day);
+    raw.PutZigZag(header.start_time.minute);
+    raw.PutU32(FloatBits(header.time_scale));
+    raw.PutVarint(header.npc_count);
+    raw.PutVarint(header.initial_state_hash);
+    raw.PutVarint(header.total_ticks);
+    raw.PutVarint(event_count);
+    raw.GetBuffer() += events.GetBuffer();
+
+    const ISaveCodec* codec = GetSaveCodec(ESaveCodec::LZ);
+    std::string encoded;
+    codec->Encode(raw.GetBuffer(), encoded);
+
+    FSaveFileHeader file_header;
+    file_header.codec = codec->GetId();
+    file_header.raw_size = static_cast<uint32_t>(raw.GetBuffer().size());
+    file_header.encoded_size = static_cast<uint32_t>(encoded.size());
+    file_header.checksum = ComputeSaveChecksum(raw.GetBuffer());
+
+    std::string stream;
+    file_header.Write(stream);
+    stream += encoded;
+    return stream;
+}
+
+bool ReplayRecorder::FinishToFile(const std::string& filename, uint64_t total_ticks) {
+    std::string stream = Finish(total_ticks);
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    file.write(stream.data(), static_cast<std::streamsize>(stream.size()));
+    return file.good();
+}
+
+// ==================== ReplayPlayer ====================
+
+bool ReplayPlayer::Load(const std::string& stream) {
+    header = FReplayHeader();
+    events.clear();
+
+    FSaveFileHeader file_header;
+    if (file_header.Read(stream) != ESaveHeaderStatus::VALID
+        || stream.size() - FSaveFileHeader::SIZE != file_header.encoded_size) {
+        return false;
+    }
+
+    const ISaveCodec* codec = GetSaveCodec(file_header.codec);
+    std::string raw;
+    if (!codec || !codec->Decode(stream.substr(FSaveFileHeader::SIZE), file_header.raw_size, raw)
+        || ComputeSaveChecksum(raw) != file_header.checksum) {
+        return false;
+    }
+
+    FSaveReader reader(raw);
+    header.world_seed = reader.GetVarint();
+    uint64_t rng_word_count = reader.GetVarint();
+    for (uint64_t i = 0; i < rng_word_count && reader.IsOk(); ++i) {
+        header.rng_stream_states.push_back(reader.GetVarint());
+    }
+    header.start_time.year = static_cast<int>(reader.GetZigZag());
+    header.start_time.month = static_cast<int>(reader.GetZigZag());
+    header.start_time.day = static_cast<int>(reader.GetZigZag());
+    header.start_time.minute = static_cast<int>(reader.GetZigZag());
+    header.time_scale = BitsToFloat(reader.GetU32());
+    header.npc_count = static_cast<uint32_t>(reader.GetVarint());
+    header.initial_state_hash = reader.GetVarint();
+    header.total_ticks = reader.GetVarint();
+    uint64_t event_count = reader.GetVarint();
+
+    std::vector<std::string> strings;
+    auto get_id = [&]() -> std::string {
+        uint64_t code = reader.GetVarint();
+        uint64_t index = code >> 1;
+        if (code & 1) {
+            strings.push_back(reader.GetString());
+        }
+        return index < strings.size() ? strings[static_cast<size_t>(index)] : std::string();
+    };
+    auto get_float = [&]() { return BitsToFloat(reader.GetU32()); };
+
+    uint64_t tick = 0;
+    for (uint64_t i = 0; i < event_count && reader.IsOk(); ++i) {
+        FReplayEvent event;
+        event.type = static_cast<EReplayEvent>(reader.GetU8());
+        tick += reader.GetVarint();
+        event.tick = tick;
+
+        switch (event.type) {
+            case EReplayEvent::DELTA_TIME:
+                event.delta_time = get_float();
+                break;
+            case EReplayEvent::ADVANCE_TIME:
+            case EReplayEvent::SELECT_CHOICE:
+                event.value = static_cast<int32_t>(reader.GetZigZag());
+                break;
+            case EReplayEvent::PLAYER_ACTION:
+            case EReplayEvent::START_DIALOGUE:
+            case EReplayEvent::INITIATE_COMBAT:
+                event.id = get_id();
+                break;
+            case EReplayEvent::FIRE_WEAPON:
+                event.id = get_id();
+                event.position.x = get_float();
+                event.position.y = get_float();
+                event.position.z = get_float();
+                break;
+            case EReplayEvent::CHECKPOINT:
+                event.state_hash = reader.GetVarint();
+                break;
+            case EReplayEvent::END_DIALOGUE:
+            case EReplayEvent::END_COMBAT:
+                break;
+            default:
+                return false;
+        }
+
+        events.push_back(event);
+    }
+
+    return reader.IsOk() && events.size() == event_count;
+}
+
+bool ReplayPlayer::LoadFromFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    std::string stream((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return Load(stream);
+}
+
+FReplayResult ReplayPlayer::Run(GameManager& game_manager, bool stop_on_divergence) const {
+    using Clock = std::chrono::steady_clock;
+
+    FReplayResult result;
+    result.loaded = true;
+
+    game_manager.GetWorldState().world_seed = header.world_seed;
+    game_manager.GetRandomService()->RestoreState(header.world_seed, header.rng_stream_states);
+    game_manager.SetTimeScale(header.time_scale);
+
+    // Recordings are made with the LOD budget off (see GameManager::BeginRecording)
+    FSimulationLODSettings lod_settings = game_manager.GetSimulationLOD()->GetSettings();
+    lod_settings.budget_ms = 0.0;
+    game_manager.GetSimulationLOD()->SetSettings(lod_settings);
+    if (game_manager.ComputeStateHash() != header.initial_state_hash) {
+        result.diverged = true;
+        if (stop_on_divergence) return result;
+    }
+
+    auto start = Clock::now();
+    float delta_time = 0.016f;
+    uint64_t ticks = 0;
+
+    auto run_until = [&](uint64_t target_tick) {
+        while (ticks < target_tick) {
+            game_manager.Update(delta_time);
+            NAUVOO_PROFILE_FRAME();
+            ticks++;
+        }
+    };
+
+    for (const FReplayEvent& event : events) {
+        run_until(event.tick);
+
+        switch (event.type) {
+            case EReplayEvent::DELTA_TIME:
+                delta_time = event.delta_time;
+                break;
+            case EReplayEvent::ADVANCE_TIME:
+                game_manager.AdvanceGameTime(event.value);
+                break;
+            case EReplayEvent::PLAYER_ACTION:
+                game_manager.RecordPlayerAction(event.id);
+                break;
+            case EReplayEvent::START_DIALOGUE:
+                game_manager.StartDialogueWithNPC(event.id);
+                break;
+            case EReplayEvent::SELECT_CHOICE:
+                game_manager.SelectDialogueChoice(event.value);
+                break;
+            case EReplayEvent::END_DIALOGUE:
+                game_manager.EndDialogue();
+                break;
+            case EReplayEvent::INITIATE_COMBAT:
+                game_manager.InitiateCombat(event.id);
+                break;
+            case EReplayEvent::END_COMBAT:
+                game_manager.EndCombat();
+                break;
+            case EReplayEvent::FIRE_WEAPON:
+                game_manager.FireWeapon(event.position, event.id);
+                break;
+            case EReplayEvent::CHECKPOINT:
+                result.checkpoints_verified++;
+                if (!result.diverged && game_manager.ComputeStateHash() != event.state_hash) {
+                    result.diverged = true;
+                    result.divergence_tick = event.tick;
+                }
+                break;
+        }
+
+        result.events_applied++;
+        if (result.diverged && stop_on_divergence) break;
+    }
+
+    if (!(result.diverged && stop_on_divergence)) {
+        run_until(header.total_ticks);
+    }
+
+    result.ticks = ticks;
+    result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    result.ticks_per_second = result.seconds > 0.0 ? ticks / result.seconds : 0.0;
+    return result;
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include "../Systems/SaveCodec.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Nauvoo {
+
+class GameManager;
+
+// Every external input to GameManager, plus tick-rate changes and state checkpoints
+enum class EReplayEvent : uint8_t {
+    DELTA_TIME,
+    ADVANCE_TIME,
+    PLAYER_ACTION,
+    START_DIALOGUE,
+    SELECT_CHOICE,
+    END_DIALOGUE,
+    INITIATE_COMBAT,
+    END_COMBAT,
+    FIRE_WEAPON,
+    CHECKPOINT
+};
+
+struct FReplayEvent {
+    uint64_t tick = 0;              // number of GameManager::Update calls before this event
+    EReplayEvent type = EReplayEvent::CHECKPOINT;
+    std::string id;                 // action / NPC id
+    int32_t value = 0;              // minutes, choice index
+    float delta_time = 0.0f;
+    FVector3 position = { 0, 0, 0 };
+    uint64_t state_hash = 0;
+};
+
+struct FReplayHeader {
+    uint64_t world_seed = 0;
+    std::vector<uint64_t> rng_stream_states;
+    FDateTime start_time = { 0, 0, 0, 0 };
+    float time_scale = 0.0f;        // game minutes per simulated second
+    uint32_t npc_count = 0;
+    uint64_t initial_state_hash = 0;
+    uint64_t total_ticks = 0;
+};
+
+/**
+ * Records GameManager inputs into a compact binary stream.
+ * Events are delta-coded by tick, ids go through an inline string table,
+ * and the finished stream is LZ-compressed behind a FSaveFileHeader.
+ */
+class ReplayRecorder {
+public:
+    void Begin(const FReplayHeader& header);
+    void Record(const FReplayEvent& event);
+    bool IsRecording() const { return is_recording; }
+
+    // Finalizes the stream with the tick count reached
+    std::string Finish(uint64_t total_ticks);
+    bool FinishToFile(const std::string& filename, uint64_t total_ticks);
+
+    size_t GetEventCount() const { return event_count; }
+
+private:
+    FReplayHeader header;
+    FSaveWriter events;
+    std::unordered_map<std::string, uint32_t> string_ids;
+    uint64_t last_tick = 0;
+    size_t event_count = 0;
+    bool is_recording = false;
+
+    void PutId(const std::string& id);
+};
+
+struct FReplayResult {
+    bool loaded = false;
+    bool diverged = false;
+    uint64_t divergence_tick = 0;
+    uint64_t ticks = 0;
+    size_t events_applied = 0;
+    size_t checkpoints_verified = 0;
+    double seconds = 0.0;
+    double ticks_per_second = 0.0;
+};
+
+/**
+ * Replays a recorded stream against a GameManager as fast as possible,
+ * verifying state-hash checkpoints along the way
+ */
+class ReplayPlayer {
+public:
+    bool Load(const std::string& stream);
+    bool LoadFromFile(const std::string& filename);
+
+    const FReplayHeader& GetHeader() const { return header; }
+    const std::vector<FReplayEvent>& GetEvents() const { return events; }
+
+    // The game manager must be set up the same way as when recording started
+    FReplayResult Run(GameManager& game_manager, bool stop_on_divergence = true) const;
+
+private:
+    FReplayHeader header;
+    std::vector<FReplayEvent> events;
+};
+
+}  // namespace Nauvoo
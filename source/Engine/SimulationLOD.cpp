@@ -0,0 +1,102 @@
+#include "SimulationLOD.h"
+#include "Metrics.h"
+#include <algorithm>
+
+namespace Nauvoo {
+
+namespace {
+
+struct FLODMetrics {
+    MetricGauge& full = MetricsRegistry::Get().GetGauge("lod.full");
+    MetricGauge& reduced = MetricsRegistry::Get().GetGauge("lod.reduced");
+    MetricGauge& dormant = MetricsRegistry::Get().GetGauge("lod.dormant");
+    MetricHistogram& ticks_per_frame = MetricsRegistry::Get().GetHistogram("lod.ticks_per_frame");
+    MetricCounter& budget_limited_frames = MetricsRegistry::Get().GetCounter("lod.budget_limited_frames");
+};
+
+FLODMetrics& Metrics() {
+    static FLODMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
+SimulationLOD::SimulationLOD() {
+    Metrics();
+}
+
+ESimulationLOD SimulationLOD::Classify(const FNPC& npc, const FVector3& focus) const {
+    if (npc.is_in_combat) return ESimulationLOD::FULL;
+
+    float dx = npc.position.x - focus.x;
+    float dy = npc.position.y - focus.y;
+    float dz = npc.position.z - focus.z;
+    float distance_squared = dx * dx + dy * dy + dz * dz;
+
+    if (distance_squared <= settings.full_radius * settings.full_radius) return ESimulationLOD::FULL;
+    if (distance_squared <= settings.reduced_radius * settings.reduced_radius) return ESimulationLOD::REDUCED;
+    return ESimulationLOD::DORMANT;
+}
+
+void SimulationLOD::BuildTickList(std::vector<FNPC>& npcs, const FVector3& focus, float delta_time) {
+    tick_list.Clear();
+    reduced_npcs.clear();
+    std::fill(std::begin(lod_counts), std::end(lod_counts), 0);
+    alive_count = 0;
+
+    // Full NPCs always tick; everyone else banks the frame time
+    for (size_t i = 0; i < npcs.size(); ++i) {
+        FNPC& npc = npcs[i];
+        if (!npc.is_alive) continue;
+        alive_count++;
+
+        npc.simulation_lod = Classify(npc, focus);
+        lod_counts[static_cast<size_t>(npc.simulation_lod)]++;
+
+        if (npc.simulation_lod == ESimulationLOD::FULL) {
+            tick_list.Add(static_cast<uint32_t>(i), npc.unsimulated_seconds + delta_time);
+            npc.unsimulated_seconds = 0.0f;
+        } else {
+            npc.unsimulated_seconds += delta_time;
+            if (npc.simulation_lod == ESimulationLOD::REDUCED) reduced_npcs.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    // Reduced NPCs share what is left of the budget, round-robin; the fractional
+    // share carries over so a handful of NPCs still tick once per interval
+    int interval = std::max(settings.reduced_interval_frames, 1);
+    reduced_credit += static_cast<double>(reduced_npcs.size()) / interval;
+    size_t quota = std::min(static_cast<size_t>(reduced_credit), reduced_npcs.size());
+    reduced_credit -= static_cast<double>(quota);
+    if (settings.budget_ms > 0.0 && cost_per_tick_ns > 0.0) {
+        size_t budget_ticks = static_cast<size_t>(settings.budget_ms * 1e6 / cost_per_tick_ns);
+        size_t remaining = budget_ticks > tick_list.GetCount() ? budget_ticks - tick_list.GetCount() : 0;
+        if (remaining < quota) {
+            quota = remaining;
+            Metrics().budget_limited_frames.Add();
+        }
+    }
+
+    if (reduced_cursor >= reduced_npcs.size()) reduced_cursor = 0;
+    for (size_t k = 0; k < quota; ++k) {
+        uint32_t npc_index = reduced_npcs[(reduced_cursor + k) % reduced_npcs.size()];
+        FNPC& npc = npcs[npc_index];
+        tick_list.Add(npc_index, npc.unsimulated_seconds);
+        npc.unsimulated_seconds = 0.0f;
+    }
+    if (!reduced_npcs.empty()) reduced_cursor = (reduced_cursor + quota) % reduced_npcs.size();
+
+    Metrics().full.Set(static_cast<int64_t>(GetCount(ESimulationLOD::FULL)));
+    Metrics().reduced.Set(static_cast<int64_t>(GetCount(ESimulationLOD::REDUCED)));
+    Metrics().dormant.Set(static_cast<int64_t>(GetCount(ESimulationLOD::DORMANT)));
+    Metrics().ticks_per_frame.Record(tick_list.GetCount());
+}
+
+void SimulationLOD::EndFrame(double tick_seconds) {
+    if (tick_list.GetCount() == 0) return;
+
+    double sample = tick_seconds * 1e9 / static_cast<double>(tick_list.GetCount());
+    cost_per_tick_ns = cost_per_tick_ns > 0.0 ? cost_per_tick_ns * 0.9 + sample * 0.1 : sample;
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Nauvoo {
+
+struct FSimulationLODSettings {
+    float full_radius = 60.0f;          // NPCs this close to the player tick every frame
+    float reduced_radius = 240.0f;      // beyond this they go dormant
+    int reduced_interval_frames = 8;    // reduced NPCs tick about once per this many frames
+    double budget_ms = 4.0;             // cap on NPC tick time per frame; 0 = unbounded
+};
+
+/**
+ * NPCs to tick this frame, each with the time it has to simulate: the frame
+ * time plus whatever it skipped since its last tick.
+ */
+struct FNPCTickList {
+    std::vector<uint32_t> npc_indices;
+    std::vector<float> delta_times;
+
+    size_t GetCount() const { return npc_indices.size(); }
+
+    void Add(uint32_t npc_index, float delta_time) {
+        npc_indices.push_back(npc_index);
+        delta_times.push_back(delta_time);
+    }
+
+    void Clear() {
+        npc_indices.clear();
+        delta_times.clear();
+    }
+};
+
+/**
+ * Picks which NPCs are simulated each frame. NPCs near the player (or in
+ * combat) are FULL and tick every frame; further out they are REDUCED and
+ * tick round-robin, integrating the skipped time on their next tick; beyond
+ * that they are DORMANT and only resolved on demand.
+ *
+ * The budget caps how many reduced NPCs tick per frame using the measured
+ * cost of a tick. It depends on machine speed, so recording and replay turn
+ * it off (budget_ms = 0) to keep the ticked set deterministic.
+ */
+class SimulationLOD {
+public:
+    SimulationLOD();
+
+    void SetSettings(const FSimulationLODSettings& new_settings) { settings = new_settings; }
+    const FSimulationLODSettings& GetSettings() const { return settings; }
+
+    // Classifies every NPC around the focus point and selects this frame's tick list
+    void BuildTickList(std::vector<FNPC>& npcs, const FVector3& focus, float delta_time);
+    const FNPCTickList& GetTickList() const { return tick_list; }
+
+    // Call once the tick list has been simulated, with the time the per-NPC systems spent on it;
+    // feeds the cost of a tick back into the budget
+    void EndFrame(double tick_seconds);
+
+    size_t GetCount(ESimulationLOD lod) const { return lod_counts[static_cast<size_t>(lod)]; }
+    size_t GetAliveCount() const { return alive_count; }
+    double GetCostPerTickNs() const { return cost_per_tick_ns; }
+
+private:
+    FSimulationLODSettings settings;
+    FNPCTickList tick_list;
+
+    std::vector<uint32_t> reduced_npcs;
+    size_t reduced_cursor = 0;
+    double reduced_credit = 0.0;
+
+    size_t lod_counts[3] = {};
+    size_t alive_count = 0;
+
+    double cost_per_tick_ns = 0.0;      // moving average; 0 until measured
+
+    ESimulationLOD Classify(const FNPC& npc, const FVector3& focus) const;
+};
+
+}  // namespace Nauvoo
@@ -0,0 +1,71 @@
+#include "Symbol.h"
+#include "Metrics.h"
+#include <mutex>
+
+namespace Nauvoo {
+
+namespace {
+
+struct FSymbolMetrics {
+    MetricGauge& interned = MetricsRegistry::Get().GetGauge("symbols.interned");
+};
+
+FSymbolMetrics& Metrics() {
+    static FSymbolMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
+SymbolTable::SymbolTable() {
+    for (std::string_view name : PREINTERNED_SYMBOLS) Intern(name);
+}
+
+SymbolTable& SymbolTable::Get() {
+    static SymbolTable table;
+    return table;
+}
+
+FSymbol SymbolTable::Intern(std::string_view text) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = symbols.find(text);
+        if (it != symbols.end()) return FSymbol(it->second);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    // Another thread may have interned it between the locks
+    auto it = symbols.find(text);
+    if (it != symbols.end()) return FSymbol(it->second);
+
+    names.emplace_back(text);
+    uint32_t value = static_cast<uint32_t>(names.size());
+    symbols.emplace(names.back(), value);
+    Metrics().interned.Set(static_cast<int64_t>(names.size()));
+    return FSymbol(value);
+}
+
+FSymbol SymbolTable::Find(std::string_view text) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    auto it = symbols.find(text);
+    return it != symbols.end() ? FSymbol(it->second) : FSymbol();
+}
+
+const std::string& SymbolTable::GetName(FSymbol symbol) const {
+    static const std::string empty;
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    // Names are never removed and the deque does not move them, so the reference outlives the lock
+    return symbol.IsValid() && symbol.value <= names.size() ? names[symbol.value - 1] : empty;
+}
+
+size_t SymbolTable::GetCount() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return names.size();
+}
+
+std::vector<std::string> SymbolTable::GetNames() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return std::vector<std::string>(names.begin(), names.end());
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Nauvoo {
+
+// FNV-1a 32 of the text; indexes the symbol table, never stands in for the text itself
+constexpr uint32_t HashSymbol(std::string_view text) {
+    uint32_t hash = 0x811c9dc5u;
+    for (char c : text) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+/**
+ * 32-bit id standing for an NPC, action, location, dialogue or event id
+ * string. Values are handed out in order by SymbolTable, one per distinct
+ * text, so two ids never share a symbol; they are only stable within a run,
+ * and saves store the names beside them (FSaveSymbolTable). Compare and
+ * hash symbols instead of the strings they stand for.
+ */
+struct FSymbol {
+    uint32_t value = 0;     // 0 = no symbol
+
+    constexpr FSymbol() = default;
+    constexpr explicit FSymbol(uint32_t symbol_value) : value(symbol_value) {}
+    // Interns the text
+    explicit FSymbol(std::string_view text);
+
+    constexpr bool IsValid() const { return value != 0; }
+    constexpr bool operator==(FSymbol other) const { return value == other.value; }
+    constexpr bool operator!=(FSymbol other) const { return value != other.value; }
+    constexpr bool operator<(FSymbol other) const { return value < other.value; }
+};
+
+// Interned before anything else, in this order, so their symbols are constants
+constexpr std::string_view PREINTERNED_SYMBOLS[] = { "player" };
+
+// The constant symbol of a preinterned name; invalid for any other text
+constexpr FSymbol PreinternedSymbol(std::string_view text) {
+    for (size_t i = 0; i < sizeof(PREINTERNED_SYMBOLS) / sizeof(PREINTERNED_SYMBOLS[0]); ++i) {
+        if (PREINTERNED_SYMBOLS[i] == text) return FSymbol(static_cast<uint32_t>(i + 1));
+    }
+    return FSymbol();
+}
+
+/**
+ * Process-wide interner behind the symbols: text to symbol through a hash
+ * index, symbol to text by position. Names are never removed, so symbols
+ * and the references GetName returns stay valid for the whole run.
+ * Lookups and interning are safe from any thread.
+ */
+class SymbolTable {
+public:
+    static SymbolTable& Get();
+
+    FSymbol Intern(std::string_view text);
+    // Invalid when the text was never interned
+    FSymbol Find(std::string_view text) const;
+    // Empty for symbols never interned
+    const std::string& GetName(FSymbol symbol) const;
+
+    size_t GetCount() const;
+    // Every interned name, ordered by symbol
+    std::vector<std::string> GetNames() const;
+
+private:
+    struct FTextHash {
+        size_t operator()(std::string_view text) const noexcept { return HashSymbol(text); }
+    };
+
+    SymbolTable();
+
+    mutable std::shared_mutex mutex;
+    std::deque<std::string> names;                                      // symbol value - 1; a deque so names never move
+    std::unordered_map<std::string_view, uint32_t, FTextHash> symbols;  // views into names
+};
+
+inline FSymbol::FSymbol(std::string_view text) : value(SymbolTable::Get().Intern(text).value) {}
+
+// For literals; interns, so keep the result in a static when the call is hot:
+// static const FSymbol ATTEND_DRILL = MakeSymbol("attend_drill");
+inline FSymbol MakeSymbol(std::string_view text) { return FSymbol(text); }
+
+}  // namespace Nauvoo
+
+namespace std {
+template <>
+struct hash<Nauvoo::FSymbol> {
+    // Dense sequential values; TFlatHashMap mixes them itself
+    size_t operator()(Nauvoo::FSymbol symbol) const noexcept { return symbol.value; }
+};
+}  // namespace std
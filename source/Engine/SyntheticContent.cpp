@@ -0,0 +1,119 @@
+#include "SyntheticContent.h"
+#include "GameManager.h"
+#include "Log.h"
+#include "../Systems/NPCScheduleManager.h"
+#include "../Systems/DialogueManager.h"
+#include <algorithm>
+
+namespace Nauvoo {
+
+namespace {
+
+const char* const LOCATIONS[] = { "loc_homestead", "loc_fields", "loc_market", "loc_town_square", "loc_temple_site" };
+const char* const OCCUPATIONS[] = { "farmer", "carpenter", "laborer", "merchant", "blacksmith" };
+
+}  // namespace
+
+std::string SyntheticContentGenerator::MakeNPCId(int index) {
+    return "npc_synthetic_" + std::to_string(index);
+}
+
+FNPC SyntheticContentGenerator::MakeNPC(int index) {
+    FNPC npc;
+    npc.id = MakeNPCId(index);
+    npc.name = "Settler " + std::to_string(index);
+    npc.age = 18 + (index * 7) % 50;
+    npc.occupation = OCCUPATIONS[index % 5];
+    npc.faction = (index % 4 == 0) ? EFaction::LEGION_SOLDIER : EFaction::LDS_CIVILIAN;
+    npc.position = { static_cast<float>(index % 200) * 3.0f, 0.0f, static_cast<float>(index / 200) * 3.0f };
+    return npc;
+}
+
+FNPCSchedule SyntheticContentGenerator::MakeSchedule(const std::string& npc_id, int index) {
+    // Stagger routines so schedule transitions spread across the hour
+    int offset = index % 60;
+
+    FNPCSchedule schedule;
+    schedule.npc_id = npc_id;
+    schedule.daily_routine = {
+        { 0, 360 + offset, LOCATIONS[0], EActivityType::REST, true, {} },
+        { 360 + offset, 720 + offset, LOCATIONS[1 + index % 2], EActivityType::WORK, true, {} },
+        { 720 + offset, 780 + offset, LOCATIONS[3], EActivityType::EAT, true, {} },
+        { 780 + offset, 1080 + offset, LOCATIONS[1 + index % 2], EActivityType::WORK, true, {} },
+        { 1080 + offset, 1260, LOCATIONS[3 + index % 2], EActivityType::SOCIALIZE, true, {} },
+        { 1260, 1440, LOCATIONS[0], EActivityType::REST, true, {} }
+    };
+    return schedule;
+}
+
+FDialogueTree SyntheticContentGenerator::MakeDialogueTree(int index, const std::string& npc_id,
+                                                         int node_count, int choices_per_node) {
+    FDialogueTree tree;
+    tree.id = "dialogue_synthetic_" + std::to_string(index);
+    tree.npc_id = npc_id;
+    tree.root_node_id = tree.id + "_node_0";
+
+    for (int n = 0; n < node_count; ++n) {
+        FDialogueNode node;
+        node.id = tree.id + "_node_" + std::to_string(n);
+        node.speaker_npc_id = npc_id;
+        node.text = "Synthetic line " + std::to_string(n) + " of " + tree.id;
+
+        bool is_last = (n + 1 == node_count);
+        node.type = is_last ? "speech" : "choice";
+
+        if (!is_last) {
+            for (int c = 0; c < choices_per_node; ++c) {
+                FDialogueOption option;
+                option.id = node.id + "_choice_" + std::to_string(c);
+                option.display_text = "Response " + std::to_string(c);
+                option.next_node_id = tree.id + "_node_" + std::to_string(n + 1);
+                // Every other choice is gated so availability checks do real work
+                if (c % 2 == 1) option.legion_rep_requirement = (c * 10) - 20;
+                if (c % 3 == 2) option.npc_trust_requirement = c * 5;
+                option.legion_rep_delta = (c % 3) - 1;
+                node.choices.push_back(option);
+            }
+        }
+
+        tree.nodes.push_back(node);
+    }
+
+    return tree;
+}
+
+void SyntheticContentGenerator::Populate(GameManager& game_manager, const FSyntheticContentOptions& options) {
+    // Per-entity spawn messages are DEBUG; quiet keeps only warnings and errors
+    ScopedLogLevel log_level(options.quiet ? std::max(Logger::GetLevel(), ELogLevel::WARNING) : Logger::GetLevel());
+
+    NPCScheduleManager* schedules = game_manager.GetScheduleManager();
+    DialogueManager* dialogue = game_manager.GetDialogueManager();
+
+    game_manager.GetAllNPCs().reserve(game_manager.GetAllNPCs().size() + options.npc_count);
+
+    int wounded_every = options.wounded_fraction > 0.0f
+        ? static_cast<int>(1.0f / options.wounded_fraction) : 0;
+
+    for (int i = 0; i < options.npc_count; ++i) {
+        FNPC npc = MakeNPC(i);
+
+        if (wounded_every > 0 && i % wounded_every == 0) {
+            FInjury injury;
+            injury.type = EInjuryType::LACERATION;
+            injury.location = static_cast<EBodyPart>(i % 6);
+            injury.severity = 1;
+            injury.SetBleedRate(0.1f);
+            npc.injuries.push_back(injury);
+        }
+
+        game_manager.SpawnNPC(npc);
+        schedules->AddSchedule(MakeSchedule(npc.id, i));
+    }
+
+    for (int t = 0; t < options.dialogue_tree_count && options.npc_count > 0; ++t) {
+        dialogue->AddDialogueTree(MakeDialogueTree(t, MakeNPCId(t % options.npc_count),
+                                                   options.nodes_per_tree, options.choices_per_node));
+    }
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreTypes.h"
+#include <cstdint>
+#include <string>
+
+namespace Nauvoo {
+
+class GameManager;
+
+struct FSyntheticContentOptions {
+    int npc_count = 100;
+    int dialogue_tree_count = 0;        // spread across the generated NPCs
+    int nodes_per_tree = 6;
+    int choices_per_node = 4;
+    float wounded_fraction = 0.0f;      // share of NPCs spawned with bleeding injuries
+    bool quiet = true;                  // suppress per-entity console output while populating
+};
+
+/**
+ * Generates NPCs, schedules and dialogue trees at scale for soak tests and benchmarks.
+ * Output is a pure function of the index, so runs are comparable across builds.
+ */
+class SyntheticContentGenerator {
+public:
+    static std::string MakeNPCId(int index);
+    static FNPC MakeNPC(int index);
+    static FNPCSchedule MakeSchedule(const std::string& npc_id, int index);
+    static FDialogueTree MakeDialogueTree(int index, const std::string& npc_id,
+                                         int node_count, int choices_per_node);
+
+    // Spawns NPCs with schedules (and optionally dialogue) into a running game
+    static void Populate(GameManager& game_manager, const FSyntheticContentOptions& options);
+};
+
+}  // namespace Nauvoo
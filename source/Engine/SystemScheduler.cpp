@@ -0,0 +1,160 @@
+#include "SystemScheduler.h"
+#include "JobSystem.h"
+#include <algorithm>
+#include <iostream>
+
+namespace Nauvoo {
+
+namespace {
+
+const char* GetPhaseName(ETickPhase phase) {
+    switch (phase) {
+        case ETickPhase::TIME: return "TIME";
+        case ETickPhase::SIMULATION: return "SIMULATION";
+        case ETickPhase::RESOLUTION: return "RESOLUTION";
+        case ETickPhase::POST: return "POST";
+    }
+    return "?";
+}
+
+const char* GetRateName(ETickRate rate) {
+    switch (rate) {
+        case ETickRate::EVERY_FRAME: return "frame";
+        case ETickRate::GAME_MINUTE: return "game minute";
+        case ETickRate::GAME_HOUR: return "game hour";
+    }
+    return "?";
+}
+
+int64_t GetRatePeriodMinutes(ETickRate rate) {
+    return rate == ETickRate::GAME_HOUR ? 60 : 1;
+}
+
+// Floor division so boundaries stay correct for negative clocks
+int64_t GetPeriodIndex(int64_t minutes, int64_t period) {
+    return minutes >= 0 ? minutes / period : (minutes - period + 1) / period;
+}
+
+}  // namespace
+
+SystemScheduler::SystemScheduler() = default;
+SystemScheduler::~SystemScheduler() = default;
+
+SystemScheduler::FSystemId SystemScheduler::RegisterSystem(FSystemDesc desc) {
+    // Gating reads the clock, so the clock's writer must finish first
+    if (desc.rate != ETickRate::EVERY_FRAME) desc.reads = desc.reads | ESystemData::CLOCK;
+    if (desc.amortize_frames < 1) desc.amortize_frames = 1;
+
+    auto state = std::make_unique<FSystemState>();
+    state->desc = std::move(desc);
+    systems.push_back(std::move(state));
+    graph_dirty = true;
+    return systems.size() - 1;
+}
+
+bool SystemScheduler::CanRunConcurrently(FSystemId a, FSystemId b) const {
+    const FSystemDesc& first = systems[a]->desc;
+    const FSystemDesc& second = systems[b]->desc;
+    return !Overlaps(first.writes, second.reads | second.writes)
+        && !Overlaps(second.writes, first.reads);
+}
+
+std::vector<SystemScheduler::FSystemId> SystemScheduler::GetPhaseOrder() const {
+    std::vector<FSystemId> order(systems.size());
+    for (FSystemId system = 0; system < systems.size(); ++system) order[system] = system;
+    std::stable_sort(order.begin(), order.end(), [this](FSystemId a, FSystemId b) {
+        return systems[a]->desc.phase < systems[b]->desc.phase;
+    });
+    return order;
+}
+
+void SystemScheduler::RebuildGraph() {
+    std::vector<FSystemId> execution_order = GetPhaseOrder();
+
+    // Graph node i runs execution_order[i]; it waits on every earlier system it conflicts with
+    graph = std::make_unique<JobGraph>();
+    for (FSystemId system : execution_order) {
+        FSystemState* state = systems[system].get();
+        graph->AddNode(state->desc.name.c_str(), [this, state]() { RunSystem(*state); });
+    }
+    for (size_t later = 0; later < execution_order.size(); ++later) {
+        for (size_t earlier = 0; earlier < later; ++earlier) {
+            if (!CanRunConcurrently(execution_order[earlier], execution_order[later])) {
+                graph->AddDependency(earlier, later);
+            }
+        }
+    }
+
+    graph_dirty = false;
+}
+
+void SystemScheduler::Tick(float delta_time, JobSystem& jobs) {
+    if (graph_dirty) RebuildGraph();
+
+    frame_delta_time = delta_time;
+    graph->Run(jobs);
+}
+
+void SystemScheduler::RunSystem(FSystemState& state) {
+    const FSystemDesc& desc = state.desc;
+    state.pending_delta_time += frame_delta_time;
+    int64_t now = GetGameMinutes();
+
+    if (desc.rate == ETickRate::EVERY_FRAME) {
+        FSystemTickContext context;
+        context.delta_time = state.pending_delta_time;
+        context.frame_memory = frame_memory;
+        context.game_minutes = state.has_run ? static_cast<int>(now - state.last_run_minute) : 0;
+        state.pending_delta_time = 0.0f;
+        state.has_run = true;
+        state.last_run_minute = now;
+        state.run_count++;
+        desc.update(context);
+        return;
+    }
+
+    // Start a new run when the clock has crossed into a new period
+    if (state.slices_remaining == 0) {
+        int64_t period = GetRatePeriodMinutes(desc.rate);
+        if (state.has_run && GetPeriodIndex(now, period) == GetPeriodIndex(state.last_run_minute, period)) {
+            return;
+        }
+
+        state.cycle.delta_time = state.pending_delta_time;
+        state.cycle.game_minutes = state.has_run ? static_cast<int>(now - state.last_run_minute) : 0;
+        state.cycle.slice_count = desc.amortize_frames;
+        state.cycle.frame_memory = frame_memory;
+        state.pending_delta_time = 0.0f;
+        state.has_run = true;
+        state.last_run_minute = now;
+        state.slices_remaining = desc.amortize_frames;
+        state.run_count++;
+    }
+
+    state.cycle.slice = state.cycle.slice_count - state.slices_remaining;
+    state.slices_remaining--;
+    desc.update(state.cycle);
+}
+
+void SystemScheduler::PrintSchedule() const {
+    std::cout << "\n=== SYSTEM SCHEDULE ===" << std::endl;
+
+    std::vector<FSystemId> order = GetPhaseOrder();
+    for (size_t i = 0; i < order.size(); ++i) {
+        const FSystemDesc& desc = systems[order[i]]->desc;
+        std::cout << GetPhaseName(desc.phase) << " " << desc.name << " (every " << GetRateName(desc.rate);
+        if (desc.amortize_frames > 1) std::cout << ", over " << desc.amortize_frames << " frames";
+        std::cout << ")";
+
+        bool first = true;
+        for (size_t j = 0; j < i; ++j) {
+            if (!CanRunConcurrently(order[j], order[i])) {
+                std::cout << (first ? " after " : ", ") << systems[order[j]]->desc.name;
+                first = false;
+            }
+        }
+        std::cout << std::endl;
+    }
+}
+
+}  // namespace Nauvoo
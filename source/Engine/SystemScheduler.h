@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Nauvoo {
+
+class JobSystem;
+class JobGraph;
+
+// Phases run in this order; within a phase, systems run in registration order
+enum class ETickPhase {
+    TIME,           // game clock
+    SIMULATION,     // schedules, AI, gossip
+    RESOLUTION,     // health, deaths, consequences
+    POST            // bookkeeping that observes the finished tick
+};
+
+enum class ETickRate {
+    EVERY_FRAME,
+    GAME_MINUTE,
+    GAME_HOUR
+};
+
+// Shared data a system reads or writes; bit flags so sets can be combined
+enum class ESystemData : uint32_t {
+    NONE = 0,
+    CLOCK = 1u << 0,            // world time
+    NPC_ROUTINE = 1u << 1,      // current activity
+    NPC_BEHAVIOR = 1u << 2,     // combat flags, AI state, morale and panic flight
+    NPC_HEALTH = 1u << 3,       // health, injuries, alive
+    PLAYER = 1u << 4,
+    COMBAT = 1u << 5,           // CombatSystem engagement state
+    REPUTATION = 1u << 6,
+    WORLD_EVENTS = 1u << 7,
+    NPC_LOD = 1u << 8,          // simulation LOD tiers and this frame's tick list
+    EVENTS = 1u << 9            // EventBus queues: publishers write, the dispatcher drains
+};
+
+constexpr ESystemData operator|(ESystemData a, ESystemData b) {
+    return static_cast<ESystemData>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+}
+
+constexpr bool Overlaps(ESystemData a, ESystemData b) {
+    return (static_cast<uint32_t>(a) & static_cast<uint32_t>(b)) != 0;
+}
+
+/**
+ * What a system is given when it runs. Lower-rate systems see the time
+ * accumulated since their previous run; amortized systems also see which
+ * slice of their work belongs to this frame.
+ */
+struct FSystemTickContext {
+    float delta_time = 0.0f;    // real seconds since the previous run
+    int game_minutes = 0;       // game minutes since the previous run
+    int slice = 0;
+    int slice_count = 1;
+    // Scratch memory reclaimed after the tick (the frame arena when the owner provides one)
+    std::pmr::memory_resource* frame_memory = std::pmr::get_default_resource();
+
+    // The part of [0, count) this slice should process
+    std::pair<size_t, size_t> GetSliceRange(size_t count) const {
+        return { count * slice / slice_count, count * (slice + 1) / slice_count };
+    }
+};
+
+struct FSystemDesc {
+    std::string name;
+    ETickPhase phase = ETickPhase::SIMULATION;
+    ESystemData reads = ESystemData::NONE;
+    ESystemData writes = ESystemData::NONE;
+    ETickRate rate = ETickRate::EVERY_FRAME;
+    int amortize_frames = 1;    // lower-rate systems: spread each run over this many frames
+    std::function<void(const FSystemTickContext&)> update;
+};
+
+/**
+ * Runs registered systems once per frame. Systems that touch overlapping data
+ * run in phase/registration order; the rest run in parallel on the job system.
+ * Lower-rate systems are gated on the game clock the scheduler is fed via
+ * AdvanceGameMinutes and may split each run across several frames.
+ */
+class SystemScheduler {
+public:
+    using FSystemId = size_t;
+
+    SystemScheduler();
+    ~SystemScheduler();
+
+    FSystemId RegisterSystem(FSystemDesc desc);
+
+    void Tick(float delta_time, JobSystem& jobs);
+    // Handed to systems as FSystemTickContext::frame_memory
+    void SetFrameMemory(std::pmr::memory_resource* memory) { frame_memory = memory; }
+
+    // Game clock in minutes; hour boundaries are multiples of 60
+    void SetGameMinutes(int64_t minutes) { game_minutes.store(minutes, std::memory_order_relaxed); }
+    void AdvanceGameMinutes(int minutes) { game_minutes.fetch_add(minutes, std::memory_order_relaxed); }
+    int64_t GetGameMinutes() const { return game_minutes.load(std::memory_order_relaxed); }
+
+    size_t GetSystemCount() const { return systems.size(); }
+    const FSystemDesc& GetSystem(FSystemId system) const { return systems[system]->desc; }
+    uint64_t GetRunCount(FSystemId system) const { return systems[system]->run_count; }
+    // True when neither system writes data the other touches
+    bool CanRunConcurrently(FSystemId a, FSystemId b) const;
+
+    void PrintSchedule() const;
+
+private:
+    struct FSystemState {
+        FSystemDesc desc;
+        float pending_delta_time = 0.0f;
+        bool has_run = false;
+        int64_t last_run_minute = 0;
+        int slices_remaining = 0;
+        FSystemTickContext cycle;
+        uint64_t run_count = 0;
+    };
+
+    std::vector<std::unique_ptr<FSystemState>> systems;
+    std::unique_ptr<JobGraph> graph;
+    bool graph_dirty = true;
+
+    std::atomic<int64_t> game_minutes{ 0 };
+    float frame_delta_time = 0.0f;
+    std::pmr::memory_resource* frame_memory = std::pmr::get_default_resource();
+
+    std::vector<FSystemId> GetPhaseOrder() const;
+    void RebuildGraph();
+    void RunSystem(FSystemState& state);
+};
+
+}  // namespace Nauvoo
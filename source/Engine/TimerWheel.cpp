@@ -0,0 +1,242 @@
+#include "TimerWheel.h"
+#include "Metrics.h"
+#include <algorithm>
+
+namespace Nauvoo {
+
+namespace {
+
+struct FTimerMetrics {
+    MetricGauge& pending = MetricsRegistry::Get().GetGauge("timers.pending");
+    MetricCounter& fired = MetricsRegistry::Get().GetCounter("timers.fired");
+    MetricCounter& cascaded = MetricsRegistry::Get().GetCounter("timers.cascaded");
+};
+
+FTimerMetrics& Metrics() {
+    static FTimerMetrics metrics;
+    return metrics;
+}
+
+int LowestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#else
+    int bit = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+uint64_t RotateRight(uint64_t value, uint32_t shift) {
+    return shift == 0 ? value : (value >> shift) | (value << (64 - shift));
+}
+
+}  // namespace
+
+TimerWheel::TimerWheel(uint64_t start_tick) : current_tick(start_tick) {
+    Metrics();
+    std::fill(std::begin(slot_heads), std::end(slot_heads), NONE);
+}
+
+TimerWheel::~TimerWheel() {
+    Metrics().pending.Add(-static_cast<int64_t>(pending_count));
+}
+
+FTimerHandle TimerWheel::Schedule(uint64_t due_tick, FCallback callback) {
+    uint32_t index;
+    if (!free_timers.empty()) {
+        index = free_timers.back();
+        free_timers.pop_back();
+    } else {
+        index = static_cast<uint32_t>(timers.size());
+        timers.emplace_back();
+    }
+
+    FTimer& timer = timers[index];
+    timer.due_tick = due_tick;
+    timer.sequence = next_sequence++;
+    timer.callback = std::move(callback);
+    timer.active = true;
+    Link(index);
+
+    pending_count++;
+    Metrics().pending.Add(1);
+    return { index, timer.generation };
+}
+
+bool TimerWheel::Cancel(FTimerHandle& handle) {
+    bool pending = IsPending(handle);
+    if (pending) {
+        Unlink(handle.index);
+        Release(handle.index);
+    }
+    handle = {};
+    return pending;
+}
+
+bool TimerWheel::IsPending(const FTimerHandle& handle) const {
+    return handle.index < timers.size()
+        && timers[handle.index].active
+        && timers[handle.index].generation == handle.generation;
+}
+
+uint64_t TimerWheel::GetDueTick(const FTimerHandle& handle) const {
+    return IsPending(handle) ? timers[handle.index].due_tick : 0;
+}
+
+size_t TimerWheel::Advance(uint64_t target_tick) {
+    if (target_tick < current_tick) return 0;
+
+    size_t fired = 0;
+    for (;;) {
+        fired += FireCurrentSlot();
+
+        // Nothing is due before the next occupied slot, so the ticks in between are skipped
+        uint64_t next_tick = GetNextEventTick();
+        if (next_tick > target_tick) break;
+        current_tick = next_tick;
+
+        // Coarse levels first so their timers can land in the finer slots cascading next
+        for (int level = LEVELS - 1; level >= 1; --level) {
+            uint64_t level_span = 1ull << (SLOT_BITS * level);
+            if ((current_tick & (level_span - 1)) == 0) Cascade(level);
+        }
+    }
+
+    current_tick = target_tick;
+    return fired;
+}
+
+void TimerWheel::Reset(uint64_t start_tick) {
+    for (uint32_t index = 0; index < timers.size(); ++index) {
+        if (timers[index].active) Release(index);
+    }
+    std::fill(std::begin(slot_heads), std::end(slot_heads), NONE);
+    std::fill(std::begin(occupied), std::end(occupied), 0);
+    current_tick = start_tick;
+}
+
+void TimerWheel::Link(uint32_t timer_index) {
+    FTimer& timer = timers[timer_index];
+    uint64_t due_tick = std::max(timer.due_tick, current_tick);
+
+    // Coarsest slot needed: the first level where the timer is under a full turn away
+    int level = 0;
+    int shift = 0;
+    while (level < LEVELS - 1 && (due_tick >> shift) - (current_tick >> shift) >= SLOTS) {
+        level++;
+        shift += SLOT_BITS;
+    }
+    uint64_t slot_tick = due_tick >> shift;
+    if (slot_tick - (current_tick >> shift) >= SLOTS) {
+        // Beyond the wheel: park in the furthest slot and re-place when it cascades
+        slot_tick = (current_tick >> shift) + SLOTS - 1;
+    }
+
+    uint32_t slot_index = static_cast<uint32_t>(slot_tick & (SLOTS - 1));
+    timer.slot = static_cast<uint32_t>(level) * SLOTS + slot_index;
+    timer.prev = NONE;
+    timer.next = slot_heads[timer.slot];
+    if (timer.next != NONE) timers[timer.next].prev = timer_index;
+    slot_heads[timer.slot] = timer_index;
+    occupied[level] |= 1ull << slot_index;
+}
+
+void TimerWheel::Unlink(uint32_t timer_index) {
+    FTimer& timer = timers[timer_index];
+    if (timer.prev != NONE) timers[timer.prev].next = timer.next;
+    else slot_heads[timer.slot] = timer.next;
+    if (timer.next != NONE) timers[timer.next].prev = timer.prev;
+
+    if (slot_heads[timer.slot] == NONE) {
+        occupied[timer.slot / SLOTS] &= ~(1ull << (timer.slot % SLOTS));
+    }
+    timer.prev = NONE;
+    timer.next = NONE;
+}
+
+void TimerWheel::Release(uint32_t timer_index) {
+    FTimer& timer = timers[timer_index];
+    timer.callback = nullptr;
+    timer.active = false;
+    timer.generation++;
+    free_timers.push_back(timer_index);
+
+    pending_count--;
+    Metrics().pending.Add(-1);
+}
+
+void TimerWheel::Cascade(int level) {
+    uint32_t slot_index = static_cast<uint32_t>((current_tick >> (SLOT_BITS * level)) & (SLOTS - 1));
+    uint32_t slot = static_cast<uint32_t>(level) * SLOTS + slot_index;
+
+    uint32_t timer_index = slot_heads[slot];
+    slot_heads[slot] = NONE;
+    occupied[level] &= ~(1ull << slot_index);
+
+    size_t moved = 0;
+    while (timer_index != NONE) {
+        uint32_t next = timers[timer_index].next;
+        Link(timer_index);
+        timer_index = next;
+        moved++;
+    }
+    Metrics().cascaded.Add(moved);
+}
+
+size_t TimerWheel::FireCurrentSlot() {
+    uint32_t slot = static_cast<uint32_t>(current_tick & (SLOTS - 1));
+    size_t fired = 0;
+
+    // Callbacks may schedule more timers for this tick; keep going until the slot stays empty
+    while (slot_heads[slot] != NONE) {
+        firing.clear();
+        for (uint32_t timer_index = slot_heads[slot]; timer_index != NONE; timer_index = timers[timer_index].next) {
+            firing.emplace_back(timers[timer_index].sequence, timer_index);
+        }
+        std::sort(firing.begin(), firing.end());
+
+        for (const auto& [sequence, timer_index] : firing) {
+            // An earlier callback in the batch may have cancelled this one
+            FTimer& timer = timers[timer_index];
+            if (!timer.active || timer.sequence != sequence) continue;
+
+            FCallback callback = std::move(timer.callback);
+            Unlink(timer_index);
+            Release(timer_index);
+            fired++;
+            callback();
+        }
+    }
+
+    Metrics().fired.Add(fired);
+    return fired;
+}
+
+uint64_t TimerWheel::GetNextEventTick() const {
+    uint64_t next_tick = UINT64_MAX;
+
+    // Level 0 slots fire; the current slot has just been emptied
+    if (occupied[0] != 0) {
+        uint32_t current_slot = static_cast<uint32_t>(current_tick & (SLOTS - 1));
+        next_tick = current_tick + LowestBit(RotateRight(occupied[0], current_slot));
+    }
+
+    // Higher slots cascade when the clock reaches the start of their range
+    for (int level = 1; level < LEVELS; ++level) {
+        if (occupied[level] == 0) continue;
+        int shift = SLOT_BITS * level;
+        uint64_t level_tick = current_tick >> shift;
+        uint64_t ahead = RotateRight(occupied[level], static_cast<uint32_t>(level_tick & (SLOTS - 1))) & ~1ull;
+        if (ahead == 0) continue;
+        uint64_t cascade_tick = (level_tick + LowestBit(ahead)) << shift;
+        next_tick = std::min(next_tick, cascade_tick);
+    }
+
+    return next_tick;
+}
+
+}  // namespace Nauvoo
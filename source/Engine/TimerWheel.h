@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Nauvoo {
+
+// Refers to one scheduled timer; goes stale once the timer fires or is cancelled
+struct FTimerHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != UINT32_MAX; }
+};
+
+/**
+ * Hierarchical timer wheel over an integer tick clock (game minutes, real
+ * milliseconds). Six levels of 64 slots cover 2^36 ticks ahead; a timer sits
+ * in the coarsest level it needs and cascades down as its time approaches,
+ * so scheduling and cancelling are O(1). Advance fires everything due in tick
+ * order (scheduling order within a tick) and jumps between occupied slots, so
+ * skipping a month of game time costs the timers it fires, not the minutes.
+ *
+ * Callbacks may schedule and cancel timers but must not call Advance.
+ */
+class TimerWheel {
+public:
+    using FCallback = std::function<void()>;
+
+    explicit TimerWheel(uint64_t start_tick = 0);
+    ~TimerWheel();
+
+    // A timer due at or before the current tick fires on the next Advance
+    FTimerHandle Schedule(uint64_t due_tick, FCallback callback);
+    FTimerHandle ScheduleAfter(uint64_t delay_ticks, FCallback callback) {
+        return Schedule(current_tick + delay_ticks, std::move(callback));
+    }
+    // Clears the handle; false if the timer had already fired or been cancelled
+    bool Cancel(FTimerHandle& handle);
+    bool IsPending(const FTimerHandle& handle) const;
+    uint64_t GetDueTick(const FTimerHandle& handle) const;
+
+    // Moves the clock forward to target_tick firing every timer due on the way; returns how many fired
+    size_t Advance(uint64_t target_tick);
+    // Drops every timer and restarts the clock
+    void Reset(uint64_t start_tick);
+
+    uint64_t GetCurrentTick() const { return current_tick; }
+    size_t GetPendingCount() const { return pending_count; }
+
+private:
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint32_t SLOTS = 1u << SLOT_BITS;
+    static constexpr int LEVELS = 6;
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    struct FTimer {
+        uint64_t due_tick = 0;
+        uint64_t sequence = 0;
+        FCallback callback;
+        uint32_t prev = NONE;
+        uint32_t next = NONE;
+        uint32_t slot = 0;          // level * SLOTS + index within the level
+        uint32_t generation = 0;
+        bool active = false;
+    };
+
+    std::vector<FTimer> timers;
+    std::vector<uint32_t> free_timers;
+    uint32_t slot_heads[LEVELS * SLOTS];
+    uint64_t occupied[LEVELS] = {};     // one bit per non-empty slot
+    uint64_t current_tick = 0;
+    uint64_t next_sequence = 0;
+    size_t pending_count = 0;
+    std::vector<std::pair<uint64_t, uint32_t>> firing;     // (sequence, timer) of the batch being fired
+
+    void Link(uint32_t timer_index);
+    void Unlink(uint32_t timer_index);
+    void Release(uint32_t timer_index);
+    void Cascade(int level);
+    size_t FireCurrentSlot();
+    uint64_t GetNextEventTick() const;
+};
+
+}  // namespace Nauvoo
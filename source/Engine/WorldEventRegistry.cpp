@@ -0,0 +1,91 @@
+#include "WorldEventRegistry.h"
+#include <algorithm>
+
+namespace Nauvoo {
+
+FWorldEventId WorldEventRegistry::Intern(const std::string& name) {
+    FSymbol symbol = SymbolTable::Get().Intern(name);
+    auto it = data.ids.find(symbol);
+    if (it != data.ids.end()) return it->second;
+
+    FWorldEventId id = static_cast<FWorldEventId>(data.names.size());
+    data.names.push_back(name);
+    data.ids.emplace(symbol, id);
+    data.counters.push_back(0);
+    if (data.active_bits.size() * 64 < data.names.size()) {
+        data.active_bits.push_back(0);
+        data.completed_bits.push_back(0);
+    }
+    return id;
+}
+
+FWorldEventId WorldEventRegistry::Find(const std::string& name) const {
+    FSymbol symbol = SymbolTable::Get().Find(name);
+    if (!symbol.IsValid()) return INVALID_WORLD_EVENT;
+    auto it = data.ids.find(symbol);
+    return it != data.ids.end() ? it->second : INVALID_WORLD_EVENT;
+}
+
+bool WorldEventRegistry::Trigger(FWorldEventId id) {
+    if (!AssignBit(data.active_bits, id, true)) return false;
+    data.active_count++;
+    Notify(id, EWorldEventChange::TRIGGERED);
+    return true;
+}
+
+bool WorldEventRegistry::Complete(FWorldEventId id) {
+    if (!IsActive(id)) return false;
+    AssignBit(data.active_bits, id, false);
+    data.active_count--;
+    if (AssignBit(data.completed_bits, id, true)) data.completed_count++;
+    Notify(id, EWorldEventChange::COMPLETED);
+    return true;
+}
+
+int WorldEventRegistry::AddToCounter(FWorldEventId id, int delta) {
+    SetCounter(id, data.counters[id] + delta);
+    return data.counters[id];
+}
+
+void WorldEventRegistry::SetCounter(FWorldEventId id, int value) {
+    if (data.counters[id] == value) return;
+    data.counters[id] = value;
+    Notify(id, EWorldEventChange::COUNTER);
+}
+
+void WorldEventRegistry::ResetState() {
+    std::fill(data.active_bits.begin(), data.active_bits.end(), 0);
+    std::fill(data.completed_bits.begin(), data.completed_bits.end(), 0);
+    std::fill(data.counters.begin(), data.counters.end(), 0);
+    data.active_count = 0;
+    data.completed_count = 0;
+}
+
+std::vector<FWorldEventId> WorldEventRegistry::GetActiveEvents() const {
+    std::vector<FWorldEventId> active;
+    active.reserve(data.active_count);
+    for (size_t word = 0; word < data.active_bits.size(); ++word) {
+        for (uint64_t bits = data.active_bits[word]; bits != 0; bits &= bits - 1) {
+            int bit = 0;
+            while (((bits >> bit) & 1) == 0) bit++;
+            active.push_back(static_cast<FWorldEventId>(word * 64 + bit));
+        }
+    }
+    return active;
+}
+
+bool WorldEventRegistry::AssignBit(std::vector<uint64_t>& bits, FWorldEventId id, bool value) {
+    uint64_t mask = 1ull << (id % 64);
+    uint64_t& word = bits[id / 64];
+    if (((word & mask) != 0) == value) return false;
+    word = value ? word | mask : word & ~mask;
+    return true;
+}
+
+void WorldEventRegistry::Notify(FWorldEventId id, EWorldEventChange change) const {
+    for (const FListener& listener : listeners) {
+        listener(id, change);
+    }
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "FlatMap.h"
+#include "Symbol.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Nauvoo {
+
+using FWorldEventId = uint32_t;
+constexpr FWorldEventId INVALID_WORLD_EVENT = UINT32_MAX;
+
+enum class EWorldEventChange : uint8_t {
+    TRIGGERED,
+    COMPLETED,
+    COUNTER
+};
+
+/**
+ * World event state (active, completed, counters) keyed by interned ids.
+ * Intern a name once and keep the id: flag checks are then a bit test and
+ * counters an array index. Listeners hear about every change as it happens;
+ * copies carry the state but not the listeners.
+ */
+class WorldEventRegistry {
+public:
+    using FListener = std::function<void(FWorldEventId id, EWorldEventChange change)>;
+
+    WorldEventRegistry() = default;
+    WorldEventRegistry(const WorldEventRegistry& other) : data(other.data) {}
+    WorldEventRegistry& operator=(const WorldEventRegistry& other) {
+        data = other.data;
+        return *this;
+    }
+
+    // Ids are dense and stable for the registry's lifetime
+    FWorldEventId Intern(const std::string& name);
+    FWorldEventId Find(const std::string& name) const;
+    const std::string& GetName(FWorldEventId id) const { return data.names[id]; }
+    size_t GetEventCount() const { return data.names.size(); }
+
+    // Trigger sets active; Complete moves an active event to completed. Both report whether anything changed
+    bool Trigger(FWorldEventId id);
+    bool Complete(FWorldEventId id);
+
+    bool IsActive(FWorldEventId id) const { return TestBit(data.active_bits, id); }
+    bool IsCompleted(FWorldEventId id) const { return TestBit(data.completed_bits, id); }
+    size_t GetActiveCount() const { return data.active_count; }
+    size_t GetCompletedCount() const { return data.completed_count; }
+
+    int GetCounter(FWorldEventId id) const { return id < data.counters.size() ? data.counters[id] : 0; }
+    int AddToCounter(FWorldEventId id, int delta);
+    void SetCounter(FWorldEventId id, int value);
+
+    // Bit words for saving: bit i of word i / 64 is event id i
+    const std::vector<uint64_t>& GetActiveBits() const { return data.active_bits; }
+    const std::vector<uint64_t>& GetCompletedBits() const { return data.completed_bits; }
+    const std::vector<int32_t>& GetCounters() const { return data.counters; }
+    std::vector<FWorldEventId> GetActiveEvents() const;
+
+    void AddListener(FListener listener) { listeners.push_back(std::move(listener)); }
+    // Clears every flag and counter without notifying; interned ids stay valid
+    void ResetState();
+
+private:
+    struct FData {
+        std::vector<std::string> names;
+        TFlatHashMap<FSymbol, FWorldEventId> ids;
+        std::vector<uint64_t> active_bits;
+        std::vector<uint64_t> completed_bits;
+        std::vector<int32_t> counters;
+        size_t active_count = 0;
+        size_t completed_count = 0;
+    };
+
+    FData data;
+    std::vector<FListener> listeners;
+
+    static bool TestBit(const std::vector<uint64_t>& bits, FWorldEventId id) {
+        size_t word = id / 64;
+        return word < bits.size() && (bits[word] >> (id % 64)) & 1;
+    }
+    static bool AssignBit(std::vector<uint64_t>& bits, FWorldEventId id, bool value);
+    void Notify(FWorldEventId id, EWorldEventChange change) const;
+};
+
+}  // namespace Nauvoo
@@ -0,0 +1,165 @@
+#include "../Systems/CombatAI.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Nauvoo {
+
+namespace {
+
+constexpr float CURRENT_ACTION_BONUS = 1.15f;   // score multiplier of the decision being kept
+
+// Value selects rather than std::clamp, so the loops below stay vectorizable
+inline float Clamp01(float value) {
+    value = value < 0.0f ? 0.0f : value;
+    return value > 1.0f ? 1.0f : value;
+}
+
+inline float Linear(float x, float slope, float x_shift, float y_shift) {
+    return Clamp01(slope * (x - x_shift) + y_shift);
+}
+
+inline float Quadratic(float x, float slope, float x_shift, float y_shift) {
+    float d = x - x_shift;
+    return Clamp01(slope * d * d + y_shift);
+}
+
+// Rational S-curve; close enough to a logistic and needs no exp
+inline float Logistic(float x, float slope, float x_shift, float y_shift) {
+    float k = slope * (x - x_shift);
+    return Clamp01(0.5f + 0.5f * k / (1.0f + std::fabs(k)) + y_shift);
+}
+
+// Multiplies the curve's response into each score; one loop per shape so none branches inside
+void ApplyCurve(const FResponseCurve& curve, const float* __restrict x, float* __restrict score, size_t begin, size_t end) {
+    const float slope = curve.slope;
+    const float x_shift = curve.x_shift;
+    const float y_shift = curve.y_shift;
+    switch (curve.shape) {
+        case ECurveShape::LINEAR:
+            for (size_t i = begin; i < end; ++i) score[i] *= Linear(x[i], slope, x_shift, y_shift);
+            break;
+        case ECurveShape::QUADRATIC:
+            for (size_t i = begin; i < end; ++i) score[i] *= Quadratic(x[i], slope, x_shift, y_shift);
+            break;
+        case ECurveShape::LOGISTIC:
+            for (size_t i = begin; i < end; ++i) score[i] *= Logistic(x[i], slope, x_shift, y_shift);
+            break;
+    }
+}
+
+// A product of several scores sinks towards zero, so it is made up in proportion to how many were multiplied
+void FinishScores(float weight, float makeup, float* __restrict score, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        score[i] = (score[i] + score[i] * (1.0f - score[i]) * makeup) * weight;
+    }
+}
+
+FConsiderationCurve Curve(EConsideration input, ECurveShape shape, float slope, float x_shift = 0.0f, float y_shift = 0.0f) {
+    FConsiderationCurve consideration;
+    consideration.input = input;
+    consideration.curve.shape = shape;
+    consideration.curve.slope = slope;
+    consideration.curve.x_shift = x_shift;
+    consideration.curve.y_shift = y_shift;
+    return consideration;
+}
+
+std::vector<FUtilityAction> MakeDefaultCombatActions() {
+    using C = EConsideration;
+    using S = ECurveShape;
+    return {
+        // Fire from where they stand: needs a charge, better close and from cover, not when failing
+        { ECombatAction::ENGAGE, 1.0f, {
+            Curve(C::LOADED, S::LOGISTIC, 50.0f, 0.1f),
+            Curve(C::ENEMY_DISTANCE, S::LINEAR, -0.6f, 0.0f, 1.0f),
+            Curve(C::COVER, S::LINEAR, 0.3f, 0.0f, 0.7f),
+            Curve(C::HEALTH, S::LOGISTIC, 8.0f, 0.2f) } },
+        // Close a distant enemy, when fit, spirited and not outnumbered
+        { ECombatAction::ADVANCE, 0.9f, {
+            Curve(C::ENEMY_DISTANCE, S::LINEAR, 1.0f),
+            Curve(C::AGGRESSION, S::LINEAR, 0.8f, 0.0f, 0.2f),
+            Curve(C::ALLY_SHARE, S::LOGISTIC, 6.0f, 0.4f),
+            Curve(C::HEALTH, S::LOGISTIC, 8.0f, 0.5f) } },
+        // Get out of the open, most of all when wounded but still able to fight on
+        { ECombatAction::TAKE_COVER, 0.8f, {
+            Curve(C::COVER, S::LINEAR, -1.0f, 0.0f, 1.0f),
+            Curve(C::HEALTH, S::QUADRATIC, -2.5f, 0.5f, 1.0f),
+            Curve(C::ENEMY_DISTANCE, S::LINEAR, -0.5f, 0.0f, 1.0f),
+            Curve(C::AGGRESSION, S::LINEAR, -0.5f, 0.0f, 1.0f) } },
+        // An empty weapon, preferably reloaded behind something
+        { ECombatAction::RELOAD, 1.0f, {
+            Curve(C::LOADED, S::QUADRATIC, 1.0f, 1.0f),
+            Curve(C::COVER, S::LINEAR, 0.4f, 0.0f, 0.6f) } },
+        // Badly hurt, alone, frightened or never wanting the fight
+        { ECombatAction::RETREAT, 1.3f, {
+            Curve(C::HEALTH, S::LOGISTIC, -12.0f, 0.3f),
+            Curve(C::ALLY_SHARE, S::LINEAR, -0.5f, 0.0f, 1.0f),
+            Curve(C::AGGRESSION, S::LINEAR, -0.5f, 0.0f, 1.0f),
+            Curve(C::FEAR, S::LINEAR, 0.5f, 0.0f, 0.5f) } }
+    };
+}
+
+}  // namespace
+
+float FResponseCurve::Evaluate(float x) const {
+    switch (shape) {
+        case ECurveShape::LINEAR: return Linear(x, slope, x_shift, y_shift);
+        case ECurveShape::QUADRATIC: return Quadratic(x, slope, x_shift, y_shift);
+        case ECurveShape::LOGISTIC: return Logistic(x, slope, x_shift, y_shift);
+    }
+    return 0.0f;
+}
+
+void FCombatantBatch::Resize(size_t count, size_t action_count) {
+    npcs.resize(count);
+    ids.resize(count);
+    for (std::vector<float>& input : inputs) input.resize(count);
+    current.resize(count);
+    targets.resize(count);
+    scores.resize(count * action_count);
+    decision.resize(count);
+}
+
+const std::vector<FUtilityAction>& GetDefaultCombatActions() {
+    static const std::vector<FUtilityAction> actions = MakeDefaultCombatActions();
+    return actions;
+}
+
+float GetFactionAggression(EFaction faction) {
+    switch (faction) {
+        case EFaction::LDS_CIVILIAN: return 0.2f;
+        case EFaction::LEGION_SOLDIER: return 0.6f;
+        case EFaction::OUTSIDER: return 0.7f;
+        case EFaction::NEUTRAL: return 0.3f;
+    }
+    return 0.5f;
+}
+
+void EvaluateCombatActions(const std::vector<FUtilityAction>& actions, FCombatantBatch& batch, size_t begin, size_t end) {
+    for (size_t a = 0; a < actions.size(); ++a) {
+        const FUtilityAction& action = actions[a];
+        float* score = batch.GetScores(a);
+        std::fill(score + begin, score + end, 1.0f);
+        for (const FConsiderationCurve& consideration : action.considerations) {
+            ApplyCurve(consideration.curve, batch.GetInput(consideration.input), score, begin, end);
+        }
+        float makeup = action.considerations.empty() ? 0.0f : 1.0f - 1.0f / static_cast<float>(action.considerations.size());
+        FinishScores(action.weight, makeup, score, begin, end);
+    }
+
+    // The decision being kept gets a bonus, so close scores do not flicker
+    for (size_t i = begin; i < end; ++i) {
+        float best_score = -1.0f;
+        ECombatAction best = ECombatAction::NONE;
+        for (size_t a = 0; a < actions.size(); ++a) {
+            float score = batch.GetScores(a)[i] * (actions[a].action == batch.current[i] ? CURRENT_ACTION_BONUS : 1.0f);
+            if (score > best_score) {
+                best_score = score;
+                best = actions[a].action;
+            }
+        }
+        batch.decision[i] = best;
+    }
+}
+
+}  // namespace Nauvoo
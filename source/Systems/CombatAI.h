@@ -0,0 +1,89 @@
+#pragma once
+
+#include "../Engine/CoreTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace Nauvoo {
+
+// What a combatant weighs, each gathered normalized to [0, 1]
+enum class EConsideration : uint8_t {
+    HEALTH,             // fraction of max health left
+    LOADED,             // rounds left over capacity; 1 for melee weapons and the unarmed, 0 while reloading
+    ENEMY_DISTANCE,     // to the centre of the enemy sides, over COMBAT_AI_FAR_DISTANCE
+    COVER,              // 1 when behind cover
+    ALLY_SHARE,         // the combatant's side's share of everyone still fighting in the encounter
+    FEAR,               // of the player when the player fights on another side, or the crowd's (CrowdMorale)
+    AGGRESSION,         // temperament of the combatant's faction
+    COUNT
+};
+
+constexpr size_t CONSIDERATION_COUNT = static_cast<size_t>(EConsideration::COUNT);
+constexpr float COMBAT_AI_FAR_DISTANCE = 150.0f;   // metres at which the enemy counts as far away
+
+enum class ECurveShape : uint8_t {
+    LINEAR,             // slope * (x - x_shift) + y_shift
+    QUADRATIC,          // slope * (x - x_shift)^2 + y_shift
+    LOGISTIC            // S-curve through 0.5 at x_shift, steeper with slope, raised by y_shift
+};
+
+// Maps a consideration onto a score in [0, 1]
+struct FResponseCurve {
+    ECurveShape shape = ECurveShape::LINEAR;
+    float slope = 1.0f;
+    float x_shift = 0.0f;
+    float y_shift = 0.0f;
+
+    float Evaluate(float x) const;
+};
+
+struct FConsiderationCurve {
+    EConsideration input = EConsideration::HEALTH;
+    FResponseCurve curve;
+};
+
+// An action scores the product of its curves, scaled by its weight
+struct FUtilityAction {
+    ECombatAction action = ECombatAction::ENGAGE;
+    float weight = 1.0f;
+    std::vector<FConsiderationCurve> considerations;
+};
+
+/**
+ * Combatants being replanned, one array per consideration and per action
+ * score so each curve is a single pass over a column. The gatherer fills
+ * npcs, ids, inputs, current and targets; evaluation fills scores and
+ * decision.
+ */
+struct FCombatantBatch {
+    std::vector<uint32_t> npcs;             // index into the NPC list
+    std::vector<FSymbol> ids;
+    std::vector<float> inputs[CONSIDERATION_COUNT];
+    std::vector<ECombatAction> current;     // decision being kept, which scores a little higher
+    std::vector<FVector3> targets;          // centre of the enemy sides
+
+    std::vector<float> scores;              // one column of GetCount() per action, in action order
+    std::vector<ECombatAction> decision;
+
+    void Resize(size_t count, size_t action_count);
+    size_t GetCount() const { return npcs.size(); }
+    float* GetInput(EConsideration input) { return inputs[static_cast<size_t>(input)].data(); }
+    float* GetScores(size_t action) { return scores.data() + action * GetCount(); }
+};
+
+// ENGAGE, ADVANCE, TAKE_COVER, RELOAD and RETREAT with their considerations
+const std::vector<FUtilityAction>& GetDefaultCombatActions();
+
+// Aggression consideration of a faction: soldiers stand, civilians break
+float GetFactionAggression(EFaction faction);
+
+/**
+ * Scores every action for combatants [begin, end) and keeps the best in
+ * decision. Each consideration curve runs over its whole input column, so
+ * the scoring is straight-line arithmetic with no per-combatant branching;
+ * only the final pick compares action by action. The batch must be sized
+ * for these actions.
+ */
+void EvaluateCombatActions(const std::vector<FUtilityAction>& actions, FCombatantBatch& batch, size_t begin, size_t end);
+
+}  // namespace Nauvoo
@@ -1,203 +1,710 @@
 #include "../Systems/CombatSystem.h"
 #include "ReputationManager.h"
+#include "WeaponRegistry.h"
+#include "../Engine/EventBus.h"
+#include "../Engine/Log.h"
+#include "../Engine/Metrics.h"
+#include "../Engine/Random.h"
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 
 namespace Nauvoo {
 
-CombatSystem::CombatSystem(ReputationManager* reputation_mgr)
-    : reputation_manager(reputation_mgr) {
+namespace {
+
+struct FCombatMetrics {
+    MetricCounter& engagements = MetricsRegistry::Get().GetCounter("combat.engagements");
+    MetricGauge& in_combat = MetricsRegistry::Get().GetGauge("combat.in_combat");
+    MetricCounter& shots_fired = MetricsRegistry::Get().GetCounter("combat.shots_fired");
+    MetricCounter& hits = MetricsRegistry::Get().GetCounter("combat.hits");
+    MetricCounter& injuries_inflicted = MetricsRegistry::Get().GetCounter("combat.injuries_inflicted");
+    MetricCounter& injuries_treated = MetricsRegistry::Get().GetCounter("combat.injuries_treated");
+    MetricCounter& deaths = MetricsRegistry::Get().GetCounter("combat.deaths");
+    MetricGauge& npcs_bleeding = MetricsRegistry::Get().GetGauge("combat.npcs_bleeding");
+    MetricCounter& deaths_scheduled = MetricsRegistry::Get().GetCounter("combat.deaths_scheduled");
+    MetricCounter& misfires = MetricsRegistry::Get().GetCounter("combat.misfires");
+    MetricCounter& reloads = MetricsRegistry::Get().GetCounter("combat.reloads");
+    MetricGauge& armed_characters = MetricsRegistry::Get().GetGauge("combat.armed_characters");
+    MetricHistogram& volley_size = MetricsRegistry::Get().GetHistogram("combat.volley_size");
+    MetricCounter& ai_replans = MetricsRegistry::Get().GetCounter("combat.ai_replans");
+    MetricCounter& retreats = MetricsRegistry::Get().GetCounter("combat.retreats");
+};
+
+FCombatMetrics& Metrics() {
+    static FCombatMetrics metrics;
+    return metrics;
 }
 
-CombatSystem::~CombatSystem() = default;
+}  // namespace
 
-void CombatSystem::StartCombat(const std::string& enemy_npc_id, FNPC& enemy, FPlayerState& player) {
-    in_combat = true;
-    current_enemy_id = enemy_npc_id;
-    combat_timeout = 30.0f;
-    
-    enemy.is_in_combat = true;
+CombatSystem::CombatSystem(ReputationManager* reputation_mgr, RandomService* random_svc)
+    : reputation_manager(reputation_mgr), random_service(random_svc) {
+    Metrics();
+}
+
+CombatSystem::~CombatSystem() {
+    if (in_combat) Metrics().in_combat.Add(-1);
+    Metrics().npcs_bleeding.Add(-bleeding_npcs);
+    Metrics().armed_characters.Add(-static_cast<int64_t>(weapon_states.size()));
+}
+
+void CombatSystem::StartCombat(std::vector<FNPC>& npcs, uint32_t enemy_index) {
+    if (enemy_index >= npcs.size()) return;
+    FNPC& enemy = npcs[enemy_index];
+    FSymbol enemy_id = enemy.symbol;
+    Metrics().engagements.Add();
+
+    // Sides only need to differ; the player takes side 0 unless already placed
+    FEncounterId encounter = encounters.GetEncounterOf(enemy_id);
+    if (encounter == INVALID_ENCOUNTER) encounter = encounters.GetEncounterOf(PLAYER_SYMBOL);
+    if (encounter == INVALID_ENCOUNTER) encounter = encounters.StartEncounter(clock_seconds);
+    uint8_t player_side = encounters.GetEncounterOf(PLAYER_SYMBOL) == encounter ? encounters.GetSide(PLAYER_SYMBOL) : 0;
+    uint8_t enemy_side = encounters.GetEncounterOf(enemy_id) == encounter ? encounters.GetSide(enemy_id) : 1;
+    if (enemy_side == player_side) {
+        if (encounters.GetEncounterOf(PLAYER_SYMBOL) == encounter) enemy_side = player_side == 0 ? 1 : 0;
+        else player_side = enemy_side == 0 ? 1 : 0;
+    }
+    encounters.JoinPlayer(encounter, player_side);
+    encounters.Join(encounter, enemy_side, npcs, enemy_index);
+    encounters.MarkActive(encounter, clock_seconds);
+
+    SyncPlayerEngagement();
+    if (event_bus) event_bus->Publish(FCombatStateEvent{ enemy_id, true });
     
-    std::cout << "[CombatSystem] Combat started with " << enemy.name << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] Combat started with ", enemy.name);
 }
 
-void CombatSystem::EndCombat() {
-    in_combat = false;
-    current_enemy_id.clear();
-    std::cout << "[CombatSystem] Combat ended" << std::endl;
+void CombatSystem::EndCombat(std::vector<FNPC>& npcs) {
+    encounters.EndEncounter(encounters.GetEncounterOf(PLAYER_SYMBOL), npcs);
+    SyncPlayerEngagement();
+}
+
+void CombatSystem::UpdateEncounters(std::vector<FNPC>& npcs, const FPlayerState& player) {
+    encounters.Update(npcs, !IsCharacterDead(player), clock_seconds);
+    for (const FEncounterEnd& end : encounters.GetEnded()) {
+        NAUVOO_LOG_DEBUG(ELogCategory::COMBAT, "[CombatSystem] Encounter ", end.id,
+                         end.reason == EEncounterEnd::TIMED_OUT ? " timed out" : " resolved");
+    }
+    SyncPlayerEngagement();
+}
+
+void CombatSystem::SyncPlayerEngagement() {
+    bool engaged = IsInCombat();
+    if (engaged == in_combat) return;
+
+    in_combat = engaged;
+    Metrics().in_combat.Add(engaged ? 1 : -1);
+    if (!engaged) {
+        if (event_bus) event_bus->Publish(FCombatStateEvent{ FSymbol(), false });
+        NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] Combat ended");
+    }
 }
 
 void CombatSystem::FireWeapon(FPlayerState& player, const FVector3& target_position,
                             std::vector<FNPC>& all_npcs, const std::string& enemy_npc_id) {
-    if (!in_combat) {
-        std::cout << "[CombatSystem] Not in combat, cannot fire" << std::endl;
+    if (!IsInCombat()) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[CombatSystem] Not in combat, cannot fire");
         return;
     }
 
-    // Get player's weapon
-    FWeapon* weapon = nullptr;
-    // Would get from inventory - for MVP, assume musket
-    FWeapon musket;
-    musket.name = "Musket";
-    musket.accuracy = 0.7f;
-    musket.damage = 40.0f;
-    musket.stamina_cost = 15.0f;
-    
-    // Check ammunition
-    if (musket.current_ammo <= 0) {
-        std::cout << "[CombatSystem] Out of ammunition" << std::endl;
+    FWeaponArchetypeId equipped = GetEquippedArchetype(player);
+    if (equipped == INVALID_WEAPON_ARCHETYPE) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[CombatSystem] Unknown weapon: ", player.equipped_weapon_id);
+        return;
+    }
+    auto enemy = std::find_if(all_npcs.begin(), all_npcs.end(), [&](const FNPC& npc) { return npc.id == enemy_npc_id; });
+    if (enemy == all_npcs.end()) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[CombatSystem] No target to fire at: ", enemy_npc_id);
         return;
     }
 
-    // Calculate accuracy
-    float accuracy = CalculateAccuracy(player, EStance::STANDING);
-    
-    // Perform hit check (simplified)
-    if (rand() % 100 < (accuracy * 100)) {
-        // Hit
-        EBodyPart hit_location = EBodyPart::TORSO;
-        ApplyDamage(player, musket.damage, hit_location, "player");
-        
-        std::cout << "[CombatSystem] Hit! Dealt " << musket.damage << " damage" << std::endl;
-    } else {
-        std::cout << "[CombatSystem] Miss!" << std::endl;
+    // Switching weapons arms the player with a fresh one
+    const FWeaponState* carried = GetWeaponState(PLAYER_SYMBOL);
+    if (!carried || carried->archetype != equipped) {
+        EquipArchetype(PLAYER_SYMBOL, equipped);
+        carried = GetWeaponState(PLAYER_SYMBOL);
+    }
+    if (carried->IsReloading()) {
+        NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] Still reloading");
+        return;
     }
+    if (carried->cooldown > 0.0f) return;
 
-    // Reduce ammunition
-    musket.current_ammo--;
+    single_shot.Clear();
+    single_shot.AddShot(PLAYER_SYMBOL, player.position, player.stance, static_cast<uint32_t>(enemy - all_npcs.begin()),
+                        enemy->position, GetFatigueAccuracy(player));
+    FVolleyResult result = FireVolley(single_shot, all_npcs, player);
+    if (result.misfired > 0) {
+        NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] Misfire!");
+    } else if (result.hits > 0) {
+        NAUVOO_LOG_DEBUG(ELogCategory::COMBAT, "[CombatSystem] Hit!");
+    } else {
+        NAUVOO_LOG_DEBUG(ELogCategory::COMBAT, "[CombatSystem] Miss!");
+    }
     
     // Apply stamina cost
-    player.stamina -= musket.stamina_cost;
+    player.stamina -= weapon_registry->Get(equipped).stamina_cost;
     if (player.stamina < 0) player.stamina = 0;
 }
 
+FVolleyResult CombatSystem::FireVolley(const FVolley& volley, std::vector<FNPC>& npcs, FPlayerState& player) {
+    FVolleyResult result;
+    const size_t count = volley.GetCount();
+    if (count == 0 || !weapon_registry) return result;
+    Metrics().volley_size.Record(count);
+
+    // Weapons discharge in shot order; shots that do not fire keep zero accuracy and cannot hit
+    shot_batch.Resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        EWeaponDischarge discharge = DischargeWeapon(volley.shooters[i]);
+        if (discharge == EWeaponDischarge::FIRED || discharge == EWeaponDischarge::MISFIRED) {
+            encounters.MarkActive(volley.shooters[i], clock_seconds);
+        }
+        if (discharge == EWeaponDischarge::FIRED) {
+            const FWeaponArchetype& weapon = weapon_registry->Get(FindWeapon(volley.shooters[i])->archetype);
+            shot_batch.accuracy[i] = weapon.accuracy * GetStanceAccuracy(volley.stances[i]) * volley.aim[i];
+            shot_batch.range[i] = std::max(weapon.range, 1.0f);     // the resolver divides by it
+            shot_batch.damage[i] = weapon.damage;
+            result.fired++;
+            if (event_bus) {
+                event_bus->Publish(FGunfireEvent{ volley.shooters[i], { volley.shooter_x[i], volley.shooter_y[i], volley.shooter_z[i] } });
+            }
+        } else {
+            shot_batch.accuracy[i] = 0.0f;
+            shot_batch.range[i] = 1.0f;
+            shot_batch.damage[i] = 0.0f;
+            if (discharge == EWeaponDischarge::MISFIRED) result.misfired++;
+        }
+    }
+    if (result.fired + result.misfired == 0) return result;
+
+    // Every roll is drawn up front on the seeded combat stream, so the resolve pass is pure arithmetic
+    FRandomStream& rolls = random_service->GetStream(ERandomStream::COMBAT);
+    rolls.FillUniform(shot_batch.hit_roll.data(), count);
+    rolls.FillUniform(shot_batch.lateral_roll.data(), count);
+    rolls.FillUniform(shot_batch.height_roll.data(), count);
+
+    // Hits are recorded per chunk and applied afterwards, so every shot resolves against the same world
+    auto resolve = [this, &volley](size_t chunk, size_t begin, size_t end) {
+        ResolveShots(volley, shot_batch, begin, end);
+        for (size_t i = begin; i < end; ++i) {
+            if (shot_batch.hit[i]) {
+                shot_damage.Push(chunk, { volley.targets[i], shot_batch.body_part[i], shot_batch.hit_damage[i], volley.shooters[i] });
+            }
+        }
+    };
+    shot_damage.Reset(JobSystem::GetChunkCount(count, SHOTS_PER_JOB));
+    if (job_system) {
+        job_system->ParallelFor(count, SHOTS_PER_JOB, resolve);
+    } else {
+        for (size_t begin = 0, chunk = 0; begin < count; begin += SHOTS_PER_JOB, ++chunk) {
+            resolve(chunk, begin, std::min(count, begin + SHOTS_PER_JOB));
+        }
+    }
+
+    SymbolTable& symbols = SymbolTable::Get();
+    shot_damage.Apply([&](const FShotDamage& shot) {
+        if (shot.target == VOLLEY_TARGET_PLAYER) {
+            ApplyDamage(player, shot.damage, shot.body_part, symbols.GetName(shot.shooter));
+        } else if (shot.target < npcs.size() && npcs[shot.target].is_alive) {
+            ApplyDamageToNPC(npcs[shot.target], shot.damage, shot.body_part, symbols.GetName(shot.shooter));
+        } else {
+            return;   // an earlier ball in the volley already killed the target
+        }
+        result.hits++;
+        Metrics().hits.Add();
+    });
+
+    return result;
+}
+
+bool CombatSystem::EquipWeapon(FSymbol character_id, FSymbol weapon_id) {
+    FWeaponArchetypeId archetype = weapon_registry ? weapon_registry->Find(weapon_id) : INVALID_WEAPON_ARCHETYPE;
+    if (archetype == INVALID_WEAPON_ARCHETYPE) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[CombatSystem] Unknown weapon: ", SymbolTable::Get().GetName(weapon_id));
+        return false;
+    }
+    EquipArchetype(character_id, archetype);
+    return true;
+}
+
+void CombatSystem::EquipArchetype(FSymbol character_id, FWeaponArchetypeId archetype) {
+    FWeaponState state;
+    state.archetype = archetype;
+    state.ammo = static_cast<uint16_t>(weapon_registry->Get(archetype).max_ammo);
+
+    auto inserted = weapon_slots.try_emplace(character_id, static_cast<uint32_t>(weapon_states.size()));
+    if (!inserted.second) {
+        weapon_states[inserted.first->second] = state;
+        return;
+    }
+    weapon_states.push_back(state);
+    weapon_owners.push_back(character_id);
+    Metrics().armed_characters.Add(1);
+}
+
+void CombatSystem::UnequipWeapon(FSymbol character_id) {
+    auto it = weapon_slots.find(character_id);
+    if (it == weapon_slots.end()) return;
+
+    uint32_t slot = it->second;
+    weapon_slots.erase(it);
+    uint32_t last = static_cast<uint32_t>(weapon_states.size() - 1);
+    if (slot != last) {
+        weapon_states[slot] = weapon_states[last];
+        weapon_owners[slot] = weapon_owners[last];
+        weapon_slots[weapon_owners[slot]] = slot;
+    }
+    weapon_states.pop_back();
+    weapon_owners.pop_back();
+    Metrics().armed_characters.Add(-1);
+}
+
+void CombatSystem::ClearWeapons() {
+    Metrics().armed_characters.Add(-static_cast<int64_t>(weapon_states.size()));
+    weapon_states.clear();
+    weapon_owners.clear();
+    weapon_slots.clear();
+    weapons_busy = false;
+}
+
+const FWeaponState* CombatSystem::GetWeaponState(FSymbol character_id) const {
+    auto it = weapon_slots.find(character_id);
+    return it != weapon_slots.end() ? &weapon_states[it->second] : nullptr;
+}
+
+FWeaponState* CombatSystem::FindWeapon(FSymbol character_id) {
+    auto it = weapon_slots.find(character_id);
+    return it != weapon_slots.end() ? &weapon_states[it->second] : nullptr;
+}
+
+EWeaponDischarge CombatSystem::DischargeWeapon(FSymbol character_id) {
+    FWeaponState* weapon = FindWeapon(character_id);
+    if (!weapon) return EWeaponDischarge::UNARMED;
+    if (weapon->IsReloading()) return EWeaponDischarge::RELOADING;
+    if (weapon->cooldown > 0.0f) return EWeaponDischarge::COOLING_DOWN;
+
+    const FWeaponArchetype& archetype = weapon_registry->Get(weapon->archetype);
+    weapon->cooldown = archetype.fire_rate;
+    weapons_busy = true;
+
+    // Melee weapons have no charge to misfire or spend
+    if (archetype.max_ammo > 0) {
+        float misfire_chance = archetype.misfire_chance + weapon->fouling * FOULING_MISFIRE_CHANCE;
+        if (random_service->GetStream(ERandomStream::COMBAT).Chance(misfire_chance)) {
+            Metrics().misfires.Add();
+            return EWeaponDischarge::MISFIRED;
+        }
+        weapon->ammo--;
+        weapon->fouling = std::min(1.0f, weapon->fouling + archetype.fouling_per_shot);
+        if (weapon->ammo == 0) StartReload(*weapon);
+    }
+
+    Metrics().shots_fired.Add();
+    return EWeaponDischarge::FIRED;
+}
+
+void CombatSystem::ReloadWeapon(FSymbol character_id) {
+    FWeaponState* weapon = FindWeapon(character_id);
+    if (!weapon || weapon->IsReloading()) return;
+    if (weapon->ammo < weapon_registry->Get(weapon->archetype).max_ammo) StartReload(*weapon);
+}
+
+void CombatSystem::CleanWeapon(FSymbol character_id) {
+    if (FWeaponState* weapon = FindWeapon(character_id)) weapon->fouling = 0.0f;
+}
+
+void CombatSystem::StartReload(FWeaponState& weapon) {
+    const FWeaponArchetype& archetype = weapon_registry->Get(weapon.archetype);
+    Metrics().reloads.Add();
+    if (archetype.reload_time <= 0.0f) {
+        weapon.ammo = static_cast<uint16_t>(archetype.max_ammo);
+        return;
+    }
+    weapon.reload_remaining = archetype.reload_time;
+    weapons_busy = true;
+}
+
+void CombatSystem::AdvanceWeapons(float delta_time) {
+    if (!weapons_busy) return;
+
+    bool still_busy = false;
+    for (FWeaponState& weapon : weapon_states) {
+        weapon.cooldown = std::max(0.0f, weapon.cooldown - delta_time);
+        if (weapon.reload_remaining > 0.0f) {
+            weapon.reload_remaining -= delta_time;
+            if (weapon.reload_remaining <= 0.0f) {
+                weapon.reload_remaining = 0.0f;
+                weapon.ammo = static_cast<uint16_t>(weapon_registry->Get(weapon.archetype).max_ammo);
+            }
+        }
+        still_busy |= weapon.cooldown > 0.0f || weapon.reload_remaining > 0.0f;
+    }
+    weapons_busy = still_busy;
+}
+
+FWeaponArchetypeId CombatSystem::GetEquippedArchetype(const FPlayerState& player) const {
+    if (!weapon_registry) return INVALID_WEAPON_ARCHETYPE;
+    if (player.equipped_weapon_id.empty()) return weapon_registry->GetDefault();
+    return weapon_registry->Find(player.equipped_weapon_id);
+}
+
 void CombatSystem::ApplyDamage(FPlayerState& target, float damage, EBodyPart hit_location,
                               const std::string& attacker_id) {
     target.health -= damage;
     
     FInjury injury;
     injury.location = hit_location;
-    injury.severity = static_cast<int>(damage / 10.0f);
+    injury.severity = static_cast<uint8_t>(std::clamp(static_cast<int>(damage / 10.0f), 0, MAX_INJURY_SEVERITY));
     injury.type = EInjuryType::GUNSHOT;
-    injury.bleed_rate = GetBleedRate(injury.type, injury.severity);
+    injury.SetBleedRate(GetBleedRate(injury.type, injury.severity));
+    injury.wounded_minute = GetGameMinute();
     
     target.injuries.push_back(injury);
+    RefreshBleeding(target);
+    ScheduleInfectionCheck(target, target.injuries.size() - 1);
+    PublishInjury(PLAYER_SYMBOL, injury);
+    Metrics().injuries_inflicted.Add();
     
-    std::cout << "[CombatSystem] Player health: " << target.health << "/" << target.max_health << std::endl;
+    NAUVOO_LOG_DEBUG(ELogCategory::COMBAT, "[CombatSystem] Player health: ", target.health, "/", target.max_health);
     
     if (target.health <= 0) {
-        std::cout << "[CombatSystem] Player defeated!" << std::endl;
+        NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] Player defeated!");
     }
 }
 
 void CombatSystem::ApplyDamageToNPC(FNPC& target, float damage, EBodyPart hit_location,
                                    const std::string& attacker_id) {
+    SettleNPCHealth(target);
     target.health -= damage;
     
     FInjury injury;
     injury.location = hit_location;
-    injury.severity = static_cast<int>(damage / 10.0f);
+    injury.severity = static_cast<uint8_t>(std::clamp(static_cast<int>(damage / 10.0f), 0, MAX_INJURY_SEVERITY));
     injury.type = EInjuryType::GUNSHOT;
-    injury.bleed_rate = GetBleedRate(injury.type, injury.severity);
+    injury.SetBleedRate(GetBleedRate(injury.type, injury.severity));
+    injury.wounded_minute = GetGameMinute();
     
     target.injuries.push_back(injury);
+    PublishInjury(target.symbol, injury);
+    Metrics().injuries_inflicted.Add();
     
-    std::cout << "[CombatSystem] " << target.name << " health: " << target.health << "/" << target.max_health << std::endl;
+    NAUVOO_LOG_DEBUG(ELogCategory::COMBAT, "[CombatSystem] ", target.name, " health: ", target.health, "/", target.max_health);
     
     if (target.health <= 0) {
         target.is_alive = false;
-        HandleCharacterDeath(target, {});
+        RefreshBleeding(target);
+        HandleCharacterDeath(target, EDeathCause::WOUNDS);
+    } else {
+        RefreshBleeding(target);
     }
 }
 
 void CombatSystem::TreatInjury(FNPC& npc, int injury_index) {
     if (injury_index < static_cast<int>(npc.injuries.size())) {
         npc.injuries[injury_index].is_treated = true;
-        npc.injuries[injury_index].bleed_rate = 0.0f;
-        std::cout << "[CombatSystem] NPC injury treated" << std::endl;
+        npc.injuries[injury_index].bleed_centi = 0;
+        RefreshBleeding(npc);
+        Metrics().injuries_treated.Add();
+        NAUVOO_LOG_DEBUG(ELogCategory::COMBAT, "[CombatSystem] NPC injury treated");
     }
 }
 
 void CombatSystem::TreatPlayerInjury(FPlayerState& player, int injury_index) {
     if (injury_index < static_cast<int>(player.injuries.size())) {
         player.injuries[injury_index].is_treated = true;
-        player.injuries[injury_index].bleed_rate = 0.0f;
-        std::cout << "[CombatSystem] Player injury treated" << std::endl;
+        player.injuries[injury_index].bleed_centi = 0;
+        RefreshBleeding(player);
+        Metrics().injuries_treated.Add();
+        NAUVOO_LOG_DEBUG(ELogCategory::COMBAT, "[CombatSystem] Player injury treated");
     }
 }
 
 float CombatSystem::CalculateAccuracy(const FPlayerState& player, EStance stance) const {
-    float base_accuracy = 0.7f;
-    
-    // Apply stance modifier
-    if (stance == EStance::STANDING) base_accuracy *= 0.7f;
-    else if (stance == EStance::CROUCHING) base_accuracy *= 0.85f;
-    else if (stance == EStance::PRONE) base_accuracy *= 0.95f;
-    
-    // Apply stamina penalty
+    FWeaponArchetypeId equipped = GetEquippedArchetype(player);
+    float base_accuracy = equipped != INVALID_WEAPON_ARCHETYPE ? weapon_registry->Get(equipped).accuracy : 0.7f;
+    return base_accuracy * GetStanceAccuracy(stance) * GetFatigueAccuracy(player);
+}
+
+float CombatSystem::GetFatigueAccuracy(const FPlayerState& player) const {
     float stamina_percent = player.stamina / player.max_stamina;
-    if (stamina_percent < 0.2f) base_accuracy *= 0.5f;
-    else if (stamina_percent < 0.5f) base_accuracy *= 0.7f;
-    
-    return base_accuracy;
+    if (stamina_percent < 0.2f) return 0.5f;
+    if (stamina_percent < 0.5f) return 0.7f;
+    return 1.0f;
 }
 
-float CombatSystem::CalculateDamage(const FWeapon& weapon, const std::string& attacker_id) const {
+float CombatSystem::CalculateDamage(const FWeaponArchetype& weapon, const std::string& attacker_id) const {
     // Would modify based on weapon condition, etc.
     return weapon.damage;
 }
 
 void CombatSystem::UpdateHealth(FPlayerState& player, float delta_time) {
-    float total_bleed = 0.0f;
-    
-    for (FInjury& injury : player.injuries) {
-        if (!injury.is_treated) {
-            total_bleed += injury.bleed_rate;
-            
-            // Risk infection
-            // if (time_since_injury > 60) injury.infection_risk = true;
-        }
+    // Infection risk arrives on a game timer (see ScheduleInfectionCheck)
+    player.health -= player.bleed_rate * delta_time;
+    if (player.health < 0) player.health = 0;
+}
+
+void CombatSystem::AdvanceTime(float delta_time) {
+    clock_seconds += delta_time;
+    AdvanceWeapons(delta_time);
+}
+
+void CombatSystem::ProcessTimers(std::vector<FNPC>& npcs) {
+    combat_timers.Advance(static_cast<uint64_t>(clock_seconds * TIMER_TICKS_PER_SECOND));
+    
+    for (FSymbol npc_id : due_deaths) {
+        death_timers.erase(npc_id);
+        
+        // Deaths are rare, so a scan beats keeping an index in sync
+        auto it = std::find_if(npcs.begin(), npcs.end(), [&](const FNPC& npc) { return npc.symbol == npc_id; });
+        if (it == npcs.end() || !it->is_alive) continue;
+        
+        FNPC& npc = *it;
+        npc.health = 0;
+        npc.health_updated_at = clock_seconds;
+        npc.is_alive = false;
+        RefreshBleeding(npc);
+        HandleCharacterDeath(npc, EDeathCause::BLED_OUT);
     }
+    due_deaths.clear();
+}
+
+float CombatSystem::GetNPCHealth(const FNPC& npc) const {
+    if (!npc.is_alive || npc.bleed_rate <= 0.0f) return npc.health;
     
-    player.health -= total_bleed * delta_time;
-    if (player.health < 0) player.health = 0;
+    float health = npc.health - npc.bleed_rate * static_cast<float>(clock_seconds - npc.health_updated_at);
+    return health > 0.0f ? health : 0.0f;
+}
+
+void CombatSystem::SettleNPCHealth(FNPC& npc) {
+    npc.health = GetNPCHealth(npc);
+    npc.health_updated_at = clock_seconds;
 }
 
-void CombatSystem::UpdateNPCHealth(FNPC& npc, float delta_time) {
-    if (!npc.is_alive) return;
+void CombatSystem::RegisterNPC(FNPC& npc) {
+    npc.symbol = SymbolTable::Get().Intern(npc.id);
     
-    float total_bleed = 0.0f;
+    // Whatever bookkeeping the NPC was copied with belongs to another clock
+    npc.bleed_rate = 0.0f;
+    npc.health_updated_at = clock_seconds;
+    RefreshBleeding(npc);
+}
+
+void CombatSystem::RebuildBleeding(std::vector<FNPC>& npcs, FPlayerState& player) {
+    for (auto& [npc_id, death_timer] : death_timers) {
+        combat_timers.Cancel(death_timer);
+    }
+    death_timers.clear();
+    due_deaths.clear();
+    Metrics().npcs_bleeding.Add(-bleeding_npcs);
+    bleeding_npcs = 0;
+    for (FNPC& npc : npcs) {
+        RegisterNPC(npc);
+    }
+    RefreshBleeding(player);
     
-    for (FInjury& injury : npc.injuries) {
-        if (!injury.is_treated) {
-            total_bleed += injury.bleed_rate;
-        }
+    // Game timers were reset with the clock; wounds restart their infection countdown
+    for (size_t i = 0; i < player.injuries.size(); ++i) {
+        if (!player.injuries[i].is_treated && !player.injuries[i].infection_risk) ScheduleInfectionCheck(player, i);
     }
+}
+
+void CombatSystem::RefreshBleeding(FNPC& npc) {
+    SettleNPCHealth(npc);
     
-    npc.health -= total_bleed * delta_time;
-    if (npc.health < 0) {
-        npc.health = 0;
-        npc.is_alive = false;
-        HandleCharacterDeath(npc, {});
+    bool was_bleeding = npc.bleed_rate > 0.0f;
+    npc.bleed_rate = npc.is_alive ? SumBleedRate(npc.injuries) : 0.0f;
+    bool is_bleeding = npc.bleed_rate > 0.0f;
+    if (was_bleeding != is_bleeding) {
+        int64_t delta = is_bleeding ? 1 : -1;
+        bleeding_npcs += delta;
+        Metrics().npcs_bleeding.Add(delta);
     }
+    
+    // Any death scheduled earlier is now stale
+    auto death_timer = death_timers.find(npc.symbol);
+    if (death_timer != death_timers.end()) {
+        combat_timers.Cancel(death_timer->second);
+        if (!is_bleeding) death_timers.erase(death_timer);
+    }
+    if (is_bleeding) {
+        double death_time = clock_seconds + npc.health / npc.bleed_rate;
+        uint64_t due_tick = static_cast<uint64_t>(std::ceil(death_time * TIMER_TICKS_PER_SECOND));
+        death_timers[npc.symbol] = combat_timers.Schedule(due_tick, [this, npc_id = npc.symbol]() { due_deaths.push_back(npc_id); });
+        Metrics().deaths_scheduled.Add();
+    }
+}
+
+void CombatSystem::RefreshBleeding(FPlayerState& player) {
+    player.bleed_rate = SumBleedRate(player.injuries);
 }
 
-void CombatSystem::UpdateEnemyBehavior(FNPC& enemy, const FPlayerState& player, float delta_time) {
-    if (!enemy.is_in_combat) return;
+void CombatSystem::ScheduleInfectionCheck(FPlayerState& player, size_t injury_index) {
+    if (!game_timers) return;
     
-    // Simple AI: if hurt, retreat
-    if (enemy.health < enemy.max_health * 0.3f) {
-        std::cout << "[CombatSystem] " << enemy.name << " is retreating!" << std::endl;
-        enemy.is_in_combat = false;
+    // Injuries are only ever appended, so the index stays valid
+    game_timers->ScheduleAfter(INFECTION_DELAY_MINUTES, [&player, injury_index]() {
+        if (injury_index >= player.injuries.size()) return;
+        FInjury& injury = player.injuries[injury_index];
+        if (injury.is_treated || injury.infection_risk) return;
+        injury.infection_risk = true;
+        NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] Untreated wound at risk of infection");
+    });
+}
+
+float CombatSystem::SumBleedRate(const FInjuryList& injuries) const {
+    // Integer hundredths over the contiguous list, converted once
+    uint32_t total_centi = 0;
+    for (const FInjury& injury : injuries) {
+        total_centi += injury.is_treated ? 0u : injury.bleed_centi;
+    }
+    return static_cast<float>(total_centi) * 0.01f;
+}
+
+uint32_t CombatSystem::GetGameMinute() const {
+    return game_timers ? static_cast<uint32_t>(game_timers->GetCurrentTick()) : 0;
+}
+
+void CombatSystem::UpdateEnemyBehavior(std::vector<FNPC>& npcs, const FPlayerState& player, float delta_time) {
+    const size_t count = encounters.GetParticipantCount();
+    if (count == 0) {
+        replan_budget = 0.0f;
         return;
     }
-    
-    // Otherwise, stay in combat
+
+    // Each combatant comes up once per interval; whatever falls short of a whole one carries over
+    size_t window = count;
+    if (replan_interval > 0.0f) {
+        replan_budget += static_cast<float>(count) * delta_time / replan_interval;
+        window = std::min(count, static_cast<size_t>(replan_budget));
+        replan_budget = std::min(replan_budget - static_cast<float>(window), 1.0f);
+        if (window == 0) return;
+    }
+
+    size_t gathered = GatherCombatants(npcs, player, window);
+    replan_cursor = (replan_cursor + window) % count;
+    if (gathered == 0) return;
+    Metrics().ai_replans.Add(gathered);
+
+    const std::vector<FUtilityAction>& actions = GetDefaultCombatActions();
+    if (job_system && gathered > COMBATANTS_PER_JOB) {
+        job_system->ParallelFor(gathered, COMBATANTS_PER_JOB, [this, &actions](size_t, size_t begin, size_t end) {
+            EvaluateCombatActions(actions, combatants, begin, end);
+        });
+    } else {
+        EvaluateCombatActions(actions, combatants, 0, gathered);
+    }
+    ApplyCombatDecisions(npcs);
 }
 
-EBodyPart CombatSystem::DetermineBodyPart(const FVector3& hit_location) const {
-    // Simplified: just return torso for MVP
-    return EBodyPart::TORSO;
+size_t CombatSystem::GatherCombatants(std::vector<FNPC>& npcs, const FPlayerState& player, size_t window) {
+    const std::vector<FSymbol>& ids = encounters.GetParticipantIds();
+    const std::vector<uint32_t>& participant_npcs = encounters.GetParticipantNPCs();
+    const std::vector<uint32_t>& slots = encounters.GetParticipantEncounterSlots();
+    const std::vector<uint8_t>& sides = encounters.GetParticipantSides();
+    const size_t count = ids.size();
+    constexpr size_t SIDES = EncounterManager::MAX_SIDES;
+
+    // Allies and enemies are counted per side in one pass rather than NPC against NPC
+    side_tallies.assign(encounters.GetEncounterSlotCount() * SIDES, FSideTally());
+    encounter_tallies.assign(encounters.GetEncounterSlotCount(), FSideTally());
+    uint32_t player_slot = static_cast<uint32_t>(encounter_tallies.size());
+    uint8_t player_side = EncounterManager::MAX_SIDES;
+    for (size_t i = 0; i < count; ++i) {
+        const FVector3* position;
+        if (participant_npcs[i] == PLAYER_PARTICIPANT) {
+            if (IsCharacterDead(player)) continue;
+            player_slot = slots[i];
+            player_side = sides[i];
+            position = &player.position;
+        } else {
+            const FNPC& npc = npcs[participant_npcs[i]];
+            if (!npc.is_alive || !npc.is_in_combat) continue;
+            position = &npc.position;
+        }
+        FSideTally& side = side_tallies[slots[i] * SIDES + sides[i]];
+        FSideTally& encounter = encounter_tallies[slots[i]];
+        side.count++;
+        side.position_sum = side.position_sum + *position;
+        encounter.count++;
+        encounter.position_sum = encounter.position_sum + *position;
+    }
+
+    const size_t action_count = GetDefaultCombatActions().size();
+    combatants.Resize(window, action_count);
+    size_t gathered = 0;
+    for (size_t n = 0; n < window; ++n) {
+        size_t i = (replan_cursor + n) % count;
+        if (participant_npcs[i] == PLAYER_PARTICIPANT) continue;
+        const FNPC& npc = npcs[participant_npcs[i]];
+        if (!npc.is_alive || !npc.is_in_combat) continue;
+
+        const FSideTally& side = side_tallies[slots[i] * SIDES + sides[i]];
+        const FSideTally& encounter = encounter_tallies[slots[i]];
+        uint32_t enemies = encounter.count - side.count;
+        if (enemies == 0) continue;     // the encounter resolves this tick
+
+        FVector3 enemy_sum = encounter.position_sum - side.position_sum;
+        float inverse = 1.0f / static_cast<float>(enemies);
+        FVector3 target = { enemy_sum.x * inverse, enemy_sum.y * inverse, enemy_sum.z * inverse };
+        bool facing_player = slots[i] == player_slot && sides[i] != player_side;
+
+        size_t k = gathered++;
+        combatants.npcs[k] = participant_npcs[i];
+        combatants.ids[k] = ids[i];
+        combatants.current[k] = npc.combat_action;
+        combatants.targets[k] = target;
+        combatants.GetInput(EConsideration::HEALTH)[k] = std::clamp(GetNPCHealth(npc) / std::max(npc.max_health, 1.0f), 0.0f, 1.0f);
+        combatants.GetInput(EConsideration::LOADED)[k] = GetLoadedFraction(ids[i]);
+        combatants.GetInput(EConsideration::ENEMY_DISTANCE)[k] = std::min(npc.position.Distance(target) / COMBAT_AI_FAR_DISTANCE, 1.0f);
+        combatants.GetInput(EConsideration::COVER)[k] = npc.stance == EStance::BEHIND_COVER ? 1.0f : 0.0f;
+        combatants.GetInput(EConsideration::ALLY_SHARE)[k] = static_cast<float>(side.count) / static_cast<float>(encounter.count);
+        float player_fear = facing_player ? std::clamp(npc.reputation_with_player.fear / 100.0f, 0.0f, 1.0f) : 0.0f;
+        combatants.GetInput(EConsideration::FEAR)[k] = std::max(player_fear, npc.fear);
+        combatants.GetInput(EConsideration::AGGRESSION)[k] = GetFactionAggression(npc.faction);
+    }
+    combatants.Resize(gathered, action_count);
+    return gathered;
+}
+
+void CombatSystem::ApplyCombatDecisions(std::vector<FNPC>& npcs) {
+    for (size_t k = 0; k < combatants.GetCount(); ++k) {
+        FNPC& npc = npcs[combatants.npcs[k]];
+        ECombatAction decision = combatants.decision[k];
+        npc.combat_action = decision;
+        npc.combat_target_position = combatants.targets[k];
+
+        switch (decision) {
+            case ECombatAction::TAKE_COVER:
+                npc.stance = EStance::BEHIND_COVER;
+                break;
+            case ECombatAction::ADVANCE:
+                npc.stance = EStance::MOVING;
+                break;
+            case ECombatAction::RETREAT:
+                // The encounter drops them on its next update
+                NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] ", npc.name, " is retreating!");
+                Metrics().retreats.Add();
+                npc.stance = EStance::MOVING;
+                npc.is_in_combat = false;
+                break;
+            case ECombatAction::RELOAD:
+                ReloadWeapon(combatants.ids[k]);
+                [[fallthrough]];
+            default:
+                if (npc.stance == EStance::MOVING) npc.stance = EStance::STANDING;
+                break;
+        }
+    }
+}
+
+float CombatSystem::GetLoadedFraction(FSymbol character_id) const {
+    const FWeaponState* weapon = GetWeaponState(character_id);
+    if (!weapon) return 1.0f;       // fists need no loading
+    int capacity = weapon_registry->Get(weapon->archetype).max_ammo;
+    if (capacity <= 0) return 1.0f;
+    return weapon->IsReloading() ? 0.0f : static_cast<float>(weapon->ammo) / static_cast<float>(capacity);
 }
 
 float CombatSystem::GetBleedRate(EInjuryType injury_type, int severity) const {
@@ -213,23 +720,28 @@ float CombatSystem::GetBleedRate(EInjuryType injury_type, int severity) const {
     }
 }
 
-void CombatSystem::HandleCharacterDeath(FNPC& dead_npc, const std::vector<FNPC>& witnesses) {
-    std::cout << "[CombatSystem] " << dead_npc.name << " died in combat" << std::endl;
+void CombatSystem::HandleCharacterDeath(FNPC& dead_npc, EDeathCause cause) {
+    NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[CombatSystem] ", dead_npc.name, " died in combat");
+    Metrics().deaths.Add();
     dead_npc.is_alive = false;
     
-    // Would apply reputation consequences based on circumstances
-    if (reputation_manager) {
-        // Killing an NPC will affect reputation
-        reputation_manager->RecordAction("npc_killed_" + dead_npc.id, {});
-    }
+    // Reputation and other consequences subscribe to the event
+    if (event_bus) event_bus->Publish(FCharacterDiedEvent{ dead_npc.symbol, cause, dead_npc.position });
+}
+
+void CombatSystem::PublishInjury(FSymbol character_id, const FInjury& injury) {
+    if (event_bus) event_bus->Publish(FCharacterInjuredEvent{ character_id, injury.type, injury.location, injury.severity });
 }
 
 void CombatSystem::PrintCombatState() const {
     std::cout << "\n=== COMBAT STATE ===" << std::endl;
-    std::cout << "In combat: " << (in_combat ? "Yes" : "No") << std::endl;
-    if (in_combat) {
-        std::cout << "Enemy: " << current_enemy_id << std::endl;
-        std::cout << "Combat timeout: " << combat_timeout << "s" << std::endl;
+    std::cout << "In combat: " << (IsInCombat() ? "Yes" : "No") << std::endl;
+    std::cout << "Encounters: " << encounters.GetActiveCount() << " (" << encounters.GetParticipantCount()
+              << " combatants)" << std::endl;
+    if (IsInCombat()) {
+        FEncounterId encounter = encounters.GetEncounterOf(PLAYER_SYMBOL);
+        std::cout << "Player's encounter: " << encounters.GetParticipantCount(encounter) << " combatants, timeout in "
+                  << encounters.GetTimeRemaining(encounter, clock_seconds) << "s" << std::endl;
     }
 }
 
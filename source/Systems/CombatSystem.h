@@ -1,6 +1,13 @@
 #pragma once
 
 #include "../Engine/CoreTypes.h"
+#include "../Engine/FlatMap.h"
+#include "../Engine/GameEvents.h"
+#include "../Engine/JobSystem.h"
+#include "../Engine/TimerWheel.h"
+#include "CombatAI.h"
+#include "EncounterManager.h"
+#include "VolleyResolver.h"
 #include <string>
 #include <vector>
 #include <memory>
@@ -8,23 +15,73 @@
 namespace Nauvoo {
 
 class ReputationManager;
+class RandomService;
+class EventBus;
+class WeaponRegistry;
+
+enum class EWeaponDischarge : uint8_t {
+    FIRED,
+    MISFIRED,       // no shot; the charge stays in the weapon
+    RELOADING,
+    COOLING_DOWN,
+    UNARMED
+};
+
+struct FVolleyResult {
+    int fired = 0;
+    int misfired = 0;
+    int hits = 0;
+};
 
 /**
  * Manages combat: targeting, weapon fire, damage, injuries
  */
 class CombatSystem {
 public:
-    CombatSystem(ReputationManager* reputation_mgr);
+    CombatSystem(ReputationManager* reputation_mgr, RandomService* random_svc);
     ~CombatSystem();
 
-    // Combat initialization
-    void StartCombat(const std::string& enemy_npc_id, FNPC& enemy, FPlayerState& player);
-    void EndCombat();
-    bool IsInCombat() const { return in_combat; }
-
-    // Weapon fire
+    // Game-minute wheel for slow consequences such as wound infection; none are scheduled without one.
+    // Timers refer back to the wounded player, so it must outlive them
+    void SetGameTimers(TimerWheel* timers) { game_timers = timers; }
+    // Injuries, deaths, gunfire and combat start/end are published here when set (see GameEvents.h)
+    void SetEventBus(EventBus* bus) { event_bus = bus; }
+    // Archetypes behind every equipped weapon; must outlive the combat system
+    void SetWeaponRegistry(const WeaponRegistry* registry) { weapon_registry = registry; }
+    // Large volleys resolve in parallel chunks here when set
+    void SetJobSystem(JobSystem* jobs) { job_system = jobs; }
+
+    // The player engages an NPC: joins the NPC's encounter on the other side, or brings the NPC into
+    // the player's, or starts a new one
+    void StartCombat(std::vector<FNPC>& npcs, uint32_t enemy_index);
+    // Ends the player's encounter for everyone in it
+    void EndCombat(std::vector<FNPC>& npcs);
+    bool IsInCombat() const { return encounters.GetEncounterOf(PLAYER_SYMBOL) != INVALID_ENCOUNTER; }
+    // Every engagement, the player's included; shots fired by a participant keep their encounter going
+    EncounterManager& GetEncounters() { return encounters; }
+    const EncounterManager& GetEncounters() const { return encounters; }
+    // Drops the dead and fled from their encounters and ends the finished or quiet ones
+    void UpdateEncounters(std::vector<FNPC>& npcs, const FPlayerState& player);
+
+    // Weapon fire, with the weapon named by player.equipped_weapon_id (the registry default when empty),
+    // at the enemy NPC; a one-shot volley
     void FireWeapon(FPlayerState& player, const FVector3& target_position, 
                    std::vector<FNPC>& all_npcs, const std::string& enemy_npc_id);
+    // Every shooter fires at once with the weapon they carry. The shots resolve in one batched pass
+    // against the world as it was, then the damage lands in shot order. Targets index npcs, or are
+    // VOLLEY_TARGET_PLAYER
+    FVolleyResult FireVolley(const FVolley& volley, std::vector<FNPC>& npcs, FPlayerState& player);
+
+    // Weapons carried by characters (the player is PLAYER_SYMBOL). Equipping loads the weapon fully
+    bool EquipWeapon(FSymbol character_id, FSymbol weapon_id);
+    void UnequipWeapon(FSymbol character_id);
+    void ClearWeapons();
+    const FWeaponState* GetWeaponState(FSymbol character_id) const;
+    size_t GetArmedCount() const { return weapon_states.size(); }
+    // Spends a round if the weapon is ready and starts the reload once it is empty
+    EWeaponDischarge DischargeWeapon(FSymbol character_id);
+    void ReloadWeapon(FSymbol character_id);
+    void CleanWeapon(FSymbol character_id);
 
     // Damage application
     void ApplyDamage(FPlayerState& target, float damage, EBodyPart hit_location, 
@@ -38,33 +95,120 @@ public:
 
     // Combat statistics
     float CalculateAccuracy(const FPlayerState& player, EStance stance) const;
-    float CalculateDamage(const FWeapon& weapon, const std::string& attacker_id) const;
+    float CalculateDamage(const FWeaponArchetype& weapon, const std::string& attacker_id) const;
 
     // Health checks
     bool IsCharacterDead(const FPlayerState& player) const { return player.health <= 0.0f; }
-    bool IsNPCDead(const FNPC& npc) const { return npc.health <= 0.0f; }
+    bool IsNPCDead(const FNPC& npc) const { return GetNPCHealth(npc) <= 0.0f; }
 
-    // Update bleeding and injuries
+    // Bleeding is linear until an injury changes, so each character caches its total
+    // bleed rate. NPC health is settled lazily against the combat clock and each
+    // bleeding NPC has a time-of-death timer; nothing is done per NPC per frame.
     void UpdateHealth(FPlayerState& player, float delta_time);
-    void UpdateNPCHealth(FNPC& npc, float delta_time);
-
-    // Enemy AI
-    void UpdateEnemyBehavior(FNPC& enemy, const FPlayerState& player, float delta_time);
+    // Also counts down weapon cooldowns and reloads, in one pass over every armed character
+    void AdvanceTime(float delta_time);
+    double GetClock() const { return clock_seconds; }
+    // Fires the combat timers due by the combat clock: deaths, earliest first
+    void ProcessTimers(std::vector<FNPC>& npcs);
+    size_t GetScheduledDeathCount() const { return death_timers.size(); }
+
+    // Health up to the combat clock, without writing it back
+    float GetNPCHealth(const FNPC& npc) const;
+    void SettleNPCHealth(FNPC& npc);
+
+    // Interns the id and starts bleeding bookkeeping for an NPC entering the world, or for everyone after a load
+    void RegisterNPC(FNPC& npc);
+    void RebuildBleeding(std::vector<FNPC>& npcs, FPlayerState& player);
+    // Call after changing a character's injuries directly
+    void RefreshBleeding(FNPC& npc);
+    void RefreshBleeding(FPlayerState& player);
+
+    // Enemy AI: a rolling share of every encounter's combatants is replanned each update, so each is
+    // reconsidered once per replan interval. The actions of CombatAI.h are scored over the whole share
+    // at once; decisions land in FNPC::combat_action, retreating NPCs leave combat and reloads start
+    void UpdateEnemyBehavior(std::vector<FNPC>& npcs, const FPlayerState& player, float delta_time);
+    // Seconds between decisions of each combatant; 0 replans everyone every update
+    void SetReplanInterval(float seconds) { replan_interval = seconds > 0.0f ? seconds : 0.0f; }
+    float GetReplanInterval() const { return replan_interval; }
 
     // Debug
     void PrintCombatState() const;
 
 private:
-    bool in_combat = false;
-    std::string current_enemy_id;
-    float combat_timeout = 0.0f;
-
+    static constexpr double TIMER_TICKS_PER_SECOND = 1000.0;    // combat timers run in milliseconds
+    static constexpr uint64_t INFECTION_DELAY_MINUTES = 60;     // an untreated wound risks infection after this
+    static constexpr int MAX_INJURY_SEVERITY = 10;              // a heavier blow is no worse a wound
+    static constexpr float FOULING_MISFIRE_CHANCE = 0.25f;      // added misfire chance of a fully fouled weapon
+    static constexpr size_t SHOTS_PER_JOB = 256;                // volley chunk size when resolving in parallel
+    static constexpr float DEFAULT_REPLAN_INTERVAL = 0.5f;      // seconds between a combatant's decisions
+    static constexpr size_t COMBATANTS_PER_JOB = 256;           // AI chunk size when scoring in parallel
+
+    // Fighters on one side of an encounter (or all of it) and the sum of their positions
+    struct FSideTally {
+        uint32_t count = 0;
+        FVector3 position_sum;
+    };
+
+    // A resolved hit waiting to be applied
+    struct FShotDamage {
+        uint32_t target;
+        EBodyPart body_part;
+        float damage;
+        FSymbol shooter;
+    };
+
+    EncounterManager encounters;
+    bool in_combat = false;                                         // the player, as last published
+
+    double clock_seconds = 0.0;
+    int64_t bleeding_npcs = 0;
+    TimerWheel combat_timers;
+    TFlatHashMap<FSymbol, FTimerHandle> death_timers;        // NPC -> time of death
+    std::vector<FSymbol> due_deaths;                                // filled by death timers as they fire
+
+    // Dense so the per-tick countdown is one linear pass; removal swaps the last weapon into the gap
+    std::vector<FWeaponState> weapon_states;
+    std::vector<FSymbol> weapon_owners;                             // parallel to weapon_states
+    TFlatHashMap<FSymbol, uint32_t> weapon_slots;                   // character -> index into weapon_states
+    bool weapons_busy = false;                                      // some weapon is cooling down or reloading
+
+    // Reused by every volley so firing does not allocate once warmed up
+    FShotBatch shot_batch;
+    CommandBuffer<FShotDamage> shot_damage;
+    FVolley single_shot;
+
+    // Combat AI; the window of combatants to replan rolls across the participant arrays
+    float replan_interval = DEFAULT_REPLAN_INTERVAL;
+    float replan_budget = 0.0f;                                     // combatants owed a replan, carried between updates
+    size_t replan_cursor = 0;
+    FCombatantBatch combatants;
+    std::vector<FSideTally> side_tallies;                           // encounter slot * MAX_SIDES + side
+    std::vector<FSideTally> encounter_tallies;                      // encounter slot
+
+    TimerWheel* game_timers = nullptr;
+    EventBus* event_bus = nullptr;
+    const WeaponRegistry* weapon_registry = nullptr;
+    JobSystem* job_system = nullptr;
     ReputationManager* reputation_manager = nullptr;
+    RandomService* random_service = nullptr;
 
     // Helper functions
-    EBodyPart DetermineBodyPart(const FVector3& hit_location) const;
     float GetBleedRate(EInjuryType injury_type, int severity) const;
-    void HandleCharacterDeath(FNPC& dead_npc, const std::vector<FNPC>& witnesses);
+    float SumBleedRate(const FInjuryList& injuries) const;
+    uint32_t GetGameMinute() const;
+    void EquipArchetype(FSymbol character_id, FWeaponArchetypeId archetype);
+    void StartReload(FWeaponState& weapon);
+    void AdvanceWeapons(float delta_time);
+    FWeaponState* FindWeapon(FSymbol character_id);
+    FWeaponArchetypeId GetEquippedArchetype(const FPlayerState& player) const;
+    float GetFatigueAccuracy(const FPlayerState& player) const;
+    float GetLoadedFraction(FSymbol character_id) const;
+    size_t GatherCombatants(std::vector<FNPC>& npcs, const FPlayerState& player, size_t window);
+    void ApplyCombatDecisions(std::vector<FNPC>& npcs);
+    void SyncPlayerEngagement();
+    void ScheduleInfectionCheck(FPlayerState& player, size_t injury_index);
+    void HandleCharacterDeath(FNPC& dead_npc, EDeathCause cause);
+    void PublishInjury(FSymbol character_id, const FInjury& injury);
 };
 
 }  // namespace Nauvoo
@@ -0,0 +1,237 @@
+#include "../Systems/CrowdMorale.h"
+#include "../Engine/Log.h"
+#include "../Engine/Metrics.h"
+#include "../Engine/SimulationLOD.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Nauvoo {
+
+namespace {
+
+constexpr float SPREAD_RATE = 0.5f;             // per second: how fast moods converge on the crowd's
+constexpr float FEAR_ECHO = 0.8f;               // share of the surrounding fear taken on
+constexpr float ANGER_ECHO = 0.8f;
+constexpr float PANIC_CONTAGION = 0.3f;         // fear added when everyone around is panicking
+constexpr float FIGHT_FEAR = 0.3f;              // ... and when everyone around is fighting
+constexpr float FIGHT_ANGER = 0.4f;
+constexpr float FEAR_DECAY = 0.05f;             // per second, faster in a steady crowd
+constexpr float ANGER_DECAY = 0.03f;
+constexpr float PANIC_DECAY = 0.15f;            // per second while fleeing; panic burns itself out
+constexpr float COHESION_CROWD = 8.0f;          // neighbours at which cohesion is one half
+constexpr float COHESION_STEADYING = 0.5f;      // share of a fright a fully cohesive crowd shrugs off
+
+struct FCrowdMetrics {
+    MetricCounter& panics = MetricsRegistry::Get().GetCounter("crowd.panics");
+    MetricGauge& panicking = MetricsRegistry::Get().GetGauge("crowd.panicking");
+    MetricGauge& members = MetricsRegistry::Get().GetGauge("crowd.members");
+};
+
+FCrowdMetrics& Metrics() {
+    static FCrowdMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
+CrowdMorale::CrowdMorale() {
+    Metrics();
+}
+
+CrowdMorale::~CrowdMorale() {
+    Metrics().panicking.Add(-static_cast<int64_t>(panicking_count));
+    Metrics().members.Add(-static_cast<int64_t>(members.size()));
+}
+
+void CrowdMorale::AddStimulus(const FVector3& position, float fear, float anger) {
+    stimuli.push_back({ position, fear, anger });
+}
+
+void CrowdMorale::Clear() {
+    Metrics().panicking.Add(-static_cast<int64_t>(panicking_count));
+    Metrics().members.Add(-static_cast<int64_t>(members.size()));
+    stimuli.clear();
+    members.clear();
+    member_delta_times.clear();
+    member_cells.clear();
+    cells.clear();
+    neighbourhoods.clear();
+    width = height = 0;
+    panicking_count = 0;
+}
+
+void CrowdMorale::Update(std::vector<FNPC>& npcs, const FNPCTickList& tick_list) {
+    const int64_t previous_members = static_cast<int64_t>(members.size());
+    const int64_t previous_panicking = static_cast<int64_t>(panicking_count);
+    members.clear();
+    member_delta_times.clear();
+    for (size_t i = 0; i < tick_list.GetCount(); ++i) {
+        const FNPC& npc = npcs[tick_list.npc_indices[i]];
+        if (!npc.is_alive || npc.simulation_lod != ESimulationLOD::FULL) continue;
+        members.push_back(tick_list.npc_indices[i]);
+        member_delta_times.push_back(tick_list.delta_times[i]);
+    }
+
+    panicking_count = 0;
+    if (!members.empty()) {
+        BuildGrid(npcs);
+        SumNeighbourhoods();
+    } else {
+        width = height = 0;
+    }
+    stimuli.clear();
+
+    for (size_t m = 0; m < members.size(); ++m) {
+        FNPC& npc = npcs[members[m]];
+        const uint32_t cell = member_cells[m];
+        const FCell& around = neighbourhoods[cell];
+        const float delta_time = member_delta_times[m];
+        const float cohesion = GetCohesion(around);
+        const float spread = std::min(SPREAD_RATE * delta_time, 1.0f);
+
+        // Everyone else around them; somebody alone has nobody to take a mood from
+        const float others = around.count - 1.0f;
+        const float scale = others > 0.0f ? 1.0f / others : 0.0f;
+        const float mean_fear = (around.fear - npc.fear) * scale;
+        const float mean_anger = (around.anger - npc.anger) * scale;
+        const float panic_share = (around.panicking - (npc.is_panicking ? 1.0f : 0.0f)) * scale;
+        const float fight_share = (around.fighting - (npc.is_in_combat ? 1.0f : 0.0f)) * scale;
+
+        // Moods drift towards the crowd's; the panicking spread fear rather than take it on
+        if (npc.is_panicking) {
+            npc.fear -= PANIC_DECAY * delta_time;
+        } else {
+            float fear_target = std::min(std::max(FEAR_ECHO * mean_fear, FIGHT_FEAR * fight_share) + PANIC_CONTAGION * panic_share, 1.0f);
+            npc.fear += (fear_target - npc.fear) * spread - FEAR_DECAY * (0.5f + cohesion) * delta_time;
+        }
+        float anger_target = std::min(std::max(ANGER_ECHO * mean_anger, FIGHT_ANGER * fight_share) * (0.5f + cohesion), 1.0f);
+        npc.anger += (anger_target - npc.anger) * spread - ANGER_DECAY * delta_time;
+
+        // Frights land at once; a packed crowd takes them better and angers together
+        npc.fear = std::clamp(npc.fear + around.stimulus_fear * (1.0f - COHESION_STEADYING * cohesion), 0.0f, 1.0f);
+        npc.anger = std::clamp(npc.anger + around.stimulus_anger * (0.5f + cohesion), 0.0f, 1.0f);
+
+        if (!npc.is_panicking && npc.fear >= PANIC_FEAR && npc.fear > npc.anger) {
+            npc.is_panicking = true;
+            npc.stance = EStance::MOVING;
+            if (npc.is_in_combat) {
+                // The encounter drops them on its next update
+                npc.is_in_combat = false;
+                npc.combat_action = ECombatAction::RETREAT;
+            }
+            Metrics().panics.Add();
+            NAUVOO_LOG_DEBUG(ELogCategory::GAME, "[CrowdMorale] ", npc.name, " panics");
+        } else if (npc.is_panicking && npc.fear < CALM_FEAR) {
+            npc.is_panicking = false;
+            if (npc.stance == EStance::MOVING && !npc.is_in_combat) npc.stance = EStance::STANDING;
+        }
+
+        if (npc.is_panicking) {
+            panicking_count++;
+            int x = static_cast<int>(cell) % width;
+            int y = static_cast<int>(cell) / width;
+            float gradient_x = GetDanger(x + 1, y) - GetDanger(x - 1, y);
+            float gradient_y = GetDanger(x, y + 1) - GetDanger(x, y - 1);
+            float length = std::sqrt(gradient_x * gradient_x + gradient_y * gradient_y);
+            if (length > 1e-4f) npc.flee_direction = { -gradient_x / length, -gradient_y / length, 0.0f };
+            // The grid was built before anyone moved, so this frame's flight does not feed back into it
+            npc.position.x += npc.flee_direction.x * FLEE_SPEED * delta_time;
+            npc.position.y += npc.flee_direction.y * FLEE_SPEED * delta_time;
+        }
+    }
+
+    Metrics().members.Add(static_cast<int64_t>(members.size()) - previous_members);
+    Metrics().panicking.Add(static_cast<int64_t>(panicking_count) - previous_panicking);
+}
+
+void CrowdMorale::BuildGrid(const std::vector<FNPC>& npcs) {
+    float min_x = npcs[members[0]].position.x;
+    float min_y = npcs[members[0]].position.y;
+    float max_x = min_x;
+    float max_y = min_y;
+    for (uint32_t member : members) {
+        const FVector3& position = npcs[member].position;
+        min_x = std::min(min_x, position.x);
+        min_y = std::min(min_y, position.y);
+        max_x = std::max(max_x, position.x);
+        max_y = std::max(max_y, position.y);
+    }
+
+    float extent = std::max(max_x - min_x, max_y - min_y);
+    cell_size = std::max(CELL_SIZE, extent / static_cast<float>(MAX_CELLS_PER_AXIS - 1));
+    origin_x = min_x;
+    origin_y = min_y;
+    width = std::min(static_cast<int>((max_x - min_x) / cell_size) + 1, MAX_CELLS_PER_AXIS);
+    height = std::min(static_cast<int>((max_y - min_y) / cell_size) + 1, MAX_CELLS_PER_AXIS);
+    cells.assign(static_cast<size_t>(width) * height, FCell());
+
+    member_cells.resize(members.size());
+    for (size_t m = 0; m < members.size(); ++m) {
+        const FNPC& npc = npcs[members[m]];
+        uint32_t cell = static_cast<uint32_t>(CellAt(npc.position.x, npc.position.y));
+        member_cells[m] = cell;
+        FCell& binned = cells[cell];
+        binned.count += 1.0f;
+        binned.fear += npc.fear;
+        binned.anger += npc.anger;
+        binned.panicking += npc.is_panicking ? 1.0f : 0.0f;
+        binned.fighting += npc.is_in_combat ? 1.0f : 0.0f;
+    }
+
+    // Frights within a cell of the crowd land on its edge; further out they reach nobody
+    for (const FStimulus& stimulus : stimuli) {
+        int cell_x = static_cast<int>(std::floor((stimulus.position.x - origin_x) / cell_size));
+        int cell_y = static_cast<int>(std::floor((stimulus.position.y - origin_y) / cell_size));
+        if (cell_x < -1 || cell_y < -1 || cell_x > width || cell_y > height) continue;
+        FCell& cell = cells[std::clamp(cell_y, 0, height - 1) * width + std::clamp(cell_x, 0, width - 1)];
+        cell.stimulus_fear += stimulus.fear;
+        cell.stimulus_anger += stimulus.anger;
+    }
+}
+
+void CrowdMorale::SumNeighbourhoods() {
+    // A 3x3 box sum as a pass along rows and then along columns
+    row_sums.assign(cells.size(), FCell());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            FCell& sum = row_sums[y * width + x];
+            for (int dx = std::max(x - 1, 0); dx <= std::min(x + 1, width - 1); ++dx) sum.Add(cells[y * width + dx]);
+        }
+    }
+    neighbourhoods.assign(cells.size(), FCell());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            FCell& sum = neighbourhoods[y * width + x];
+            for (int dy = std::max(y - 1, 0); dy <= std::min(y + 1, height - 1); ++dy) sum.Add(row_sums[dy * width + x]);
+        }
+    }
+}
+
+int CrowdMorale::CellAt(float x, float y) const {
+    int cell_x = static_cast<int>(std::floor((x - origin_x) / cell_size));
+    int cell_y = static_cast<int>(std::floor((y - origin_y) / cell_size));
+    if (cell_x < 0 || cell_y < 0 || cell_x >= width || cell_y >= height) return -1;
+    return cell_y * width + cell_x;
+}
+
+float CrowdMorale::GetCohesion(const FCell& neighbourhood) const {
+    if (neighbourhood.count <= 0.0f) return 0.0f;
+    float packed = neighbourhood.count / (neighbourhood.count + COHESION_CROWD);
+    return packed * (1.0f - neighbourhood.panicking / neighbourhood.count);
+}
+
+float CrowdMorale::GetCohesionAt(const FVector3& position) const {
+    int cell = CellAt(position.x, position.y);
+    return cell >= 0 ? GetCohesion(neighbourhoods[cell]) : 0.0f;
+}
+
+float CrowdMorale::GetDanger(int x, int y) const {
+    x = std::clamp(x, 0, width - 1);
+    y = std::clamp(y, 0, height - 1);
+    const FCell& around = neighbourhoods[y * width + x];
+    float mean_fear = around.count > 0.0f ? around.fear / around.count : 0.0f;
+    // Frights count twice in their own cell, so the gradient points away from them there too
+    return mean_fear + around.stimulus_fear + cells[y * width + x].stimulus_fear;
+}
+
+}  // namespace Nauvoo
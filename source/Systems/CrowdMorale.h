@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../Engine/CoreTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace Nauvoo {
+
+struct FNPCTickList;
+
+/**
+ * Fear, anger and cohesion of the crowd around the player. Each update bins
+ * the crowd into a coarse grid over the scene, and every NPC feels its cell
+ * and the eight around it as aggregates: head count, mean mood, how many are
+ * fighting or panicking, fresh frights. Nobody is compared with anybody else
+ * one by one, so an update is linear in the crowd plus the cells.
+ *
+ * Fear spreads from the frightened and the panicking and is steadied by a
+ * packed crowd; anger spreads from the fighting and feeds on itself in one.
+ * An NPC whose fear passes PANIC_FEAR and outweighs their anger panics:
+ * they leave any fight and run down the fear gradient at FLEE_SPEED until
+ * calm again.
+ */
+class CrowdMorale {
+public:
+    static constexpr float CELL_SIZE = 8.0f;            // metres; wider scenes than the grid allows use larger cells
+    static constexpr int MAX_CELLS_PER_AXIS = 64;
+    static constexpr float PANIC_FEAR = 0.7f;
+    static constexpr float CALM_FEAR = 0.35f;           // panic ends below this
+    static constexpr float FLEE_SPEED = 3.0f;           // metres per second while panicking
+
+    // Frights the game raises through AddStimulus
+    static constexpr float GUNFIRE_FEAR = 0.15f;
+    static constexpr float DEATH_FEAR = 0.4f;
+    static constexpr float DEATH_ANGER = 0.1f;
+
+    CrowdMorale();
+    ~CrowdMorale();
+
+    // A sudden fright or provocation, felt around the point at the next update
+    void AddStimulus(const FVector3& position, float fear, float anger);
+    size_t GetPendingStimulusCount() const { return stimuli.size(); }
+
+    // The crowd is the fully simulated NPCs of the tick list, each stepped by its own delta time
+    void Update(std::vector<FNPC>& npcs, const FNPCTickList& tick_list);
+    void Clear();
+
+    // Of the last update
+    size_t GetMemberCount() const { return members.size(); }
+    size_t GetPanickingCount() const { return panicking_count; }
+    // How packed and steady the crowd around a point is, 0-1
+    float GetCohesionAt(const FVector3& position) const;
+
+private:
+    // Sums over the NPCs in a cell, or over a cell and its neighbours
+    struct FCell {
+        float count = 0.0f;
+        float fear = 0.0f;
+        float anger = 0.0f;
+        float panicking = 0.0f;
+        float fighting = 0.0f;
+        float stimulus_fear = 0.0f;
+        float stimulus_anger = 0.0f;
+
+        void Add(const FCell& other) {
+            count += other.count;
+            fear += other.fear;
+            anger += other.anger;
+            panicking += other.panicking;
+            fighting += other.fighting;
+            stimulus_fear += other.stimulus_fear;
+            stimulus_anger += other.stimulus_anger;
+        }
+    };
+
+    struct FStimulus {
+        FVector3 position;
+        float fear = 0.0f;
+        float anger = 0.0f;
+    };
+
+    std::vector<FStimulus> stimuli;
+
+    // Members, parallel arrays
+    std::vector<uint32_t> members;              // index into the NPC list
+    std::vector<float> member_delta_times;
+    std::vector<uint32_t> member_cells;
+
+    std::vector<FCell> cells;
+    std::vector<FCell> neighbourhoods;          // each cell summed with the eight around it
+    std::vector<FCell> row_sums;                // scratch for the neighbourhood sums
+    float origin_x = 0.0f;
+    float origin_y = 0.0f;
+    float cell_size = CELL_SIZE;
+    int width = 0;
+    int height = 0;
+    size_t panicking_count = 0;
+
+    void BuildGrid(const std::vector<FNPC>& npcs);
+    void SumNeighbourhoods();
+    int CellAt(float x, float y) const;
+    float GetCohesion(const FCell& neighbourhood) const;
+    // Mean fear around a cell plus its frights; panic runs down its gradient
+    float GetDanger(int x, int y) const;
+};
+
+}  // namespace Nauvoo
@@ -1,52 +1,83 @@
 #include "../Systems/DialogueManager.h"
+#include "../Engine/EventBus.h"
+#include "../Engine/GameEvents.h"
+#include "../Engine/Log.h"
+#include "../Engine/Metrics.h"
 #include "ReputationManager.h"
 #include <iostream>
 #include <algorithm>
 
 namespace Nauvoo {
 
+namespace {
+
+struct FDialogueMetrics {
+    MetricCounter& started = MetricsRegistry::Get().GetCounter("dialogue.started");
+    MetricCounter& choices_selected = MetricsRegistry::Get().GetCounter("dialogue.choices_selected");
+    MetricGauge& active = MetricsRegistry::Get().GetGauge("dialogue.active");
+    MetricHistogram& available_choices = MetricsRegistry::Get().GetHistogram("dialogue.available_choices");
+};
+
+FDialogueMetrics& Metrics() {
+    static FDialogueMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
 DialogueManager::DialogueManager(ReputationManager* reputation_mgr)
     : reputation_manager(reputation_mgr) {
+    Metrics();
 }
 
-DialogueManager::~DialogueManager() = default;
+DialogueManager::~DialogueManager() {
+    if (current_dialogue_tree) Metrics().active.Add(-1);
+}
 
 void DialogueManager::LoadDialogueTrees(const std::string& dialogue_data_file) {
-    std::cout << "[DialogueManager] Dialogue trees loaded from " << dialogue_data_file << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::DIALOGUE, "[DialogueManager] Dialogue trees loaded from ", dialogue_data_file);
 }
 
 void DialogueManager::AddDialogueTree(const FDialogueTree& tree) {
-    dialogue_trees[tree.id] = tree;
-    
-    if (npc_available_dialogues.find(tree.npc_id) == npc_available_dialogues.end()) {
-        npc_available_dialogues[tree.npc_id] = {};
-    }
-    npc_available_dialogues[tree.npc_id].push_back(tree.id);
+    SymbolTable& symbols = SymbolTable::Get();
+    FSymbol tree_id = symbols.Intern(tree.id);
+    FSymbol active_tree_id = current_dialogue_tree ? symbols.Find(current_dialogue_tree->id) : FSymbol();
+    dialogue_trees[tree_id] = tree;
+    // Inserting may move the trees; the nodes stay put inside their vectors
+    if (active_tree_id.IsValid()) current_dialogue_tree = &dialogue_trees.find(active_tree_id)->second;
+    npc_available_dialogues[symbols.Intern(tree.npc_id)].push_back(tree_id);
     
-    std::cout << "[DialogueManager] Added dialogue tree: " << tree.id << " for NPC " << tree.npc_id << std::endl;
+    NAUVOO_LOG_DEBUG(ELogCategory::DIALOGUE, "[DialogueManager] Added dialogue tree: ", tree.id, " for NPC ", tree.npc_id);
 }
 
 void DialogueManager::StartDialogue(const std::string& npc_id, const std::string& dialogue_tree_id) {
-    auto tree_it = dialogue_trees.find(dialogue_tree_id);
+    FSymbol tree_id(dialogue_tree_id);
+    auto tree_it = dialogue_trees.find(tree_id);
     if (tree_it == dialogue_trees.end()) {
-        std::cout << "[DialogueManager] Dialogue tree not found: " << dialogue_tree_id << std::endl;
+        NAUVOO_LOG_WARNING(ELogCategory::DIALOGUE, "[DialogueManager] Dialogue tree not found: ", dialogue_tree_id);
         return;
     }
 
+    if (!current_dialogue_tree) Metrics().active.Add(1);
+    Metrics().started.Add();
+
     current_dialogue_tree = &tree_it->second;
     current_npc_id = npc_id;
     current_node_id = current_dialogue_tree->root_node_id;
     current_node = FindNode(current_node_id);
+    if (event_bus) event_bus->Publish(FDialogueStartedEvent{ FSymbol(npc_id), tree_id });
     
-    std::cout << "[DialogueManager] Started dialogue: " << dialogue_tree_id << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::DIALOGUE, "[DialogueManager] Started dialogue: ", dialogue_tree_id);
 }
 
 void DialogueManager::EndDialogue() {
+    if (current_dialogue_tree) Metrics().active.Add(-1);
+
     current_dialogue_tree = nullptr;
     current_node = nullptr;
     current_npc_id.clear();
     current_node_id.clear();
-    std::cout << "[DialogueManager] Dialogue ended" << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::DIALOGUE, "[DialogueManager] Dialogue ended");
 }
 
 std::string DialogueManager::GetCurrentNodeText() const {
@@ -54,17 +85,19 @@ std::string DialogueManager::GetCurrentNodeText() const {
     return current_node->text;
 }
 
-std::vector<FDialogueOption> DialogueManager::GetAvailableChoices(const std::string& npc_id) const {
-    std::vector<FDialogueOption> available;
+std::pmr::vector<const FDialogueOption*> DialogueManager::GetAvailableChoices(const std::string& npc_id,
+                                                                              std::pmr::memory_resource* memory) const {
+    std::pmr::vector<const FDialogueOption*> available(memory);
     
     if (!current_node) return available;
 
     for (const auto& choice : current_node->choices) {
         if (IsChoiceAvailable(choice, npc_id)) {
-            available.push_back(choice);
+            available.push_back(&choice);
         }
     }
 
+    Metrics().available_choices.Record(available.size());
     return available;
 }
 
@@ -72,15 +105,16 @@ void DialogueManager::SelectChoice(int choice_index, const std::string& npc_id)
     if (!current_node) return;
 
     if (choice_index < 0 || choice_index >= static_cast<int>(current_node->choices.size())) {
-        std::cout << "[DialogueManager] Invalid choice index" << std::endl;
+        NAUVOO_LOG_WARNING(ELogCategory::DIALOGUE, "[DialogueManager] Invalid choice index");
         return;
     }
 
     const FDialogueOption& choice = current_node->choices[choice_index];
+    Metrics().choices_selected.Add();
 
     // Apply consequences
     if (!choice.consequence_action.empty()) {
-        std::cout << "[DialogueManager] Applying consequence: " << choice.consequence_action << std::endl;
+        NAUVOO_LOG_DEBUG(ELogCategory::DIALOGUE, "[DialogueManager] Applying consequence: ", choice.consequence_action);
         
         if (reputation_manager) {
             reputation_manager->ModifyNPCTrust(npc_id, choice.legion_rep_delta);
@@ -90,14 +124,14 @@ void DialogueManager::SelectChoice(int choice_index, const std::string& npc_id)
     // Move to next node
     current_node_id = choice.next_node_id;
     current_node = FindNode(current_node_id);
-    std::cout << "[DialogueManager] Choice selected, moving to next node" << std::endl;
+    NAUVOO_LOG_DEBUG(ELogCategory::DIALOGUE, "[DialogueManager] Choice selected, moving to next node");
 }
 
 bool DialogueManager::CanStartDialogue(const std::string& npc_id, const std::string& dialogue_tree_id) const {
-    auto npc_dialogues = npc_available_dialogues.find(npc_id);
+    auto npc_dialogues = npc_available_dialogues.find(SymbolTable::Get().Find(npc_id));
     if (npc_dialogues == npc_available_dialogues.end()) return false;
 
-    return std::find(npc_dialogues->second.begin(), npc_dialogues->second.end(), dialogue_tree_id)
+    return std::find(npc_dialogues->second.begin(), npc_dialogues->second.end(), SymbolTable::Get().Find(dialogue_tree_id))
            != npc_dialogues->second.end();
 }
 
@@ -139,7 +173,7 @@ void DialogueManager::EvaluateConditionNode(FDialogueNode* condition_node) {
     if (!condition_node) return;
 
     // Would evaluate conditions and update current_node accordingly
-    std::cout << "[DialogueManager] Evaluating condition: " << condition_node->condition_type << std::endl;
+    NAUVOO_LOG_DEBUG(ELogCategory::DIALOGUE, "[DialogueManager] Evaluating condition: ", condition_node->condition_type);
 }
 
 void DialogueManager::PrintCurrentDialogue() const {
@@ -155,7 +189,7 @@ void DialogueManager::PrintCurrentDialogue() const {
     auto available = GetAvailableChoices(current_npc_id);
     std::cout << "Available choices: " << available.size() << std::endl;
     for (int i = 0; i < static_cast<int>(available.size()); ++i) {
-        std::cout << "  [" << i << "] " << available[i].display_text << std::endl;
+        std::cout << "  [" << i << "] " << available[i]->display_text << std::endl;
     }
 }
 
@@ -1,14 +1,16 @@
 #pragma once
 
 #include "../Engine/CoreTypes.h"
+#include "../Engine/FlatMap.h"
 #include <string>
 #include <vector>
-#include <map>
 #include <memory>
+#include <memory_resource>
 
 namespace Nauvoo {
 
 class ReputationManager;
+class EventBus;
 
 /**
  * Manages dialogue trees, choices, and NPC conversations
@@ -22,6 +24,9 @@ public:
     void LoadDialogueTrees(const std::string& dialogue_data_file);
     void AddDialogueTree(const FDialogueTree& tree);
 
+    // Opening a tree is published as FDialogueStartedEvent
+    void SetEventBus(EventBus* bus) { event_bus = bus; }
+
     // Dialogue state
     void StartDialogue(const std::string& npc_id, const std::string& dialogue_tree_id);
     void EndDialogue();
@@ -29,7 +34,9 @@ public:
 
     // Navigation
     std::string GetCurrentNodeText() const;
-    std::vector<FDialogueOption> GetAvailableChoices(const std::string& npc_id) const;
+    // Points into the current node; valid until the dialogue moves on
+    std::pmr::vector<const FDialogueOption*> GetAvailableChoices(const std::string& npc_id,
+                                                                 std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const;
     void SelectChoice(int choice_index, const std::string& npc_id);
 
     // State tracking
@@ -49,8 +56,8 @@ public:
     void PrintCurrentDialogue() const;
 
 private:
-    std::map<std::string, FDialogueTree> dialogue_trees;  // Tree_ID -> Tree
-    std::map<std::string, std::vector<std::string>> npc_available_dialogues;  // NPC_ID -> [Tree_IDs]
+    TFlatHashMap<FSymbol, FDialogueTree> dialogue_trees;  // by tree id
+    TFlatHashMap<FSymbol, std::vector<FSymbol>> npc_available_dialogues;  // NPC -> tree ids
 
     // Current dialogue state
     FDialogueTree* current_dialogue_tree = nullptr;
@@ -59,6 +66,7 @@ private:
     std::string current_node_id;
 
     ReputationManager* reputation_manager = nullptr;
+    EventBus* event_bus = nullptr;
 
     // Helper functions
     FDialogueNode* FindNode(const std::string& node_id) const;
@@ -0,0 +1,229 @@
+#include "../Systems/EncounterManager.h"
+#include "../Engine/GameEvents.h"
+#include "../Engine/Metrics.h"
+#include <algorithm>
+
+namespace Nauvoo {
+
+namespace {
+
+struct FEncounterMetrics {
+    MetricCounter& started = MetricsRegistry::Get().GetCounter("combat.encounters_started");
+    MetricCounter& timed_out = MetricsRegistry::Get().GetCounter("combat.encounters_timed_out");
+    MetricGauge& active = MetricsRegistry::Get().GetGauge("combat.encounters_active");
+    MetricGauge& combatants = MetricsRegistry::Get().GetGauge("combat.combatants");
+};
+
+FEncounterMetrics& Metrics() {
+    static FEncounterMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
+EncounterManager::EncounterManager() {
+    Metrics();
+}
+
+EncounterManager::~EncounterManager() {
+    Metrics().active.Add(-static_cast<int64_t>(encounter_slots.size()));
+    Metrics().combatants.Add(-static_cast<int64_t>(participant_ids.size()));
+}
+
+FEncounterId EncounterManager::StartEncounter(double now, double timeout_seconds) {
+    uint32_t slot;
+    if (!free_slots.empty()) {
+        slot = free_slots.back();
+        free_slots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(encounters.size());
+        encounters.emplace_back();
+    }
+
+    FEncounter& encounter = encounters[slot];
+    encounter = FEncounter();
+    encounter.id = next_id++;
+    if (next_id == INVALID_ENCOUNTER) next_id = 1;
+    encounter.timeout_seconds = timeout_seconds;
+    encounter.expires_at = now + timeout_seconds;
+    encounter_slots[encounter.id] = slot;
+
+    Metrics().started.Add();
+    Metrics().active.Add(1);
+    return encounter.id;
+}
+
+void EncounterManager::EndEncounter(FEncounterId encounter, std::vector<FNPC>& npcs) {
+    auto it = encounter_slots.find(encounter);
+    if (it == encounter_slots.end()) return;
+    uint32_t slot = it->second;
+
+    for (size_t i = participant_ids.size(); i-- > 0;) {
+        if (participant_encounters[i] == slot) RemoveParticipant(static_cast<uint32_t>(i), &npcs);
+    }
+    ReleaseEncounter(slot);
+}
+
+void EncounterManager::Clear() {
+    Metrics().active.Add(-static_cast<int64_t>(encounter_slots.size()));
+    Metrics().combatants.Add(-static_cast<int64_t>(participant_ids.size()));
+
+    encounters.clear();
+    free_slots.clear();
+    encounter_slots.clear();
+    participant_ids.clear();
+    participant_npcs.clear();
+    participant_encounters.clear();
+    participant_sides.clear();
+    participant_fighting.clear();
+    participant_slots.clear();
+    ended.clear();
+}
+
+bool EncounterManager::Join(FEncounterId encounter, uint8_t side, std::vector<FNPC>& npcs, uint32_t npc_index) {
+    if (npc_index >= npcs.size()) return false;
+    FNPC& npc = npcs[npc_index];
+    if (!AddParticipant(encounter, side, npc.symbol, npc_index)) return false;
+    if (!npc.is_in_combat) npc.combat_action = ECombatAction::NONE;   // fresh to the fight
+    npc.is_in_combat = true;
+    return true;
+}
+
+bool EncounterManager::JoinPlayer(FEncounterId encounter, uint8_t side) {
+    return AddParticipant(encounter, side, PLAYER_SYMBOL, PLAYER_PARTICIPANT);
+}
+
+void EncounterManager::Leave(FSymbol character_id, std::vector<FNPC>& npcs) {
+    auto it = participant_slots.find(character_id);
+    if (it != participant_slots.end()) RemoveParticipant(it->second, &npcs);
+}
+
+void EncounterManager::MarkActive(FSymbol character_id, double now) {
+    auto it = participant_slots.find(character_id);
+    if (it == participant_slots.end()) return;
+    FEncounter& encounter = encounters[participant_encounters[it->second]];
+    encounter.expires_at = now + encounter.timeout_seconds;
+}
+
+void EncounterManager::MarkActive(FEncounterId encounter, double now) {
+    auto it = encounter_slots.find(encounter);
+    if (it == encounter_slots.end()) return;
+    FEncounter& active = encounters[it->second];
+    active.expires_at = now + active.timeout_seconds;
+}
+
+FEncounterId EncounterManager::GetEncounterOf(FSymbol character_id) const {
+    auto it = participant_slots.find(character_id);
+    return it != participant_slots.end() ? encounters[participant_encounters[it->second]].id : INVALID_ENCOUNTER;
+}
+
+uint8_t EncounterManager::GetSide(FSymbol character_id) const {
+    auto it = participant_slots.find(character_id);
+    return it != participant_slots.end() ? participant_sides[it->second] : MAX_SIDES;
+}
+
+size_t EncounterManager::GetParticipantCount(FEncounterId encounter) const {
+    auto it = encounter_slots.find(encounter);
+    return it != encounter_slots.end() ? encounters[it->second].participant_count : 0;
+}
+
+double EncounterManager::GetTimeRemaining(FEncounterId encounter, double now) const {
+    auto it = encounter_slots.find(encounter);
+    return it != encounter_slots.end() ? std::max(encounters[it->second].expires_at - now, 0.0) : 0.0;
+}
+
+void EncounterManager::Update(std::vector<FNPC>& npcs, bool player_alive, double now) {
+    ended.clear();
+    if (encounter_slots.empty()) return;
+
+    for (FEncounter& encounter : encounters) encounter.fighting_sides = 0;
+
+    // Who is still fighting, and on which sides, in one pass over every encounter's participants
+    const size_t count = participant_ids.size();
+    const size_t npc_count = npcs.size();
+    participant_fighting.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t npc = participant_npcs[i];
+        bool fighting = npc == PLAYER_PARTICIPANT ? player_alive
+                      : npc < npc_count && npcs[npc].is_alive && npcs[npc].is_in_combat;
+        participant_fighting[i] = fighting ? 1 : 0;
+        encounters[participant_encounters[i]].fighting_sides |= static_cast<uint8_t>(participant_fighting[i] << participant_sides[i]);
+    }
+
+    for (FEncounter& encounter : encounters) {
+        if (encounter.id == INVALID_ENCOUNTER) continue;
+        bool resolved = (encounter.fighting_sides & (encounter.fighting_sides - 1)) == 0;   // one side or none
+        bool timed_out = now >= encounter.expires_at;
+        if (!resolved && !timed_out) continue;
+
+        encounter.ending = true;
+        ended.push_back({ encounter.id, resolved ? EEncounterEnd::RESOLVED : EEncounterEnd::TIMED_OUT });
+        if (!resolved) Metrics().timed_out.Add();
+    }
+
+    // Backwards, so whoever is swapped into a gap has already been kept
+    for (size_t i = count; i-- > 0;) {
+        if (!participant_fighting[i] || encounters[participant_encounters[i]].ending) {
+            RemoveParticipant(static_cast<uint32_t>(i), &npcs);
+        }
+    }
+    for (const FEncounterEnd& end : ended) ReleaseEncounter(encounter_slots.find(end.id)->second);
+}
+
+bool EncounterManager::AddParticipant(FEncounterId encounter, uint8_t side, FSymbol character_id, uint32_t npc_index) {
+    auto encounter_it = encounter_slots.find(encounter);
+    if (encounter_it == encounter_slots.end() || side >= MAX_SIDES) return false;
+    uint32_t slot = encounter_it->second;
+
+    auto it = participant_slots.find(character_id);
+    if (it != participant_slots.end()) {
+        if (participant_encounters[it->second] == slot) {
+            participant_sides[it->second] = side;
+            return true;
+        }
+        // Moving between encounters; the combat flag stays set
+        RemoveParticipant(it->second, nullptr);
+    }
+
+    participant_slots[character_id] = static_cast<uint32_t>(participant_ids.size());
+    participant_ids.push_back(character_id);
+    participant_npcs.push_back(npc_index);
+    participant_encounters.push_back(slot);
+    participant_sides.push_back(side);
+    participant_fighting.push_back(1);
+    encounters[slot].participant_count++;
+    Metrics().combatants.Add(1);
+    return true;
+}
+
+void EncounterManager::RemoveParticipant(uint32_t participant, std::vector<FNPC>* npcs) {
+    uint32_t npc = participant_npcs[participant];
+    if (npcs && npc < npcs->size()) (*npcs)[npc].is_in_combat = false;
+    encounters[participant_encounters[participant]].participant_count--;
+    participant_slots.erase(participant_ids[participant]);
+
+    uint32_t last = static_cast<uint32_t>(participant_ids.size() - 1);
+    if (participant != last) {
+        participant_ids[participant] = participant_ids[last];
+        participant_npcs[participant] = participant_npcs[last];
+        participant_encounters[participant] = participant_encounters[last];
+        participant_sides[participant] = participant_sides[last];
+        participant_fighting[participant] = participant_fighting[last];
+        participant_slots[participant_ids[participant]] = participant;
+    }
+    participant_ids.pop_back();
+    participant_npcs.pop_back();
+    participant_encounters.pop_back();
+    participant_sides.pop_back();
+    participant_fighting.pop_back();
+    Metrics().combatants.Add(-1);
+}
+
+void EncounterManager::ReleaseEncounter(uint32_t slot) {
+    encounter_slots.erase(encounters[slot].id);
+    encounters[slot] = FEncounter();
+    free_slots.push_back(slot);
+    Metrics().active.Add(-1);
+}
+
+}  // namespace Nauvoo
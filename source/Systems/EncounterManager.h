@@ -0,0 +1,114 @@
+#pragma once
+
+#include "../Engine/CoreTypes.h"
+#include "../Engine/FlatMap.h"
+#include <cstdint>
+#include <vector>
+
+namespace Nauvoo {
+
+using FEncounterId = uint32_t;
+constexpr FEncounterId INVALID_ENCOUNTER = 0;
+
+// Participant NPC index standing for the player
+constexpr uint32_t PLAYER_PARTICIPANT = 0xFFFFFFFF;
+
+enum class EEncounterEnd : uint8_t {
+    RESOLVED,       // fewer than two sides still fighting
+    TIMED_OUT,      // nobody fired for the encounter's timeout
+    ENDED           // ended by the game
+};
+
+struct FEncounterEnd {
+    FEncounterId id = INVALID_ENCOUNTER;
+    EEncounterEnd reason = EEncounterEnd::ENDED;
+};
+
+/**
+ * Concurrent engagements, each with its own participants, sides and
+ * timeout. Participants of every encounter share one set of parallel
+ * arrays holding the NPC index, so the per-tick update is a single pass
+ * with no lookups by id; removal swaps the last participant into the gap.
+ * An NPC takes part in at most one encounter and its is_in_combat flag
+ * follows membership.
+ */
+class EncounterManager {
+public:
+    static constexpr double DEFAULT_TIMEOUT_SECONDS = 30.0;   // quiet time before an encounter ends
+    static constexpr uint8_t MAX_SIDES = 8;
+
+    EncounterManager();
+    ~EncounterManager();
+
+    FEncounterId StartEncounter(double now, double timeout_seconds = DEFAULT_TIMEOUT_SECONDS);
+    void EndEncounter(FEncounterId encounter, std::vector<FNPC>& npcs);
+    void Clear();
+
+    // Joining while in another encounter moves the participant; false for an unknown encounter or side.
+    // An NPC not already fighting starts with no combat decision
+    bool Join(FEncounterId encounter, uint8_t side, std::vector<FNPC>& npcs, uint32_t npc_index);
+    bool JoinPlayer(FEncounterId encounter, uint8_t side);
+    void Leave(FSymbol character_id, std::vector<FNPC>& npcs);
+
+    // Pushes back the timeout of the character's encounter, if any
+    void MarkActive(FSymbol character_id, double now);
+    void MarkActive(FEncounterId encounter, double now);
+
+    FEncounterId GetEncounterOf(FSymbol character_id) const;
+    // MAX_SIDES when the character is in no encounter
+    uint8_t GetSide(FSymbol character_id) const;
+    bool IsActive(FEncounterId encounter) const { return encounter_slots.contains(encounter); }
+    size_t GetActiveCount() const { return encounter_slots.size(); }
+    size_t GetParticipantCount() const { return participant_ids.size(); }
+    size_t GetParticipantCount(FEncounterId encounter) const;
+    double GetTimeRemaining(FEncounterId encounter, double now) const;
+
+    /**
+     * Drops participants who died, retreated (is_in_combat cleared) or, for
+     * the player, were defeated, then ends encounters with fewer than two
+     * sides left or past their timeout. The ended ones are in GetEnded()
+     * until the next update.
+     */
+    void Update(std::vector<FNPC>& npcs, bool player_alive, double now);
+    const std::vector<FEncounterEnd>& GetEnded() const { return ended; }
+
+    // Every participant as parallel arrays in no particular order, for passes over all combatants.
+    // Encounter slots are dense indices below GetEncounterSlotCount(), reused once an encounter ends
+    const std::vector<FSymbol>& GetParticipantIds() const { return participant_ids; }
+    const std::vector<uint32_t>& GetParticipantNPCs() const { return participant_npcs; }
+    const std::vector<uint32_t>& GetParticipantEncounterSlots() const { return participant_encounters; }
+    const std::vector<uint8_t>& GetParticipantSides() const { return participant_sides; }
+    size_t GetEncounterSlotCount() const { return encounters.size(); }
+
+private:
+    struct FEncounter {
+        FEncounterId id = INVALID_ENCOUNTER;
+        double timeout_seconds = DEFAULT_TIMEOUT_SECONDS;
+        double expires_at = 0.0;
+        uint32_t participant_count = 0;
+        uint8_t fighting_sides = 0;         // bit per side with someone still fighting, rebuilt each update
+        bool ending = false;
+    };
+
+    // Slots are reused once an encounter ends; ids are not
+    std::vector<FEncounter> encounters;
+    std::vector<uint32_t> free_slots;
+    TFlatHashMap<FEncounterId, uint32_t> encounter_slots;
+    FEncounterId next_id = 1;
+
+    // Participants, parallel arrays
+    std::vector<FSymbol> participant_ids;
+    std::vector<uint32_t> participant_npcs;         // index into the NPC list, or PLAYER_PARTICIPANT
+    std::vector<uint32_t> participant_encounters;   // encounter slot
+    std::vector<uint8_t> participant_sides;
+    std::vector<uint8_t> participant_fighting;      // scratch for Update
+    TFlatHashMap<FSymbol, uint32_t> participant_slots;
+
+    std::vector<FEncounterEnd> ended;
+
+    bool AddParticipant(FEncounterId encounter, uint8_t side, FSymbol character_id, uint32_t npc_index);
+    void RemoveParticipant(uint32_t participant, std::vector<FNPC>* npcs);
+    void ReleaseEncounter(uint32_t slot);
+};
+
+}  // namespace Nauvoo
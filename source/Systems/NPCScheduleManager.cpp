@@ -1,46 +1,97 @@
 #include "../Systems/NPCScheduleManager.h"
+#include "../Engine/JobSystem.h"
+#include "../Engine/Log.h"
+#include "../Engine/Metrics.h"
+#include "../Engine/SimulationLOD.h"
 #include <iostream>
 
 namespace Nauvoo {
 
-NPCScheduleManager::NPCScheduleManager() = default;
+namespace {
+
+struct FScheduleMetrics {
+    MetricCounter& transitions = MetricsRegistry::Get().GetCounter("schedule.transitions");
+    MetricHistogram& transitions_per_tick = MetricsRegistry::Get().GetHistogram("schedule.transitions_per_tick");
+    MetricCounter& overrides_set = MetricsRegistry::Get().GetCounter("schedule.overrides_set");
+    MetricGauge& schedules = MetricsRegistry::Get().GetGauge("schedule.schedules");
+};
+
+FScheduleMetrics& Metrics() {
+    static FScheduleMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
+NPCScheduleManager::NPCScheduleManager() {
+    Metrics();
+}
 
 NPCScheduleManager::~NPCScheduleManager() = default;
 
 void NPCScheduleManager::LoadSchedules(const std::string& schedule_data_file) {
     // Would load from JSON file
     // For MVP, schedules are hard-coded in character creation
-    std::cout << "[ScheduleManager] Schedules loaded from " << schedule_data_file << std::endl;
+    NAUVOO_LOG_INFO(ELogCategory::SCHEDULE, "[ScheduleManager] Schedules loaded from ", schedule_data_file);
 }
 
 void NPCScheduleManager::AddSchedule(const FNPCSchedule& schedule) {
-    schedules[schedule.npc_id] = schedule;
-    std::cout << "[ScheduleManager] Schedule added for NPC: " << schedule.npc_id << std::endl;
+    schedules[SymbolTable::Get().Intern(schedule.npc_id)] = schedule;
+    Metrics().schedules.Set(static_cast<int64_t>(schedules.size()));
+    NAUVOO_LOG_DEBUG(ELogCategory::SCHEDULE, "[ScheduleManager] Schedule added for NPC: ", schedule.npc_id);
 }
 
 void NPCScheduleManager::UpdateNPCSchedules(FDateTime current_time, std::vector<FNPC>& all_npcs) {
-    for (auto& npc : all_npcs) {
-        if (!npc.is_alive) continue;
-        
-        auto schedule_it = schedules.find(npc.id);
-        if (schedule_it == schedules.end()) continue;
-        
-        const FNPCSchedule& schedule = schedule_it->second;
-        
-        // Get activities for this season
-        const auto& activities = schedule.daily_routine;
-        
-        // Find current activity based on time
-        FScheduleActivity* current_activity = FindActivityForTime(activities, current_time.minute);
-        
-        if (current_activity) {
-            npc.current_activity = current_activity;
-        }
+    uint64_t transitions = 0;
+    for (FNPC& npc : all_npcs) {
+        if (UpdateNPCActivity(current_time, npc)) transitions++;
     }
+    PublishTransitions(transitions);
+}
+
+void NPCScheduleManager::UpdateNPCSchedules(FDateTime current_time, std::vector<FNPC>& all_npcs,
+                                            const FNPCTickList& tick_list, JobSystem& jobs) {
+    constexpr size_t NPCS_PER_JOB = 256;
+    std::atomic<uint64_t> transitions{ 0 };
+
+    jobs.ParallelFor(tick_list.GetCount(), NPCS_PER_JOB, [&](size_t, size_t begin, size_t end) {
+        uint64_t chunk_transitions = 0;
+        for (size_t i = begin; i < end; ++i) {
+            if (UpdateNPCActivity(current_time, all_npcs[tick_list.npc_indices[i]])) chunk_transitions++;
+        }
+        transitions.fetch_add(chunk_transitions, std::memory_order_relaxed);
+    });
+
+    PublishTransitions(transitions.load(std::memory_order_relaxed));
+}
+
+bool NPCScheduleManager::UpdateNPCActivity(FDateTime current_time, FNPC& npc) const {
+    if (!npc.is_alive) return false;
+    
+    auto schedule_it = schedules.find(npc.symbol);
+    if (schedule_it == schedules.end()) return false;
+    
+    const FNPCSchedule& schedule = schedule_it->second;
+    
+    // Get activities for this season
+    const auto& activities = schedule.daily_routine;
+    
+    // Find current activity based on time; a skipped interval simply lands on the current one
+    FScheduleActivity* current_activity = FindActivityForTime(activities, current_time.minute);
+    if (!current_activity) return false;
+    
+    bool changed = npc.current_activity != current_activity;
+    npc.current_activity = current_activity;
+    return changed;
+}
+
+void NPCScheduleManager::PublishTransitions(uint64_t transitions) const {
+    Metrics().transitions.Add(transitions);
+    Metrics().transitions_per_tick.Record(transitions);
 }
 
 FScheduleActivity* NPCScheduleManager::GetCurrentActivity(FNPC& npc, FDateTime current_time) {
-    auto schedule_it = schedules.find(npc.id);
+    auto schedule_it = schedules.find(npc.symbol);
     if (schedule_it == schedules.end()) return nullptr;
     
     const FNPCSchedule& schedule = schedule_it->second;
@@ -51,7 +102,7 @@ bool NPCScheduleManager::IsNPCAtLocation(const FNPC& npc, const std::string& loc
                                        FDateTime current_time) const {
     if (!npc.is_alive) return false;
     
-    auto schedule_it = schedules.find(npc.id);
+    auto schedule_it = schedules.find(npc.symbol);
     if (schedule_it == schedules.end()) return false;
     
     const FNPCSchedule& schedule = schedule_it->second;
@@ -62,14 +113,15 @@ bool NPCScheduleManager::IsNPCAtLocation(const FNPC& npc, const std::string& loc
     return activity && activity->location_id == location_id;
 }
 
-std::vector<std::string> NPCScheduleManager::GetNPCsAtLocation(const std::string& location_id,
-                                                             FDateTime current_time,
-                                                             const std::vector<FNPC>& all_npcs) const {
-    std::vector<std::string> npcs_at_location;
+std::pmr::vector<const FNPC*> NPCScheduleManager::GetNPCsAtLocation(const std::string& location_id,
+                                                                  FDateTime current_time,
+                                                                  const std::vector<FNPC>& all_npcs,
+                                                                  std::pmr::memory_resource* memory) const {
+    std::pmr::vector<const FNPC*> npcs_at_location(memory);
     
     for (const auto& npc : all_npcs) {
         if (IsNPCAtLocation(npc, location_id, current_time)) {
-            npcs_at_location.push_back(npc.id);
+            npcs_at_location.push_back(&npc);
         }
     }
     
@@ -78,15 +130,16 @@ std::vector<std::string> NPCScheduleManager::GetNPCsAtLocation(const std::string
 
 void NPCScheduleManager::SetEventOverride(const std::string& npc_id, const std::string& event_id,
                                          const std::vector<FScheduleActivity>& override_activities) {
-    event_overrides[npc_id] = { event_id, override_activities };
-    std::cout << "[ScheduleManager] Event override set for NPC " << npc_id << std::endl;
+    event_overrides[SymbolTable::Get().Intern(npc_id)] = { SymbolTable::Get().Intern(event_id), override_activities };
+    Metrics().overrides_set.Add();
+    NAUVOO_LOG_DEBUG(ELogCategory::SCHEDULE, "[ScheduleManager] Event override set for NPC ", npc_id);
 }
 
 void NPCScheduleManager::ClearEventOverride(const std::string& npc_id) {
-    auto it = event_overrides.find(npc_id);
+    auto it = event_overrides.find(SymbolTable::Get().Find(npc_id));
     if (it != event_overrides.end()) {
         event_overrides.erase(it);
-        std::cout << "[ScheduleManager] Event override cleared for NPC " << npc_id << std::endl;
+        NAUVOO_LOG_DEBUG(ELogCategory::SCHEDULE, "[ScheduleManager] Event override cleared for NPC ", npc_id);
     }
 }
 
@@ -107,7 +160,7 @@ FScheduleActivity* NPCScheduleManager::FindActivityForTime(const std::vector<FSc
 }
 
 void NPCScheduleManager::PrintNPCSchedule(const std::string& npc_id) const {
-    auto schedule_it = schedules.find(npc_id);
+    auto schedule_it = schedules.find(SymbolTable::Get().Find(npc_id));
     if (schedule_it == schedules.end()) {
         std::cout << "Schedule not found for NPC: " << npc_id << std::endl;
         return;
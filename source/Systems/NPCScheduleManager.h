@@ -1,13 +1,17 @@
 #pragma once
 
 #include "../Engine/CoreTypes.h"
+#include "../Engine/FlatMap.h"
 #include <string>
 #include <vector>
-#include <map>
 #include <memory>
+#include <memory_resource>
 
 namespace Nauvoo {
 
+class JobSystem;
+struct FNPCTickList;
+
 /**
  * Manages NPC daily routines and schedule-based behavior
  */
@@ -22,6 +26,9 @@ public:
 
     // Update routines based on time
     void UpdateNPCSchedules(FDateTime current_time, std::vector<FNPC>& all_npcs);
+    // Updates only the NPCs ticked this frame, split across the job system (schedules are only read)
+    void UpdateNPCSchedules(FDateTime current_time, std::vector<FNPC>& all_npcs,
+                            const FNPCTickList& tick_list, JobSystem& jobs);
 
     // Get NPC's current activity
     FScheduleActivity* GetCurrentActivity(FNPC& npc, FDateTime current_time);
@@ -29,10 +36,11 @@ public:
     // Check if NPC should be at location
     bool IsNPCAtLocation(const FNPC& npc, const std::string& location_id, FDateTime current_time) const;
 
-    // Get all NPCs at a location
-    std::vector<std::string> GetNPCsAtLocation(const std::string& location_id, 
-                                              FDateTime current_time, 
-                                              const std::vector<FNPC>& all_npcs) const;
+    // Get all NPCs at a location; pass the frame arena for a per-tick query
+    std::pmr::vector<const FNPC*> GetNPCsAtLocation(const std::string& location_id,
+                                                    FDateTime current_time,
+                                                    const std::vector<FNPC>& all_npcs,
+                                                    std::pmr::memory_resource* memory = std::pmr::get_default_resource()) const;
 
     // Event override (interrupt normal schedule)
     void SetEventOverride(const std::string& npc_id, const std::string& event_id, 
@@ -43,10 +51,13 @@ public:
     void PrintNPCSchedule(const std::string& npc_id) const;
 
 private:
-    std::map<std::string, FNPCSchedule> schedules;  // NPC_ID -> Schedule
-    std::map<std::string, std::pair<std::string, std::vector<FScheduleActivity>>> event_overrides;  // NPC_ID -> (event_id, activities)
+    TFlatHashMap<FSymbol, FNPCSchedule> schedules;  // NPC -> Schedule
+    TFlatHashMap<FSymbol, std::pair<FSymbol, std::vector<FScheduleActivity>>> event_overrides;  // NPC -> (event, activities)
 
     FScheduleActivity* FindActivityForTime(const std::vector<FScheduleActivity>& activities, int minute) const;
+    // Returns true when the NPC moved to a different activity
+    bool UpdateNPCActivity(FDateTime current_time, FNPC& npc) const;
+    void PublishTransitions(uint64_t transitions) const;
 };
 
 }  // namespace Nauvoo
@@ -1,11 +1,32 @@
 #include "../Systems/ReputationManager.h"
+#include "../Engine/Log.h"
+#include "../Engine/Metrics.h"
 #include <iostream>
 
 using json = std::string;  // Dummy for now
 
 namespace Nauvoo {
 
+namespace {
+
+struct FReputationMetrics {
+    MetricCounter& actions_recorded = MetricsRegistry::Get().GetCounter("reputation.actions_recorded");
+    MetricCounter& unknown_actions = MetricsRegistry::Get().GetCounter("reputation.unknown_actions");
+    MetricCounter& trust_changes = MetricsRegistry::Get().GetCounter("reputation.trust_changes");
+    MetricCounter& memories_added = MetricsRegistry::Get().GetCounter("reputation.memories_added");
+    MetricHistogram& memories_per_npc = MetricsRegistry::Get().GetHistogram("reputation.memories_per_npc");
+    MetricGauge& tracked_npcs = MetricsRegistry::Get().GetGauge("reputation.tracked_npcs");
+};
+
+FReputationMetrics& Metrics() {
+    static FReputationMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
 ReputationManager::ReputationManager() {
+    Metrics();
     LoadActionModifiers();
 }
 
@@ -23,58 +44,48 @@ void ReputationManager::Initialize() {
 void ReputationManager::LoadActionModifiers() {
     // This would load from action_modifiers.json
     // For now, using hard-coded values
-    action_modifiers["help_with_task"] = {
-        {"legion", 0},
-        {"community", 30},
-        {"outsider", 0}
-    };
-    
-    action_modifiers["attend_drill"] = {
-        {"legion", 20},
-        {"community", 0},
-        {"outsider", 0}
-    };
-    
-    action_modifiers["skip_drill"] = {
-        {"legion", -30},
-        {"community", 0},
-        {"outsider", 0}
-    };
-    
-    action_modifiers["enforce_curfew_harshly"] = {
-        {"legion", 25},
-        {"community", -30},
-        {"outsider", -20}
-    };
-    
-    action_modifiers["show_mercy_to_enemy"] = {
-        {"legion", -20},
-        {"community", 40},
-        {"outsider", 30}
-    };
-    
-    action_modifiers["refuse_order"] = {
-        {"legion", -40},
-        {"community", 30},
-        {"outsider", 10}
-    };
+    SymbolTable& symbols = SymbolTable::Get();
+    action_modifiers[symbols.Intern("help_with_task")] = { 0, 30, 0 };
+    action_modifiers[symbols.Intern("attend_drill")] = { 20, 0, 0 };
+    action_modifiers[symbols.Intern("skip_drill")] = { -30, 0, 0 };
+    action_modifiers[symbols.Intern("enforce_curfew_harshly")] = { 25, -30, -20 };
+    action_modifiers[symbols.Intern("show_mercy_to_enemy")] = { -20, 40, 30 };
+    action_modifiers[symbols.Intern("refuse_order")] = { -40, 30, 10 };
+    action_modifiers[symbols.Intern("kill_in_combat")] = { 10, 0, -10 };
 }
 
-void ReputationManager::RecordAction(const std::string& action_id, 
+void ReputationManager::RecordAction(const std::string& action_id,
                                     const std::vector<std::string>& witnesses) {
+    // Witness lists are short; the stack covers them
+    std::byte scratch[256];
+    std::pmr::monotonic_buffer_resource scratch_memory(scratch, sizeof(scratch));
+    std::pmr::vector<FSymbol> witness_symbols(&scratch_memory);
+    witness_symbols.reserve(witnesses.size());
+    for (const std::string& witness : witnesses) witness_symbols.push_back(FSymbol(witness));
+    RecordAction(SymbolTable::Get().Intern(action_id), witness_symbols);
+}
+
+void ReputationManager::RecordAction(FSymbol action_id, const std::pmr::vector<FSymbol>& witnesses) {
     auto modifier_it = action_modifiers.find(action_id);
     if (modifier_it == action_modifiers.end()) {
-        std::cout << "[ReputationManager] Unknown action: " << action_id << std::endl;
+        Metrics().unknown_actions.Add();
+        NAUVOO_LOG_WARNING(ELogCategory::REPUTATION, "[ReputationManager] Unknown action: ",
+                           SymbolTable::Get().GetName(action_id), " (", action_id.value, ")");
         return;
     }
 
-    const auto& modifiers = modifier_it->second;
-    
-    // Apply reputation changes
-    int legion_delta = modifiers.at("legion");
-    int community_delta = modifiers.at("community");
-    int outsider_delta = modifiers.at("outsider");
+    const FActionModifier& modifier = modifier_it->second;
+    ApplyReputationChange(modifier.legion, modifier.community, modifier.outsider);
     
+    Metrics().actions_recorded.Add();
+
+    NAUVOO_LOG_DEBUG(ELogCategory::REPUTATION, "[ReputationManager] Action recorded: ", SymbolTable::Get().GetName(action_id));
+    NAUVOO_LOG_DEBUG(ELogCategory::REPUTATION, "  Legion: ++", modifier.legion, " -> ", legion_reputation);
+    NAUVOO_LOG_DEBUG(ELogCategory::REPUTATION, "  Community: ++", modifier.community, " -> ", community_reputation);
+    NAUVOO_LOG_DEBUG(ELogCategory::REPUTATION, "  Outsider: ++", modifier.outsider, " -> ", outsider_reputation);
+}
+
+void ReputationManager::ApplyReputationChange(int legion_delta, int community_delta, int outsider_delta) {
     legion_reputation += legion_delta;
     community_reputation += community_delta;
     outsider_reputation += outsider_delta;
@@ -83,14 +94,9 @@ void ReputationManager::RecordAction(const std::string& action_id,
     legion_reputation = std::max(-100, std::min(100, legion_reputation));
     community_reputation = std::max(-100, std::min(100, community_reputation));
     outsider_reputation = std::max(-100, std::min(100, outsider_reputation));
-    
-    std::cout << "[ReputationManager] Action recorded: " << action_id << std::endl;
-    std::cout << "  Legion: " << "++" << legion_delta << " -> " << legion_reputation << std::endl;
-    std::cout << "  Community: " << "++" << community_delta << " -> " << community_reputation << std::endl;
-    std::cout << "  Outsider: " << "++" << outsider_delta << " -> " << outsider_reputation << std::endl;
 }
 
-int ReputationManager::GetNPCTrust(const std::string& npc_id) const {
+int ReputationManager::GetNPCTrust(FSymbol npc_id) const {
     auto it = npc_reputation_map.find(npc_id);
     if (it != npc_reputation_map.end()) {
         return it->second.trust;
@@ -98,24 +104,26 @@ int ReputationManager::GetNPCTrust(const std::string& npc_id) const {
     return 0;
 }
 
-void ReputationManager::ModifyNPCTrust(const std::string& npc_id, int delta) {
-    if (npc_reputation_map.find(npc_id) == npc_reputation_map.end()) {
-        npc_reputation_map[npc_id].npc_id = npc_id;
-    }
+void ReputationManager::ModifyNPCTrust(FSymbol npc_id, int delta) {
+    FReputationData& reputation = npc_reputation_map[npc_id];
+    reputation.npc_id = npc_id;
+    reputation.trust = std::max(-100, std::min(100, reputation.trust + delta));
     
-    npc_reputation_map[npc_id].trust += delta;
-    npc_reputation_map[npc_id].trust = std::max(-100, std::min(100, npc_reputation_map[npc_id].trust));
+    Metrics().trust_changes.Add();
+    Metrics().tracked_npcs.Set(static_cast<int64_t>(npc_reputation_map.size()));
     
-    std::cout << "[ReputationManager] NPC " << npc_id << " trust: " << npc_reputation_map[npc_id].trust << std::endl;
+    NAUVOO_LOG_DEBUG(ELogCategory::REPUTATION, "[ReputationManager] NPC ", SymbolTable::Get().GetName(npc_id), " trust: ", reputation.trust);
 }
 
-void ReputationManager::AddNPCMemory(const std::string& npc_id, const FActionMemory& memory) {
-    if (npc_reputation_map.find(npc_id) == npc_reputation_map.end()) {
-        npc_reputation_map[npc_id].npc_id = npc_id;
-    }
+void ReputationManager::AddNPCMemory(FSymbol npc_id, const FActionMemory& memory) {
+    FReputationData& reputation = npc_reputation_map[npc_id];
+    reputation.npc_id = npc_id;
+    reputation.memories.push_back(memory);
     
-    npc_reputation_map[npc_id].memories.push_back(memory);
-    std::cout << "[ReputationManager] Added memory for NPC " << npc_id << std::endl;
+    Metrics().memories_added.Add();
+    Metrics().memories_per_npc.Record(reputation.memories.size());
+    Metrics().tracked_npcs.Set(static_cast<int64_t>(npc_reputation_map.size()));
+    NAUVOO_LOG_DEBUG(ELogCategory::REPUTATION, "[ReputationManager] Added memory for NPC ", SymbolTable::Get().GetName(npc_id));
 }
 
 bool ReputationManager::CanAccessDialogue(const std::string& npc_id, 
@@ -1,12 +1,20 @@
 #pragma once
 
 #include "../Engine/CoreTypes.h"
+#include "../Engine/FlatMap.h"
 #include <string>
 #include <vector>
-#include <map>
+#include <memory_resource>
 
 namespace Nauvoo {
 
+// Faction deltas an action applies
+struct FActionModifier {
+    int legion = 0;
+    int community = 0;
+    int outsider = 0;
+};
+
 /**
  * Manages player reputation across three factions and tracks consequences
  */
@@ -25,12 +33,18 @@ public:
     int GetPersonalIntegrity() const { return personal_integrity; }
 
     // Record player action and apply reputation modifiers
+    void RecordAction(FSymbol action_id, const std::pmr::vector<FSymbol>& witnesses);
     void RecordAction(const std::string& action_id, const std::vector<std::string>& witnesses);
+    // Faction deltas that come from content rather than an action (e.g. finishing a scenario)
+    void ApplyReputationChange(int legion_delta, int community_delta, int outsider_delta);
 
     // NPC-specific reputation
-    int GetNPCTrust(const std::string& npc_id) const;
-    void ModifyNPCTrust(const std::string& npc_id, int delta);
-    void AddNPCMemory(const std::string& npc_id, const FActionMemory& memory);
+    int GetNPCTrust(FSymbol npc_id) const;
+    int GetNPCTrust(const std::string& npc_id) const { return GetNPCTrust(SymbolTable::Get().Find(npc_id)); }
+    void ModifyNPCTrust(FSymbol npc_id, int delta);
+    void ModifyNPCTrust(const std::string& npc_id, int delta) { ModifyNPCTrust(FSymbol(npc_id), delta); }
+    void AddNPCMemory(FSymbol npc_id, const FActionMemory& memory);
+    void AddNPCMemory(const std::string& npc_id, const FActionMemory& memory) { AddNPCMemory(FSymbol(npc_id), memory); }
 
     // Action history
     const std::vector<FPlayerAction>& GetActionHistory() const { return action_history; }
@@ -58,11 +72,11 @@ private:
     int personal_integrity = 0;      // -50 to 50
 
     std::vector<FPlayerAction> action_history;
-    std::map<std::string, FReputationData> npc_reputation_map;  // NPC_ID -> Reputation
+    TFlatHashMap<FSymbol, FReputationData> npc_reputation_map;  // NPC -> Reputation
 
     // Load reputation modifiers from action_modifiers.json
     void LoadActionModifiers();
-    std::map<std::string, std::map<std::string, int>> action_modifiers;  // action_id -> {faction -> delta}
+    TFlatHashMap<FSymbol, FActionModifier> action_modifiers;
 };
 
 }  // namespace Nauvoo
@@ -0,0 +1,381 @@
+#include "../Systems/SaveCodec.h"
+#include <cstring>
+
+namespace Nauvoo {
+
+namespace {
+
+void AppendLE(std::string& out, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+uint32_t ReadLE(const std::string& in, size_t offset, int bytes) {
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; ++i) {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(in[offset + i])) << (8 * i);
+    }
+    return value;
+}
+
+// LZ codec parameters
+constexpr size_t LZ_MIN_MATCH = 4;
+constexpr size_t LZ_LAST_LITERALS = 5;      // trailing bytes are always emitted as literals
+constexpr size_t LZ_MAX_OFFSET = 65535;
+constexpr int LZ_HASH_BITS = 14;
+constexpr size_t LZ_MAX_EXPANSION = 255;    // raw bytes one encoded byte can stand for at most (a length extension byte)
+
+inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t HashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+void PutExtendedLength(std::string& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(static_cast<char>(255));
+        length -= 255;
+    }
+    out.push_back(static_cast<char>(length));
+}
+
+void EmitSequence(std::string& out, const uint8_t* literals, size_t literal_count,
+                  size_t offset, size_t match_length) {
+    size_t match_code = match_length >= LZ_MIN_MATCH ? match_length - LZ_MIN_MATCH : 0;
+
+    uint8_t token = static_cast<uint8_t>((literal_count >= 15 ? 15 : literal_count) << 4);
+    if (match_length > 0) {
+        token |= static_cast<uint8_t>(match_code >= 15 ? 15 : match_code);
+    }
+    out.push_back(static_cast<char>(token));
+
+    if (literal_count >= 15) PutExtendedLength(out, literal_count - 15);
+    out.append(reinterpret_cast<const char*>(literals), literal_count);
+
+    if (match_length == 0) return;  // final literal run
+
+    AppendLE(out, static_cast<uint32_t>(offset), 2);
+    if (match_code >= 15) PutExtendedLength(out, match_code - 15);
+}
+
+bool GetExtendedLength(const std::string& in, size_t& ip, size_t& length) {
+    uint8_t byte;
+    do {
+        if (ip >= in.size()) return false;
+        byte = static_cast<uint8_t>(in[ip++]);
+        length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+}  // namespace
+
+// ==================== HEADER ====================
+
+void FSaveFileHeader::Write(std::string& out) const {
+    AppendLE(out, magic, 4);
+    AppendLE(out, format_version, 2);
+    out.push_back(static_cast<char>(codec));
+    out.push_back(static_cast<char>(flags));
+    AppendLE(out, raw_size, 4);
+    AppendLE(out, encoded_size, 4);
+    AppendLE(out, checksum, 4);
+}
+
+ESaveHeaderStatus FSaveFileHeader::Read(const std::string& in) {
+    if (in.size() < SIZE) return ESaveHeaderStatus::MISSING;
+
+    magic = ReadLE(in, 0, 4);
+    format_version = static_cast<uint16_t>(ReadLE(in, 4, 2));
+    codec = static_cast<ESaveCodec>(static_cast<uint8_t>(in[6]));
+    flags = static_cast<uint8_t>(in[7]);
+    raw_size = ReadLE(in, 8, 4);
+    encoded_size = ReadLE(in, 12, 4);
+    checksum = ReadLE(in, 16, 4);
+
+    if (magic != MAGIC) return ESaveHeaderStatus::MISSING;
+    return format_version <= FORMAT_VERSION ? ESaveHeaderStatus::VALID : ESaveHeaderStatus::UNSUPPORTED_VERSION;
+}
+
+uint32_t ComputeSaveChecksum(const std::string& data) {
+    uint32_t hash = 2166136261u;
+    for (char c : data) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// ==================== STORE CODEC ====================
+
+void StoreSaveCodec::Encode(const std::string& raw, std::string& encoded) const {
+    encoded = raw;
+}
+
+bool StoreSaveCodec::Decode(const std::string& encoded, size_t raw_size, std::string& raw) const {
+    if (encoded.size() != raw_size) return false;
+    raw = encoded;
+    return true;
+}
+
+// ==================== LZ CODEC ====================
+
+void LZSaveCodec::Encode(const std::string& raw, std::string& encoded) const {
+    encoded.clear();
+    encoded.reserve(raw.size() + raw.size() / 255 + 16);
+
+    const uint8_t* src = reinterpret_cast<const uint8_t*>(raw.data());
+    const size_t size = raw.size();
+
+    size_t anchor = 0;
+
+    if (size > LZ_MIN_MATCH + LZ_LAST_LITERALS) {
+        const size_t match_limit = size - LZ_LAST_LITERALS;
+        std::vector<uint32_t> table(size_t(1) << LZ_HASH_BITS, 0);  // position + 1, 0 = empty
+
+        size_t ip = 0;
+        while (ip + LZ_MIN_MATCH <= match_limit) {
+            uint32_t sequence = Read32(src + ip);
+            uint32_t& slot = table[HashSequence(sequence)];
+            size_t candidate = slot;
+            slot = static_cast<uint32_t>(ip + 1);
+
+            if (candidate == 0 || ip - (candidate - 1) > LZ_MAX_OFFSET
+                || Read32(src + candidate - 1) != sequence) {
+                ip++;
+                continue;
+            }
+
+            size_t ref = candidate - 1;
+            size_t length = LZ_MIN_MATCH;
+            while (ip + length < match_limit && src[ref + length] == src[ip + length]) {
+                length++;
+            }
+
+            EmitSequence(encoded, src + anchor, ip - anchor, ip - ref, length);
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    EmitSequence(encoded, src + anchor, size - anchor, 0, 0);
+}
+
+bool LZSaveCodec::Decode(const std::string& encoded, size_t raw_size, std::string& raw) const {
+    raw.clear();
+    // The size comes from the header, which may be corrupt; reserve no more than the input can expand to
+    if (raw_size > encoded.size() * LZ_MAX_EXPANSION + LZ_LAST_LITERALS) return false;
+    raw.reserve(raw_size);
+
+    size_t ip = 0;
+    while (ip < encoded.size()) {
+        uint8_t token = static_cast<uint8_t>(encoded[ip++]);
+
+        size_t literal_count = token >> 4;
+        if (literal_count == 15 && !GetExtendedLength(encoded, ip, literal_count)) return false;
+        if (literal_count > encoded.size() - ip) return false;
+        if (raw.size() + literal_count > raw_size) return false;
+
+        raw.append(encoded, ip, literal_count);
+        ip += literal_count;
+
+        if (ip == encoded.size()) break;  // final literal run carries no match
+
+        if (ip + 2 > encoded.size()) return false;
+        size_t offset = ReadLE(encoded, ip, 2);
+        ip += 2;
+        if (offset == 0 || offset > raw.size()) return false;
+
+        size_t match_length = token & 0x0F;
+        if (match_length == 15 && !GetExtendedLength(encoded, ip, match_length)) return false;
+        match_length += LZ_MIN_MATCH;
+        if (raw.size() + match_length > raw_size) return false;
+
+        size_t out_pos = raw.size();
+        size_t from = out_pos - offset;
+        raw.resize(out_pos + match_length);
+        char* out = &raw[0];
+        if (offset >= match_length) {
+            std::memcpy(out + out_pos, out + from, match_length);
+        } else {
+            // Overlapping copy repeats the last `offset` bytes
+            for (size_t i = 0; i < match_length; ++i) {
+                out[out_pos + i] = out[from + i];
+            }
+        }
+    }
+
+    return raw.size() == raw_size;
+}
+
+const ISaveCodec* GetSaveCodec(ESaveCodec codec_id) {
+    static const StoreSaveCodec store_codec;
+    static const LZSaveCodec lz_codec;
+
+    switch (codec_id) {
+        case ESaveCodec::STORE: return &store_codec;
+        case ESaveCodec::LZ:    return &lz_codec;
+    }
+    return nullptr;
+}
+
+// ==================== BINARY SECTIONS ====================
+
+void FSaveWriter::PutU32(uint32_t value) {
+    AppendLE(buffer, value, 4);
+}
+
+void FSaveWriter::PutVarint(uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+void FSaveWriter::PutString(const std::string& value) {
+    PutVarint(value.size());
+    buffer += value;
+}
+
+void FSaveWriter::PutChunk(uint32_t tag, const FSaveWriter& chunk) {
+    PutU32(tag);
+    PutString(chunk.buffer);
+}
+
+uint8_t FSaveReader::GetU8() {
+    if (pos >= data.size()) { ok = false; return 0; }
+    return static_cast<uint8_t>(data[pos++]);
+}
+
+uint32_t FSaveReader::GetU32() {
+    if (pos + 4 > data.size()) { ok = false; pos = data.size(); return 0; }
+    uint32_t value = ReadLE(data, pos, 4);
+    pos += 4;
+    return value;
+}
+
+uint64_t FSaveReader::GetVarint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (pos >= data.size()) { ok = false; return 0; }
+        uint8_t byte = static_cast<uint8_t>(data[pos++]);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return value;
+    }
+    ok = false;
+    return 0;
+}
+
+std::string FSaveReader::GetString() {
+    uint64_t length = GetVarint();
+    if (!ok || length > data.size() - pos) { ok = false; pos = data.size(); return {}; }
+    std::string value = data.substr(pos, static_cast<size_t>(length));
+    pos += static_cast<size_t>(length);
+    return value;
+}
+
+bool FSaveReader::GetChunk(uint32_t& tag, std::string& chunk) {
+    tag = GetU32();
+    chunk = GetString();
+    return ok;
+}
+
+uint32_t FSaveStringTable::Intern(const std::string& value) {
+    auto it = indices.find(value);
+    if (it != indices.end()) return it->second;
+
+    uint32_t index = static_cast<uint32_t>(strings.size());
+    strings.push_back(value);
+    indices.emplace(value, index);
+    return index;
+}
+
+const std::string& FSaveStringTable::Get(uint32_t index) const {
+    static const std::string empty;
+    return index < strings.size() ? strings[index] : empty;
+}
+
+void FSaveStringTable::Write(FSaveWriter& writer) const {
+    writer.PutVarint(strings.size());
+    for (const auto& value : strings) {
+        writer.PutString(value);
+    }
+}
+
+bool FSaveStringTable::Read(FSaveReader& reader) {
+    strings.clear();
+    indices.clear();
+
+    uint64_t count = reader.GetVarint();
+    for (uint64_t i = 0; i < count && reader.IsOk(); ++i) {
+        Intern(reader.GetString());
+    }
+    return reader.IsOk();
+}
+
+uint32_t FSaveSymbolTable::Add(FSymbol symbol) {
+    if (remap.emplace(symbol.value, symbol).second) symbols.push_back(symbol);
+    return symbol.value;
+}
+
+FSymbol FSaveSymbolTable::Resolve(uint64_t saved_value) const {
+    auto it = remap.find(static_cast<uint32_t>(saved_value));
+    return it != remap.end() ? it->second : FSymbol();
+}
+
+void FSaveSymbolTable::Write(FSaveWriter& writer) const {
+    const SymbolTable& table = SymbolTable::Get();
+    writer.PutVarint(symbols.size());
+    for (FSymbol symbol : symbols) {
+        writer.PutVarint(symbol.value);
+        writer.PutString(table.GetName(symbol));
+    }
+}
+
+bool FSaveSymbolTable::Read(FSaveReader& reader) {
+    symbols.clear();
+    remap.clear();
+
+    SymbolTable& table = SymbolTable::Get();
+    uint64_t count = reader.GetVarint();
+    for (uint64_t i = 0; i < count && reader.IsOk(); ++i) {
+        uint32_t saved_value = static_cast<uint32_t>(reader.GetVarint());
+        std::string name = reader.GetString();
+        // Values differ from run to run; a symbol saved without a name cannot be recovered
+        if (name.empty()) continue;
+        FSymbol symbol = table.Intern(name);
+        remap.emplace(saved_value, symbol);
+        symbols.push_back(symbol);
+    }
+    return reader.IsOk();
+}
+
+void WriteDeltaColumn(FSaveWriter& writer, const std::vector<int32_t>& column) {
+    writer.PutVarint(column.size());
+    int64_t previous = 0;
+    for (int32_t value : column) {
+        writer.PutZigZag(static_cast<int64_t>(value) - previous);
+        previous = value;
+    }
+}
+
+bool ReadDeltaColumn(FSaveReader& reader, std::vector<int32_t>& column) {
+    uint64_t count = reader.GetVarint();
+    column.clear();
+    if (!reader.IsOk()) return false;
+
+    int64_t previous = 0;
+    for (uint64_t i = 0; i < count && reader.IsOk(); ++i) {
+        previous += reader.GetZigZag();
+        column.push_back(static_cast<int32_t>(previous));
+    }
+    return reader.IsOk();
+}
+
+}  // namespace Nauvoo
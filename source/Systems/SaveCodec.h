@@ -0,0 +1,175 @@
+#pragma once
+
+#include "../Engine/Symbol.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Nauvoo {
+
+// ==================== SAVE FILE HEADER ====================
+
+enum class ESaveCodec : uint8_t {
+    STORE = 0,      // payload written as-is
+    LZ = 1          // in-tree LZ77 block codec (LZ4-style token stream)
+};
+
+enum class ESaveHeaderStatus : uint8_t {
+    VALID,
+    MISSING,                // no magic: a version 1 plain-text save
+    UNSUPPORTED_VERSION     // written by a newer build
+};
+
+/**
+ * Fixed-size header written in front of every save payload.
+ * Records which codec encoded the payload so old saves stay readable.
+ */
+struct FSaveFileHeader {
+    static constexpr uint32_t MAGIC = 0x5655414E;   // "NAUV"
+    static constexpr uint16_t FORMAT_VERSION = 2;
+    static constexpr size_t SIZE = 20;
+
+    uint32_t magic = MAGIC;
+    uint16_t format_version = FORMAT_VERSION;
+    ESaveCodec codec = ESaveCodec::STORE;
+    uint8_t flags = 0;
+    uint32_t raw_size = 0;
+    uint32_t encoded_size = 0;
+    uint32_t checksum = 0;          // FNV-1a of the raw payload
+
+    void Write(std::string& out) const;
+    ESaveHeaderStatus Read(const std::string& in);
+};
+
+uint32_t ComputeSaveChecksum(const std::string& data);
+
+// ==================== CODECS ====================
+
+/**
+ * Byte-level compression codec used beneath SaveGameManager file I/O
+ */
+class ISaveCodec {
+public:
+    virtual ~ISaveCodec() = default;
+
+    virtual ESaveCodec GetId() const = 0;
+    virtual const char* GetName() const = 0;
+
+    virtual void Encode(const std::string& raw, std::string& encoded) const = 0;
+    virtual bool Decode(const std::string& encoded, size_t raw_size, std::string& raw) const = 0;
+};
+
+class StoreSaveCodec : public ISaveCodec {
+public:
+    ESaveCodec GetId() const override { return ESaveCodec::STORE; }
+    const char* GetName() const override { return "store"; }
+
+    void Encode(const std::string& raw, std::string& encoded) const override;
+    bool Decode(const std::string& encoded, size_t raw_size, std::string& raw) const override;
+};
+
+class LZSaveCodec : public ISaveCodec {
+public:
+    ESaveCodec GetId() const override { return ESaveCodec::LZ; }
+    const char* GetName() const override { return "lz"; }
+
+    void Encode(const std::string& raw, std::string& encoded) const override;
+    bool Decode(const std::string& encoded, size_t raw_size, std::string& raw) const override;
+};
+
+// Returns the shared codec instance for an id, or nullptr for unknown ids
+const ISaveCodec* GetSaveCodec(ESaveCodec codec_id);
+
+// ==================== BINARY SECTIONS ====================
+
+/**
+ * Little-endian byte writer for the binary world sections of a save
+ */
+class FSaveWriter {
+public:
+    void PutU8(uint8_t value) { buffer.push_back(static_cast<char>(value)); }
+    void PutU32(uint32_t value);
+    void PutVarint(uint64_t value);
+    void PutZigZag(int64_t value) { PutVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63)); }
+    void PutString(const std::string& value);
+    void PutChunk(uint32_t tag, const FSaveWriter& chunk);
+
+    const std::string& GetBuffer() const { return buffer; }
+    std::string& GetBuffer() { return buffer; }
+
+private:
+    std::string buffer;
+};
+
+class FSaveReader {
+public:
+    FSaveReader(const std::string& data, size_t offset = 0) : data(data), pos(offset) {}
+
+    uint8_t GetU8();
+    uint32_t GetU32();
+    uint64_t GetVarint();
+    int64_t GetZigZag() { uint64_t v = GetVarint(); return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+    std::string GetString();
+    bool GetChunk(uint32_t& tag, std::string& chunk);
+
+    bool IsOk() const { return ok; }
+    bool AtEnd() const { return pos >= data.size(); }
+
+private:
+    const std::string& data;
+    size_t pos = 0;
+    bool ok = true;
+};
+
+constexpr uint32_t MakeChunkTag(char a, char b, char c, char d) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(a))
+         | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8)
+         | (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16)
+         | (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+}
+
+/**
+ * Deduplicates repeated strings (NPC ids, location ids, action ids)
+ * so each is written once and referenced by index
+ */
+class FSaveStringTable {
+public:
+    uint32_t Intern(const std::string& value);
+    const std::string& Get(uint32_t index) const;
+    size_t Size() const { return strings.size(); }
+
+    void Write(FSaveWriter& writer) const;
+    bool Read(FSaveReader& reader);
+
+private:
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, uint32_t> indices;
+};
+
+/**
+ * Names of the symbols a save stores by value. Symbol values are only
+ * stable within a run, so reading interns every name and maps each saved
+ * value to the symbol the name has now.
+ */
+class FSaveSymbolTable {
+public:
+    // Saving: returns the value to write
+    uint32_t Add(FSymbol symbol);
+    // Loading: invalid for values the table does not name
+    FSymbol Resolve(uint64_t saved_value) const;
+    size_t Size() const { return symbols.size(); }
+
+    void Write(FSaveWriter& writer) const;
+    bool Read(FSaveReader& reader);
+
+private:
+    std::vector<FSymbol> symbols;
+    std::unordered_map<uint32_t, FSymbol> remap;    // saved value -> symbol
+};
+
+// Numeric columns are stored as zig-zag varint deltas from the previous row
+void WriteDeltaColumn(FSaveWriter& writer, const std::vector<int32_t>& column);
+bool ReadDeltaColumn(FSaveReader& reader, std::vector<int32_t>& column);
+
+}  // namespace Nauvoo
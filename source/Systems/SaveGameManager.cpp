@@ -1,43 +1,82 @@
 #include "../Systems/SaveGameManager.h"
+#include "../Engine/Log.h"
+#include "../Engine/Metrics.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <filesystem>
+#include <iterator>
+#include <string_view>
+#include <unordered_map>
+#include <cstring>
+#include <chrono>
+#include <cmath>
 
 namespace fs = std::filesystem;
 
 namespace Nauvoo {
 
+namespace {
+
+const char* const WORLD_DATA_MARKER = "=== WORLD DATA ===\n";
+
+constexpr uint32_t CHUNK_WORLD = MakeChunkTag('W', 'R', 'L', 'D');
+constexpr uint32_t CHUNK_NPCS = MakeChunkTag('N', 'P', 'C', 'S');
+constexpr uint32_t CHUNK_RANDOM = MakeChunkTag('R', 'A', 'N', 'D');
+constexpr uint32_t CHUNK_EVENTS = MakeChunkTag('E', 'V', 'N', 'T');
+constexpr uint32_t CHUNK_SCENARIOS = MakeChunkTag('S', 'C', 'E', 'N');
+constexpr uint32_t CHUNK_SYMBOLS = MakeChunkTag('S', 'Y', 'M', 'B');
+
+// Floats are stored as fixed-point hundredths so they delta-encode well
+inline int32_t ToCenti(float value) { return static_cast<int32_t>(std::lround(value * 100.0f)); }
+inline float FromCenti(int32_t value) { return static_cast<float>(value) / 100.0f; }
+
+struct FSaveMetrics {
+    MetricCounter& saves = MetricsRegistry::Get().GetCounter("save.saves");
+    MetricCounter& save_failures = MetricsRegistry::Get().GetCounter("save.save_failures");
+    MetricCounter& loads = MetricsRegistry::Get().GetCounter("save.loads");
+    MetricCounter& load_failures = MetricsRegistry::Get().GetCounter("save.load_failures");
+    MetricCounter& bytes_written = MetricsRegistry::Get().GetCounter("save.bytes_written");
+    MetricCounter& payload_bytes = MetricsRegistry::Get().GetCounter("save.payload_bytes");
+    MetricHistogram& file_bytes = MetricsRegistry::Get().GetHistogram("save.file_bytes");
+    MetricHistogram& write_us = MetricsRegistry::Get().GetHistogram("save.write_us");
+};
+
+FSaveMetrics& Metrics() {
+    static FSaveMetrics metrics;
+    return metrics;
+}
+
+}  // namespace
+
 SaveGameManager::SaveGameManager() {
+    Metrics();
     save_directory = "./saves";
-    
-    // Create save directory if it doesn't exist
-    if (!fs::exists(save_directory)) {
-        fs::create_directories(save_directory);
-        std::cout << "[SaveGameManager] Created save directory: " << save_directory << std::endl;
-    }
 }
 
 SaveGameManager::~SaveGameManager() = default;
 
 void SaveGameManager::SaveGame(const FWorldState& world_state, const std::string& save_slot) {
     std::string filename = save_directory + "/" + save_slot + ".nauvoo";
+    auto start = std::chrono::steady_clock::now();
+    std::string save_data = BuildSavePayload(world_state);
     
-    std::string save_data;
-    save_data += "=== NAUVOO SAVE FILE ===\n";
-    save_data += "Version: 1.0\n";
-    save_data += "Date: " + std::to_string(world_state.current_time.year) + "-" 
-                 + std::to_string(world_state.current_time.month) + "-"
-                 + std::to_string(world_state.current_time.day) + "\n";
-    save_data += "Time: " + std::to_string(world_state.current_time.minute) + "\n";
-    save_data += "\n";
-    save_data += SerializePlayerState(world_state.player);
-    save_data += "\n";
-    save_data += SerializeWorldState(world_state);
+    // Created on the first save, so managers that never write (loading, benchmarks) leave no directory behind
+    std::error_code error;
+    if (!fs::exists(save_directory, error) && fs::create_directories(save_directory, error)) {
+        NAUVOO_LOG_INFO(ELogCategory::SAVE, "[SaveGameManager] Created save directory: ", save_directory);
+    }
     
     if (WriteFile(filename, save_data)) {
-        std::cout << "[SaveGameManager] Game saved to " << filename << std::endl;
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        Metrics().saves.Add();
+        Metrics().payload_bytes.Add(save_data.size());
+        Metrics().write_us.Record(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+        NAUVOO_LOG_INFO(ELogCategory::SAVE, "[SaveGameManager] Game saved to ", filename);
     } else {
-        std::cout << "[SaveGameManager] Failed to save game to " << filename << std::endl;
+        Metrics().save_failures.Add();
+        NAUVOO_LOG_ERROR(ELogCategory::SAVE, "[SaveGameManager] Failed to save game to ", filename);
     }
 }
 
@@ -46,12 +85,19 @@ bool SaveGameManager::LoadGame(const std::string& save_slot, FWorldState& world_
     std::string content;
     
     if (!ReadFile(filename, content)) {
-        std::cout << "[SaveGameManager] Failed to read save file: " << filename << std::endl;
+        Metrics().load_failures.Add();
+        NAUVOO_LOG_ERROR(ELogCategory::SAVE, "[SaveGameManager] Failed to read save file: ", filename);
         return false;
     }
     
-    // Parse content and populate world_state
-    std::cout << "[SaveGameManager] Game loaded from " << filename << std::endl;
+    if (!DeserializeWorldState(content, world_state)) {
+        Metrics().load_failures.Add();
+        NAUVOO_LOG_ERROR(ELogCategory::SAVE, "[SaveGameManager] Corrupt world data in save file: ", filename);
+        return false;
+    }
+    
+    Metrics().loads.Add();
+    NAUVOO_LOG_INFO(ELogCategory::SAVE, "[SaveGameManager] Game loaded from ", filename);
     return true;
 }
 
@@ -81,7 +127,7 @@ void SaveGameManager::DeleteSave(const std::string& save_slot) {
     
     if (fs::exists(filename)) {
         fs::remove(filename);
-        std::cout << "[SaveGameManager] Deleted save: " << save_slot << std::endl;
+        NAUVOO_LOG_INFO(ELogCategory::SAVE, "[SaveGameManager] Deleted save: ", save_slot);
     }
 }
 
@@ -94,6 +140,23 @@ void SaveGameManager::AutoSave(const FWorldState& world_state, int game_day) {
     }
 }
 
+std::string SaveGameManager::BuildSavePayload(const FWorldState& world_state) const {
+    std::string save_data;
+    save_data += "=== NAUVOO SAVE FILE ===\n";
+    save_data += "Version: 2.0\n";
+    save_data += "Date: " + std::to_string(world_state.current_time.year) + "-" 
+                 + std::to_string(world_state.current_time.month) + "-"
+                 + std::to_string(world_state.current_time.day) + "\n";
+    save_data += "Time: " + std::to_string(world_state.current_time.minute) + "\n";
+    save_data += "\n";
+    save_data += SerializePlayerState(world_state.player);
+    save_data += "\n";
+    save_data += SerializeWorldState(world_state);
+    save_data += WORLD_DATA_MARKER;
+    save_data += SerializeWorldData(world_state);
+    return save_data;
+}
+
 std::string SaveGameManager::SerializePlayerState(const FPlayerState& player) const {
     std::string data;
     data += "=== PLAYER STATE ===\n";
@@ -111,8 +174,8 @@ std::string SaveGameManager::SerializeWorldState(const FWorldState& world) const
     std::string data;
     data += "=== WORLD STATE ===\n";
     data += "Total NPCs: " + std::to_string(world.all_npcs.size()) + "\n";
-    data += "Active Events: " + std::to_string(world.active_events.size()) + "\n";
-    data += "Completed Events: " + std::to_string(world.completed_events.size()) + "\n";
+    data += "Active Events: " + std::to_string(world.world_events.GetActiveCount()) + "\n";
+    data += "Completed Events: " + std::to_string(world.world_events.GetCompletedCount()) + "\n";
     return data;
 }
 
@@ -130,8 +193,13 @@ bool SaveGameManager::DeserializePlayerState(const std::string& data, FPlayerSta
 }
 
 bool SaveGameManager::DeserializeWorldState(const std::string& data, FWorldState& world) {
-    // Would parse data and populate world state
-    return true;
+    size_t marker = data.find(WORLD_DATA_MARKER);
+    if (marker == std::string::npos) {
+        // Version 1 saves only carry the text summary
+        return true;
+    }
+    
+    return DeserializeWorldData(data.substr(marker + std::strlen(WORLD_DATA_MARKER)), world);
 }
 
 bool SaveGameManager::DeserializeNPCState(const std::string& data, FNPC& npc) {
@@ -139,30 +207,482 @@ bool SaveGameManager::DeserializeNPCState(const std::string& data, FNPC& npc) {
     return true;
 }
 
+std::string SaveGameManager::SerializeWorldData(const FWorldState& world) const {
+    FSaveWriter world_chunk;
+    const FDateTime& time = world.current_time;
+    world_chunk.PutZigZag(time.year);
+    world_chunk.PutZigZag(time.month);
+    world_chunk.PutZigZag(time.day);
+    world_chunk.PutZigZag(time.minute);
+    
+    const FPlayerState& player = world.player;
+    world_chunk.PutZigZag(ToCenti(player.position.x));
+    world_chunk.PutZigZag(ToCenti(player.position.y));
+    world_chunk.PutZigZag(ToCenti(player.position.z));
+    world_chunk.PutZigZag(ToCenti(player.health));
+    world_chunk.PutZigZag(ToCenti(player.max_health));
+    world_chunk.PutZigZag(ToCenti(player.stamina));
+    world_chunk.PutZigZag(ToCenti(player.max_stamina));
+    world_chunk.PutZigZag(player.legion_reputation);
+    world_chunk.PutZigZag(player.community_reputation);
+    world_chunk.PutZigZag(player.outsider_reputation);
+    world_chunk.PutZigZag(player.personal_integrity);
+    world_chunk.PutU8(static_cast<uint8_t>(player.legion_rank));
+    world_chunk.PutString(player.equipped_weapon_id);
+    
+    FSaveWriter events_chunk;
+    SerializeWorldEvents(world.world_events, events_chunk);
+    
+    FSaveSymbolTable symbols;
+    FSaveWriter scenario_chunk;
+    SerializeScenarios(world.scenarios, symbols, scenario_chunk);
+    
+    // Ahead of every chunk that stores symbols, so loading can resolve them
+    FSaveWriter symbol_chunk;
+    symbols.Write(symbol_chunk);
+    
+    FSaveWriter npc_chunk;
+    SerializeNPCTable(world.all_npcs, npc_chunk);
+    
+    FSaveWriter random_chunk;
+    random_chunk.PutVarint(world.world_seed);
+    random_chunk.PutVarint(world.rng_stream_states.size());
+    for (uint64_t word : world.rng_stream_states) random_chunk.PutVarint(word);
+    
+    FSaveWriter writer;
+    writer.PutChunk(CHUNK_WORLD, world_chunk);
+    writer.PutChunk(CHUNK_EVENTS, events_chunk);
+    writer.PutChunk(CHUNK_SYMBOLS, symbol_chunk);
+    writer.PutChunk(CHUNK_SCENARIOS, scenario_chunk);
+    writer.PutChunk(CHUNK_NPCS, npc_chunk);
+    writer.PutChunk(CHUNK_RANDOM, random_chunk);
+    return writer.GetBuffer();
+}
+
+void SaveGameManager::SerializeNPCTable(const std::vector<FNPC>& npcs, FSaveWriter& writer) const {
+    FSaveStringTable strings;
+    std::vector<int32_t> ids, names, occupations, locations;
+    std::vector<int32_t> ages, factions, ranks, alive, in_combat;
+    std::vector<int32_t> health, max_health, pos_x, pos_y, pos_z;
+    std::vector<int32_t> trust, fear, respect, injury_counts;
+    std::vector<int32_t> injury_types, injury_parts, injury_severity, injury_bleed, injury_treated;
+    std::vector<int32_t> mood_fear, mood_anger, panicking;
+    
+    for (const FNPC& npc : npcs) {
+        ids.push_back(static_cast<int32_t>(strings.Intern(npc.id)));
+        names.push_back(static_cast<int32_t>(strings.Intern(npc.name)));
+        occupations.push_back(static_cast<int32_t>(strings.Intern(npc.occupation)));
+        locations.push_back(static_cast<int32_t>(strings.Intern(
+            npc.current_activity ? npc.current_activity->location_id : std::string())));
+        
+        ages.push_back(npc.age);
+        factions.push_back(static_cast<int32_t>(npc.faction));
+        ranks.push_back(static_cast<int32_t>(npc.rank));
+        alive.push_back(npc.is_alive ? 1 : 0);
+        in_combat.push_back(npc.is_in_combat ? 1 : 0);
+        health.push_back(ToCenti(npc.health));
+        max_health.push_back(ToCenti(npc.max_health));
+        pos_x.push_back(ToCenti(npc.position.x));
+        pos_y.push_back(ToCenti(npc.position.y));
+        pos_z.push_back(ToCenti(npc.position.z));
+        trust.push_back(npc.reputation_with_player.trust);
+        fear.push_back(npc.reputation_with_player.fear);
+        respect.push_back(npc.reputation_with_player.respect);
+        injury_counts.push_back(static_cast<int32_t>(npc.injuries.size()));
+        mood_fear.push_back(ToCenti(npc.fear));
+        mood_anger.push_back(ToCenti(npc.anger));
+        panicking.push_back(npc.is_panicking ? 1 : 0);
+        
+        for (const FInjury& injury : npc.injuries) {
+            injury_types.push_back(static_cast<int32_t>(injury.type));
+            injury_parts.push_back(static_cast<int32_t>(injury.location));
+            injury_severity.push_back(injury.severity);
+            injury_bleed.push_back(injury.bleed_centi);
+            injury_treated.push_back(injury.is_treated ? 1 : 0);
+        }
+    }
+    
+    strings.Write(writer);
+    for (const auto* column : { &ids, &names, &occupations, &locations,
+                                &ages, &factions, &ranks, &alive, &in_combat,
+                                &health, &max_health, &pos_x, &pos_y, &pos_z,
+                                &trust, &fear, &respect, &injury_counts,
+                                &injury_types, &injury_parts, &injury_severity,
+                                &injury_bleed, &injury_treated }) {
+        WriteDeltaColumn(writer, *column);
+    }
+    // Last, so tables written before crowd morale still read
+    for (const auto* column : { &mood_fear, &mood_anger, &panicking }) {
+        WriteDeltaColumn(writer, *column);
+    }
+}
+
+bool SaveGameManager::DeserializeWorldData(const std::string& data, FWorldState& world) {
+    FSaveReader reader(data);
+    world.scenarios.clear();    // saves from before scenarios restart them all
+    FSaveSymbolTable symbols;
+    bool has_symbols = false;   // saves from before symbols store scenario ids as text
+    
+    while (!reader.AtEnd()) {
+        uint32_t tag = 0;
+        std::string chunk;
+        if (!reader.GetChunk(tag, chunk)) return false;
+        
+        if (tag == CHUNK_NPCS) {
+            if (!DeserializeNPCTable(chunk, world.all_npcs)) return false;
+            continue;
+        }
+        if (tag == CHUNK_EVENTS) {
+            if (!DeserializeWorldEvents(chunk, world.world_events)) return false;
+            continue;
+        }
+        if (tag == CHUNK_SYMBOLS) {
+            FSaveReader chunk_reader(chunk);
+            if (!symbols.Read(chunk_reader)) return false;
+            has_symbols = true;
+            continue;
+        }
+        if (tag == CHUNK_SCENARIOS) {
+            if (!DeserializeScenarios(chunk, has_symbols ? &symbols : nullptr, world.scenarios)) return false;
+            continue;
+        }
+        if (tag == CHUNK_RANDOM) {
+            FSaveReader chunk_reader(chunk);
+            world.world_seed = chunk_reader.GetVarint();
+            uint64_t word_count = chunk_reader.GetVarint();
+            world.rng_stream_states.clear();
+            for (uint64_t i = 0; i < word_count && chunk_reader.IsOk(); ++i) {
+                world.rng_stream_states.push_back(chunk_reader.GetVarint());
+            }
+            if (!chunk_reader.IsOk()) return false;
+            continue;
+        }
+        if (tag != CHUNK_WORLD) continue;  // unknown chunks are skipped
+        
+        FSaveReader chunk_reader(chunk);
+        FDateTime& time = world.current_time;
+        time.year = static_cast<int>(chunk_reader.GetZigZag());
+        time.month = static_cast<int>(chunk_reader.GetZigZag());
+        time.day = static_cast<int>(chunk_reader.GetZigZag());
+        time.minute = static_cast<int>(chunk_reader.GetZigZag());
+        
+        FPlayerState& player = world.player;
+        player.position.x = FromCenti(static_cast<int32_t>(chunk_reader.GetZigZag()));
+        player.position.y = FromCenti(static_cast<int32_t>(chunk_reader.GetZigZag()));
+        player.position.z = FromCenti(static_cast<int32_t>(chunk_reader.GetZigZag()));
+        player.health = FromCenti(static_cast<int32_t>(chunk_reader.GetZigZag()));
+        player.max_health = FromCenti(static_cast<int32_t>(chunk_reader.GetZigZag()));
+        player.stamina = FromCenti(static_cast<int32_t>(chunk_reader.GetZigZag()));
+        player.max_stamina = FromCenti(static_cast<int32_t>(chunk_reader.GetZigZag()));
+        player.legion_reputation = static_cast<int>(chunk_reader.GetZigZag());
+        player.community_reputation = static_cast<int>(chunk_reader.GetZigZag());
+        player.outsider_reputation = static_cast<int>(chunk_reader.GetZigZag());
+        player.personal_integrity = static_cast<int>(chunk_reader.GetZigZag());
+        player.legion_rank = static_cast<ELegionRank>(chunk_reader.GetU8());
+        player.equipped_weapon_id = chunk_reader.GetString();
+        
+        // Older saves list world events by name at the end of this chunk
+        if (!chunk_reader.AtEnd()) {
+            WorldEventRegistry& events = world.world_events;
+            events.ResetState();
+            uint64_t active_count = chunk_reader.GetVarint();
+            for (uint64_t i = 0; i < active_count && chunk_reader.IsOk(); ++i) {
+                events.Trigger(events.Intern(chunk_reader.GetString()));
+            }
+            uint64_t completed_count = chunk_reader.GetVarint();
+            for (uint64_t i = 0; i < completed_count && chunk_reader.IsOk(); ++i) {
+                FWorldEventId id = events.Intern(chunk_reader.GetString());
+                events.Trigger(id);
+                events.Complete(id);
+            }
+            uint64_t counter_count = chunk_reader.GetVarint();
+            for (uint64_t i = 0; i < counter_count && chunk_reader.IsOk(); ++i) {
+                FWorldEventId id = events.Intern(chunk_reader.GetString());
+                events.SetCounter(id, static_cast<int>(chunk_reader.GetZigZag()));
+            }
+        }
+        
+        if (!chunk_reader.IsOk()) return false;
+    }
+    
+    return reader.IsOk();
+}
+
+void SaveGameManager::SerializeWorldEvents(const WorldEventRegistry& events, FSaveWriter& writer) const {
+    // Names in id order, then the flag words and the non-zero counters by id
+    writer.PutVarint(events.GetEventCount());
+    for (FWorldEventId id = 0; id < events.GetEventCount(); ++id) {
+        writer.PutString(events.GetName(id));
+    }
+    
+    for (const auto* bits : { &events.GetActiveBits(), &events.GetCompletedBits() }) {
+        writer.PutVarint(bits->size());
+        for (uint64_t word : *bits) writer.PutVarint(word);
+    }
+    
+    const std::vector<int32_t>& counters = events.GetCounters();
+    size_t nonzero = static_cast<size_t>(std::count_if(counters.begin(), counters.end(), [](int32_t value) { return value != 0; }));
+    writer.PutVarint(nonzero);
+    for (FWorldEventId id = 0; id < counters.size(); ++id) {
+        if (counters[id] == 0) continue;
+        writer.PutVarint(id);
+        writer.PutZigZag(counters[id]);
+    }
+}
+
+bool SaveGameManager::DeserializeWorldEvents(const std::string& chunk, WorldEventRegistry& events) {
+    FSaveReader reader(chunk);
+    events.ResetState();
+    
+    // Saved ids are remapped through the names; the registry may already know some under other ids
+    uint64_t name_count = reader.GetVarint();
+    std::vector<FWorldEventId> ids;
+    for (uint64_t i = 0; i < name_count && reader.IsOk(); ++i) {
+        ids.push_back(events.Intern(reader.GetString()));
+    }
+    
+    std::vector<uint64_t> active_bits, completed_bits;
+    for (auto* bits : { &active_bits, &completed_bits }) {
+        uint64_t word_count = reader.GetVarint();
+        for (uint64_t i = 0; i < word_count && reader.IsOk(); ++i) bits->push_back(reader.GetVarint());
+    }
+    if (!reader.IsOk()) return false;
+    
+    auto test_bit = [](const std::vector<uint64_t>& bits, size_t index) {
+        return index / 64 < bits.size() && (bits[index / 64] >> (index % 64)) & 1;
+    };
+    for (size_t index = 0; index < ids.size(); ++index) {
+        bool active = test_bit(active_bits, index);
+        bool completed = test_bit(completed_bits, index);
+        if (active || completed) events.Trigger(ids[index]);
+        if (completed) {
+            events.Complete(ids[index]);
+            if (active) events.Trigger(ids[index]);
+        }
+    }
+    
+    uint64_t counter_count = reader.GetVarint();
+    for (uint64_t i = 0; i < counter_count && reader.IsOk(); ++i) {
+        uint64_t index = reader.GetVarint();
+        int value = static_cast<int>(reader.GetZigZag());
+        if (index >= ids.size()) return false;
+        events.SetCounter(ids[index], value);
+    }
+    
+    return reader.IsOk();
+}
+
+void SaveGameManager::SerializeScenarios(const std::vector<FScenarioProgress>& scenarios, FSaveSymbolTable& symbols,
+                                         FSaveWriter& writer) const {
+    // Keyed by id so edits to the scenario data keep old saves loadable
+    writer.PutVarint(scenarios.size());
+    for (const FScenarioProgress& progress : scenarios) {
+        writer.PutVarint(symbols.Add(progress.scenario_id));
+        writer.PutU8(static_cast<uint8_t>(progress.status));
+        writer.PutVarint(progress.objectives_done);
+        writer.PutVarint(progress.events_fired);
+        writer.PutVarint(progress.times_completed);
+    }
+}
+
+bool SaveGameManager::DeserializeScenarios(const std::string& chunk, const FSaveSymbolTable* symbols,
+                                           std::vector<FScenarioProgress>& scenarios) {
+    FSaveReader reader(chunk);
+    uint64_t count = reader.GetVarint();
+    for (uint64_t i = 0; i < count && reader.IsOk(); ++i) {
+        FScenarioProgress progress;
+        progress.scenario_id = symbols ? symbols->Resolve(reader.GetVarint()) : SymbolTable::Get().Intern(reader.GetString());
+        progress.status = static_cast<EScenarioStatus>(reader.GetU8());
+        progress.objectives_done = static_cast<uint32_t>(reader.GetVarint());
+        progress.events_fired = static_cast<uint32_t>(reader.GetVarint());
+        progress.times_completed = static_cast<uint32_t>(reader.GetVarint());
+        if (progress.status > EScenarioStatus::FAILED || !progress.scenario_id.IsValid()) return false;
+        scenarios.push_back(std::move(progress));
+    }
+    return reader.IsOk();
+}
+
+bool SaveGameManager::DeserializeNPCTable(const std::string& chunk, std::vector<FNPC>& npcs) {
+    FSaveReader reader(chunk);
+    FSaveStringTable strings;
+    if (!strings.Read(reader)) return false;
+    
+    std::vector<int32_t> ids, names, occupations, locations;
+    std::vector<int32_t> ages, factions, ranks, alive, in_combat;
+    std::vector<int32_t> health, max_health, pos_x, pos_y, pos_z;
+    std::vector<int32_t> trust, fear, respect, injury_counts;
+    std::vector<int32_t> injury_types, injury_parts, injury_severity, injury_bleed, injury_treated;
+    
+    for (auto* column : { &ids, &names, &occupations, &locations,
+                          &ages, &factions, &ranks, &alive, &in_combat,
+                          &health, &max_health, &pos_x, &pos_y, &pos_z,
+                          &trust, &fear, &respect, &injury_counts }) {
+        if (!ReadDeltaColumn(reader, *column) || column->size() != ids.size()) return false;
+    }
+    
+    for (auto* column : { &injury_types, &injury_parts, &injury_severity,
+                          &injury_bleed, &injury_treated }) {
+        if (!ReadDeltaColumn(reader, *column)) return false;
+    }
+    
+    // Tables from before crowd morale end here; NPCs carried over keep their mood, new ones start calm
+    std::vector<int32_t> mood_fear, mood_anger, panicking;
+    bool has_morale = !reader.AtEnd();
+    for (auto* column : { &mood_fear, &mood_anger, &panicking }) {
+        if (has_morale && (!ReadDeltaColumn(reader, *column) || column->size() != ids.size())) return false;
+    }
+    
+    size_t injury_total = injury_types.size();
+    if (injury_parts.size() != injury_total || injury_severity.size() != injury_total
+        || injury_bleed.size() != injury_total || injury_treated.size() != injury_total) {
+        return false;
+    }
+    
+    // Checked before anything is touched, so a bad table leaves the world as it was
+    size_t injuries_claimed = 0;
+    for (int32_t injury_count : injury_counts) {
+        if (injury_count < 0) return false;
+        injuries_claimed += static_cast<size_t>(injury_count);
+    }
+    if (injuries_claimed != injury_total) return false;
+
+    // Enums must name a member and packed fields must fit, or the casts below invent values
+    auto in_range = [](const std::vector<int32_t>& column, int32_t last) {
+        return std::all_of(column.begin(), column.end(), [last](int32_t value) { return value >= 0 && value <= last; });
+    };
+    if (!in_range(factions, static_cast<int32_t>(EFaction::NEUTRAL))
+        || !in_range(ranks, static_cast<int32_t>(ELegionRank::COMMANDER))
+        || !in_range(injury_types, static_cast<int32_t>(EInjuryType::INTERNAL_BLEEDING))
+        || !in_range(injury_parts, static_cast<int32_t>(EBodyPart::RIGHT_LEG))
+        || !in_range(injury_severity, UINT8_MAX) || !in_range(injury_bleed, UINT16_MAX)) {
+        return false;
+    }
+
+    // By the text itself: ids here are exact, and loading should not intern a symbol per NPC
+    std::unordered_map<std::string_view, uint32_t> live_indices;
+    live_indices.reserve(npcs.size());
+    for (uint32_t n = 0; n < npcs.size(); ++n) live_indices.emplace(npcs[n].id, n);
+    
+    // The saved table replaces the list; NPCs it names carry over what the save does not store
+    std::vector<FNPC> loaded(ids.size());
+    size_t injury_cursor = 0;
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const std::string& npc_id = strings.Get(static_cast<uint32_t>(ids[i]));
+        FNPC* npc = &loaded[i];
+        auto live = live_indices.find(npc_id);
+        if (live != live_indices.end()) {
+            uint32_t live_index = live->second;
+            live_indices.erase(live);   // before the move empties the id the key points at; a duplicate starts fresh
+            *npc = std::move(npcs[live_index]);
+        }
+        npc->id = npc_id;
+        
+        npc->name = strings.Get(static_cast<uint32_t>(names[i]));
+        npc->occupation = strings.Get(static_cast<uint32_t>(occupations[i]));
+        npc->age = ages[i];
+        npc->faction = static_cast<EFaction>(factions[i]);
+        npc->rank = static_cast<ELegionRank>(ranks[i]);
+        npc->is_alive = alive[i] != 0;
+        npc->is_in_combat = in_combat[i] != 0;
+        npc->health = FromCenti(health[i]);
+        npc->max_health = FromCenti(max_health[i]);
+        npc->position = { FromCenti(pos_x[i]), FromCenti(pos_y[i]), FromCenti(pos_z[i]) };
+        npc->reputation_with_player.trust = trust[i];
+        npc->reputation_with_player.fear = fear[i];
+        npc->reputation_with_player.respect = respect[i];
+        if (has_morale) {
+            npc->fear = std::clamp(FromCenti(mood_fear[i]), 0.0f, 1.0f);
+            npc->anger = std::clamp(FromCenti(mood_anger[i]), 0.0f, 1.0f);
+            npc->is_panicking = panicking[i] != 0;
+        }
+        
+        npc->injuries.clear();
+        for (int32_t k = 0; k < injury_counts[i]; ++k) {
+            FInjury injury;
+            injury.type = static_cast<EInjuryType>(injury_types[injury_cursor]);
+            injury.location = static_cast<EBodyPart>(injury_parts[injury_cursor]);
+            injury.severity = static_cast<uint8_t>(injury_severity[injury_cursor]);
+            injury.bleed_centi = static_cast<uint16_t>(injury_bleed[injury_cursor]);
+            injury.is_treated = injury_treated[injury_cursor] != 0;
+            npc->injuries.push_back(injury);
+            injury_cursor++;
+        }
+    }
+    
+    npcs.swap(loaded);
+    return true;
+}
+
 bool SaveGameManager::WriteFile(const std::string& filename, const std::string& content) {
-    std::ofstream file(filename);
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         return false;
     }
     
-    file << content;
+    const ISaveCodec* save_codec = GetSaveCodec(codec);
+    if (!save_codec) save_codec = GetSaveCodec(ESaveCodec::STORE);
+    
+    std::string encoded;
+    save_codec->Encode(content, encoded);
+    
+    // Incompressible payloads are stored raw rather than expanded
+    if (encoded.size() >= content.size()) {
+        save_codec = GetSaveCodec(ESaveCodec::STORE);
+        save_codec->Encode(content, encoded);
+    }
+    
+    FSaveFileHeader header;
+    header.codec = save_codec->GetId();
+    header.raw_size = static_cast<uint32_t>(content.size());
+    header.encoded_size = static_cast<uint32_t>(encoded.size());
+    header.checksum = ComputeSaveChecksum(content);
+    
+    std::string header_bytes;
+    header.Write(header_bytes);
+    
+    file.write(header_bytes.data(), static_cast<std::streamsize>(header_bytes.size()));
+    file.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
     file.close();
-    return true;
+    
+    if (file.good()) {
+        Metrics().bytes_written.Add(header_bytes.size() + encoded.size());
+        Metrics().file_bytes.Record(header_bytes.size() + encoded.size());
+    }
+    return file.good();
 }
 
 bool SaveGameManager::ReadFile(const std::string& filename, std::string& content) {
-    std::ifstream file(filename);
+    std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         return false;
     }
     
-    std::string line;
-    while (std::getline(file, line)) {
-        content += line + "\n";
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    
+    FSaveFileHeader header;
+    ESaveHeaderStatus status = header.Read(bytes);
+    if (status == ESaveHeaderStatus::MISSING) {
+        // Version 1 saves are plain text without a header
+        content = bytes;
+        return true;
+    }
+    if (status == ESaveHeaderStatus::UNSUPPORTED_VERSION) {
+        NAUVOO_LOG_ERROR(ELogCategory::SAVE, "[SaveGameManager] ", filename, " is save format ", header.format_version,
+                         "; this build reads up to ", FSaveFileHeader::FORMAT_VERSION);
+        return false;
     }
     
-    file.close();
-    return true;
+    const ISaveCodec* save_codec = GetSaveCodec(header.codec);
+    if (!save_codec || bytes.size() - FSaveFileHeader::SIZE != header.encoded_size) {
+        return false;
+    }
+    
+    if (!save_codec->Decode(bytes.substr(FSaveFileHeader::SIZE), header.raw_size, content)) {
+        return false;
+    }
+    
+    return ComputeSaveChecksum(content) == header.checksum;
 }
 
 }  // namespace Nauvoo
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Engine/CoreTypes.h"
+#include "SaveCodec.h"
 #include <string>
 #include <vector>
 
@@ -27,10 +28,18 @@ public:
     void EnableAutoSave(bool enable) { auto_save_enabled = enable; }
     void AutoSave(const FWorldState& world_state, int game_day);
 
+    // Compression
+    void SetCodec(ESaveCodec codec_id) { codec = codec_id; }
+    ESaveCodec GetCodec() const { return codec; }
+
+    // Uncompressed payload for a world (text summary followed by binary world data)
+    std::string BuildSavePayload(const FWorldState& world_state) const;
+
 private:
     std::string save_directory;
     bool auto_save_enabled = true;
     int last_autosave_day = -1;
+    ESaveCodec codec = ESaveCodec::LZ;
 
     // Serialization helpers
     std::string SerializePlayerState(const FPlayerState& player) const;
@@ -41,7 +50,20 @@ private:
     bool DeserializeWorldState(const std::string& data, FWorldState& world);
     bool DeserializeNPCState(const std::string& data, FNPC& npc);
 
-    // File I/O
+    // Binary world data: string-table deduplicated, delta-encoded columns
+    std::string SerializeWorldData(const FWorldState& world) const;
+    void SerializeNPCTable(const std::vector<FNPC>& npcs, FSaveWriter& writer) const;
+    bool DeserializeWorldData(const std::string& data, FWorldState& world);
+    bool DeserializeNPCTable(const std::string& chunk, std::vector<FNPC>& npcs);
+    void SerializeWorldEvents(const WorldEventRegistry& events, FSaveWriter& writer) const;
+    bool DeserializeWorldEvents(const std::string& chunk, WorldEventRegistry& events);
+    void SerializeScenarios(const std::vector<FScenarioProgress>& scenarios, FSaveSymbolTable& symbols,
+                            FSaveWriter& writer) const;
+    // Without symbols the chunk predates them and names each scenario
+    bool DeserializeScenarios(const std::string& chunk, const FSaveSymbolTable* symbols,
+                              std::vector<FScenarioProgress>& scenarios);
+
+    // File I/O (payload is run through the selected codec behind a FSaveFileHeader)
     bool WriteFile(const std::string& filename, const std::string& content);
     bool ReadFile(const std::string& filename, std::string& content);
 };
@@ -0,0 +1,552 @@
+#include "../Systems/ScenarioManager.h"
+#include "../Engine/GameEvents.h"
+#include "../Engine/JsonReader.h"
+#include "../Engine/Log.h"
+#include "../Engine/Metrics.h"
+#include "ReputationManager.h"
+#include <cstdio>
+
+namespace Nauvoo {
+
+namespace {
+
+struct FScenarioMetrics {
+    MetricCounter& started = MetricsRegistry::Get().GetCounter("scenario.started");
+    MetricCounter& completed = MetricsRegistry::Get().GetCounter("scenario.completed");
+    MetricCounter& failed = MetricsRegistry::Get().GetCounter("scenario.failed");
+    MetricCounter& events_fired = MetricsRegistry::Get().GetCounter("scenario.events_fired");
+    MetricCounter& evaluations = MetricsRegistry::Get().GetCounter("scenario.evaluations");
+};
+
+FScenarioMetrics& Metrics() {
+    static FScenarioMetrics metrics;
+    return metrics;
+}
+
+bool StartsWith(const std::string& text, const char* prefix) {
+    return text.compare(0, std::char_traits<char>::length(prefix), prefix) == 0;
+}
+
+bool SamePosition(const FVector3& a, const FVector3& b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+uint32_t LowBits(size_t count) {
+    return count >= 32 ? UINT32_MAX : (1u << count) - 1;
+}
+
+// "MM-DD-YYYY" and "HH:MM" as in the scenario data; -1 when either is missing, malformed or off the 30-day calendar
+int64_t ParseStartMinute(const std::string& date, const std::string& time) {
+    int month = 0, day = 0, year = 0, hour = 0, minute = 0;
+    if (std::sscanf(date.c_str(), "%d-%d-%d", &month, &day, &year) != 3) return -1;
+    if (std::sscanf(time.c_str(), "%d:%d", &hour, &minute) != 2) return -1;
+    if (month < 1 || month > 12 || day < 1 || day > 30 || hour < 0 || hour > 23 || minute < 0 || minute > 59) return -1;
+
+    FDateTime start{ year, month, day, hour * 60 + minute };
+    return start.GetCalendarMinutes();
+}
+
+// The data names triggers rather than typing them; the kind follows from the name and the fields beside it
+EScenarioTrigger ClassifyEventTrigger(const FJsonValue& event, const FScenarioDef& scenario, std::string& key) {
+    std::string trigger = event.GetString("trigger");
+    std::string npc_id = event.GetString("npc_id");
+    std::string dialogue_tree_id = event.GetString("dialogue_tree_id");
+
+    if (trigger.empty()) {
+        key = dialogue_tree_id;
+        return dialogue_tree_id.empty() ? EScenarioTrigger::START : EScenarioTrigger::DIALOGUE;
+    }
+    if (StartsWith(trigger, "player_near_") && !npc_id.empty()) {
+        key = npc_id;
+        return EScenarioTrigger::PROXIMITY;
+    }
+    if (StartsWith(trigger, "player_arrives_") && !scenario.location_id.empty()) {
+        key = scenario.location_id;
+        return EScenarioTrigger::LOCATION;
+    }
+    key = trigger;
+    return EScenarioTrigger::EVENT;
+}
+
+}  // namespace
+
+ScenarioManager::ScenarioManager(FWorldState& world_state, ReputationManager* reputation_mgr, TimerWheel* timers)
+    : world(world_state), reputation_manager(reputation_mgr), game_timers(timers) {
+    Metrics();
+}
+
+ScenarioManager::~ScenarioManager() {
+    if (!game_timers) return;
+    for (FTimerHandle& handle : start_timers) game_timers->Cancel(handle);
+}
+
+// ==================== Definitions ====================
+
+bool ScenarioManager::LoadScenarios(const std::string& scenario_data_file) {
+    FJsonValue root;
+    std::string error;
+    if (!JsonReader::ParseFile(scenario_data_file, root, &error)) {
+        NAUVOO_LOG_WARNING(ELogCategory::GAME, "[ScenarioManager] Could not load ", scenario_data_file, ": ", error);
+        return false;
+    }
+    if (!LoadScenarios(root)) return false;
+
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[ScenarioManager] ", scenarios.size(), " scenarios loaded from ", scenario_data_file);
+    return true;
+}
+
+bool ScenarioManager::LoadScenarios(const FJsonValue& root) {
+    const FJsonValue& list = root["phase_1_scenarios"];
+    if (!list.IsArray()) {
+        NAUVOO_LOG_WARNING(ELogCategory::GAME, "[ScenarioManager] Missing phase_1_scenarios array");
+        return false;
+    }
+
+    WorldEventRegistry& world_events = world.world_events;
+    std::vector<FScenarioDef> loaded;
+    TFlatHashMap<FSymbol, uint32_t> loaded_ids;
+    std::vector<std::string> prerequisites;
+    SymbolTable& symbols = SymbolTable::Get();
+
+    for (size_t i = 0; i < list.GetSize(); ++i) {
+        const FJsonValue& entry = list[i];
+        FScenarioDef scenario;
+        scenario.id = entry.GetString("id");
+        if (!scenario.id.empty()) scenario.symbol = symbols.Intern(scenario.id);
+        if (scenario.id.empty() || loaded_ids.count(scenario.symbol)) {
+            NAUVOO_LOG_WARNING(ELogCategory::GAME, "[ScenarioManager] Skipping scenario with missing or duplicate id: ", scenario.id);
+            continue;
+        }
+
+        scenario.name = entry.GetString("name");
+        std::string trigger = entry.GetString("trigger");
+        if (!trigger.empty()) scenario.trigger_event = world_events.Intern(trigger);
+        std::string start_date = entry.GetString("start_date");
+        scenario.start_minute = ParseStartMinute(start_date, entry.GetString("start_time"));
+        if (scenario.start_minute < 0 && !start_date.empty()) {
+            NAUVOO_LOG_WARNING(ELogCategory::GAME, "[ScenarioManager] ", scenario.id, " has an invalid start date ",
+                               start_date, "; it can start at any time");
+        }
+        scenario.location_id = entry.GetString("location_id");
+        scenario.repeatable = entry.GetBool("repeatable");
+
+        const FJsonValue& objectives = entry["objectives"];
+        for (size_t o = 0; o < objectives.GetSize() && o < MAX_OBJECTIVES; ++o) {
+            scenario.objectives.push_back(objectives[o].string);
+        }
+
+        const FJsonValue& events = entry["events"];
+        for (size_t e = 0; e < events.GetSize() && e < MAX_EVENTS; ++e) {
+            FScenarioEventDef event;
+            event.id = events[e].GetString("id");
+            event.trigger = ClassifyEventTrigger(events[e], scenario, event.trigger_key);
+            if (event.trigger == EScenarioTrigger::EVENT) {
+                event.trigger_event = world_events.Intern(event.trigger_key);
+            } else if (!event.trigger_key.empty()) {
+                event.trigger_symbol = symbols.Intern(event.trigger_key);
+            }
+            if (!event.id.empty()) event.fired_event = world_events.Intern(event.id);
+            event.one_time = events[e].GetBool("one_time");
+            scenario.events.push_back(std::move(event));
+        }
+        if (objectives.GetSize() > MAX_OBJECTIVES || events.GetSize() > MAX_EVENTS) {
+            NAUVOO_LOG_WARNING(ELogCategory::GAME, "[ScenarioManager] ", scenario.id, " truncated to ",
+                               MAX_OBJECTIVES, " objectives and ", MAX_EVENTS, " events");
+        }
+
+        const FJsonValue& reputation = entry["reputation_changes"];
+        scenario.legion_delta = static_cast<int>(reputation.GetNumber("legion_delta"));
+        scenario.community_delta = static_cast<int>(reputation.GetNumber("community_delta"));
+        scenario.outsider_delta = static_cast<int>(reputation.GetNumber("outsider_delta"));
+
+        loaded_ids.emplace(scenario.symbol, static_cast<uint32_t>(loaded.size()));
+        prerequisites.push_back(entry.GetString("prerequisite_scenario"));
+        loaded.push_back(std::move(scenario));
+    }
+
+    // Prerequisites may name scenarios defined later in the file
+    for (size_t i = 0; i < loaded.size(); ++i) {
+        if (prerequisites[i].empty()) continue;
+        auto it = loaded_ids.find(SymbolTable::Get().Find(prerequisites[i]));
+        if (it == loaded_ids.end()) {
+            NAUVOO_LOG_WARNING(ELogCategory::GAME, "[ScenarioManager] ", loaded[i].id,
+                               " requires unknown scenario ", prerequisites[i], "; ignoring the requirement");
+            continue;
+        }
+        loaded[i].prerequisite = static_cast<int>(it->second);
+    }
+
+    scenarios = std::move(loaded);
+    scenario_ids = std::move(loaded_ids);
+    BuildIndexes();
+    // The clock may not be set yet, so no start timers until ResetProgress or RestoreProgress
+    ClearProgress();
+    return true;
+}
+
+const FScenarioDef* ScenarioManager::FindScenario(const std::string& scenario_id) const {
+    auto it = scenario_ids.find(SymbolTable::Get().Find(scenario_id));
+    return it != scenario_ids.end() ? &scenarios[it->second] : nullptr;
+}
+
+void ScenarioManager::BuildIndexes() {
+    scenarios_by_event.clear();
+    events_by_world_event.clear();
+    events_by_dialogue.clear();
+
+    for (uint32_t s = 0; s < scenarios.size(); ++s) {
+        FScenarioDef& scenario = scenarios[s];
+        if (scenario.trigger_event != INVALID_WORLD_EVENT) scenarios_by_event[scenario.trigger_event].push_back(s);
+        if (scenario.prerequisite >= 0) scenarios[scenario.prerequisite].dependents.push_back(s);
+
+        for (uint32_t e = 0; e < scenario.events.size(); ++e) {
+            const FScenarioEventDef& event = scenario.events[e];
+            if (event.trigger == EScenarioTrigger::EVENT) {
+                events_by_world_event[event.trigger_event].push_back({ s, e });
+            } else if (event.trigger == EScenarioTrigger::DIALOGUE) {
+                events_by_dialogue[event.trigger_symbol].push_back({ s, e });
+            }
+        }
+    }
+}
+
+// ==================== Progress ====================
+
+void ScenarioManager::ResetProgress() {
+    ClearProgress();
+    RebuildRuntimeState();
+}
+
+void ScenarioManager::ClearProgress() {
+    world.scenarios.clear();
+    for (const FScenarioDef& scenario : scenarios) {
+        FScenarioProgress progress;
+        progress.scenario_id = scenario.symbol;
+        world.scenarios.push_back(std::move(progress));
+    }
+
+    if (game_timers) {
+        for (FTimerHandle& handle : start_timers) game_timers->Cancel(handle);
+    }
+    start_timers.clear();
+    position_watches.clear();
+    pending_events.clear();
+    player_position_known = false;
+    dirty_scenarios.clear();
+    is_dirty.assign(scenarios.size(), 0);
+}
+
+void ScenarioManager::RestoreProgress() {
+    std::vector<FScenarioProgress> restored(scenarios.size());
+    for (size_t s = 0; s < scenarios.size(); ++s) restored[s].scenario_id = scenarios[s].symbol;
+
+    // Saved in whatever order the data had then; scenarios since removed are dropped, new ones start locked
+    for (const FScenarioProgress& entry : world.scenarios) {
+        auto it = scenario_ids.find(entry.scenario_id);
+        if (it == scenario_ids.end()) {
+            NAUVOO_LOG_DEBUG(ELogCategory::GAME, "[ScenarioManager] Dropping progress for unknown scenario ",
+                             SymbolTable::Get().GetName(entry.scenario_id));
+            continue;
+        }
+        const FScenarioDef& scenario = scenarios[it->second];
+        FScenarioProgress& progress = restored[it->second];
+        progress.status = entry.status;
+        progress.objectives_done = entry.objectives_done & LowBits(scenario.objectives.size());
+        progress.events_fired = entry.events_fired & LowBits(scenario.events.size());
+        progress.times_completed = entry.times_completed;
+    }
+
+    world.scenarios = std::move(restored);
+    RebuildRuntimeState();
+}
+
+void ScenarioManager::RebuildRuntimeState() {
+    position_watches.clear();
+    pending_events.clear();
+    player_position_known = false;
+
+    for (uint32_t s = 0; s < scenarios.size(); ++s) {
+        if (world.scenarios[s].status == EScenarioStatus::ACTIVE) WatchPositionEvents(s);
+    }
+    ArmStartTimers();
+
+    // One full pass picks up whatever already holds (triggers fired before a load, start times passed)
+    dirty_scenarios.clear();
+    is_dirty.assign(scenarios.size(), 0);
+    for (uint32_t s = 0; s < scenarios.size(); ++s) MarkDirty(s);
+}
+
+void ScenarioManager::ArmStartTimers() {
+    if (!game_timers) return;
+
+    for (FTimerHandle& handle : start_timers) game_timers->Cancel(handle);
+    start_timers.assign(scenarios.size(), FTimerHandle());
+
+    // Relative to now on the same calendar the clock advances by, so the delay is the minutes to wait
+    int64_t now = world.current_time.GetCalendarMinutes();
+    for (uint32_t s = 0; s < scenarios.size(); ++s) {
+        if (scenarios[s].start_minute <= now) continue;
+        uint64_t delay = static_cast<uint64_t>(scenarios[s].start_minute - now);
+        start_timers[s] = game_timers->ScheduleAfter(delay, [this, s]() { MarkDirty(s); });
+    }
+}
+
+void ScenarioManager::MarkDirty(uint32_t scenario_index) {
+    if (is_dirty[scenario_index]) return;
+    is_dirty[scenario_index] = 1;
+    dirty_scenarios.push_back(scenario_index);
+}
+
+// ==================== Inputs ====================
+
+void ScenarioManager::OnWorldEventChanged(FWorldEventId event_id, EWorldEventChange change) {
+    if (change == EWorldEventChange::COUNTER) return;
+
+    // Completing a trigger event still counts as it having happened
+    auto scenario_it = scenarios_by_event.find(event_id);
+    if (scenario_it != scenarios_by_event.end()) {
+        for (uint32_t s : scenario_it->second) MarkDirty(s);
+    }
+
+    if (change != EWorldEventChange::TRIGGERED) return;
+    auto event_it = events_by_world_event.find(event_id);
+    if (event_it != events_by_world_event.end()) {
+        pending_events.insert(pending_events.end(), event_it->second.begin(), event_it->second.end());
+    }
+}
+
+void ScenarioManager::OnDialogueStarted(FSymbol tree_id) {
+    auto it = events_by_dialogue.find(tree_id);
+    if (it != events_by_dialogue.end()) {
+        pending_events.insert(pending_events.end(), it->second.begin(), it->second.end());
+    }
+}
+
+// ==================== Evaluation ====================
+
+void ScenarioManager::Update() {
+    uint64_t evaluated = evaluations;
+
+    for (size_t i = 0; i < dirty_scenarios.size(); ++i) {
+        uint32_t s = dirty_scenarios[i];
+        is_dirty[s] = 0;
+        evaluations++;
+        if (CanStart(s)) StartScenario(s);
+    }
+    dirty_scenarios.clear();
+
+    for (size_t i = 0; i < pending_events.size(); ++i) {
+        FEventRef ref = pending_events[i];
+        evaluations++;
+        if (IsEventTriggered(ref)) FireEvent(ref);
+    }
+    pending_events.clear();
+
+    UpdatePositionWatches();
+    Metrics().evaluations.Add(evaluations - evaluated);
+}
+
+bool ScenarioManager::CanStart(uint32_t scenario_index) const {
+    const FScenarioDef& scenario = scenarios[scenario_index];
+    const FScenarioProgress& progress = world.scenarios[scenario_index];
+
+    bool restartable = scenario.repeatable
+        && (progress.status == EScenarioStatus::COMPLETED || progress.status == EScenarioStatus::FAILED);
+    if (progress.status != EScenarioStatus::LOCKED && !restartable) return false;
+
+    const WorldEventRegistry& world_events = world.world_events;
+    if (scenario.trigger_event != INVALID_WORLD_EVENT
+        && !world_events.IsActive(scenario.trigger_event) && !world_events.IsCompleted(scenario.trigger_event)) {
+        return false;
+    }
+    if (scenario.prerequisite >= 0 && world.scenarios[scenario.prerequisite].times_completed == 0) return false;
+    return scenario.start_minute < 0 || world.current_time.GetCalendarMinutes() >= scenario.start_minute;
+}
+
+bool ScenarioManager::IsEventTriggered(const FEventRef& ref) const {
+    const FScenarioProgress& progress = world.scenarios[ref.scenario];
+    const FScenarioEventDef& event = scenarios[ref.scenario].events[ref.event];
+    if (progress.status != EScenarioStatus::ACTIVE) return false;
+    if (event.one_time && (progress.events_fired >> ref.event) & 1) return false;
+
+    switch (event.trigger) {
+        case EScenarioTrigger::EVENT: return world.world_events.IsActive(event.trigger_event);
+        case EScenarioTrigger::DIALOGUE: return true;   // only queued as the tree opens
+        default: return false;                          // START fires on start; positions are watched
+    }
+}
+
+void ScenarioManager::StartScenario(uint32_t scenario_index) {
+    const FScenarioDef& scenario = scenarios[scenario_index];
+    FScenarioProgress& progress = world.scenarios[scenario_index];
+    progress.status = EScenarioStatus::ACTIVE;
+    progress.objectives_done = 0;
+    progress.events_fired = 0;
+    Metrics().started.Add();
+    NAUVOO_LOG_INFO(ELogCategory::GAME, "[ScenarioManager] Scenario started: ", scenario.name);
+
+    for (uint32_t e = 0; e < scenario.events.size(); ++e) {
+        FEventRef ref{ scenario_index, e };
+        if (scenario.events[e].trigger == EScenarioTrigger::START || IsEventTriggered(ref)) FireEvent(ref);
+    }
+    WatchPositionEvents(scenario_index);
+}
+
+void ScenarioManager::FinishScenario(uint32_t scenario_index, EScenarioStatus status) {
+    const FScenarioDef& scenario = scenarios[scenario_index];
+    FScenarioProgress& progress = world.scenarios[scenario_index];
+    progress.status = status;
+    UnwatchScenario(scenario_index);
+
+    if (status == EScenarioStatus::COMPLETED) {
+        progress.times_completed++;
+        if (reputation_manager) {
+            reputation_manager->ApplyReputationChange(scenario.legion_delta, scenario.community_delta, scenario.outsider_delta);
+        }
+        for (uint32_t dependent : scenario.dependents) MarkDirty(dependent);
+        Metrics().completed.Add();
+        NAUVOO_LOG_INFO(ELogCategory::GAME, "[ScenarioManager] Scenario completed: ", scenario.name);
+    } else {
+        Metrics().failed.Add();
+        NAUVOO_LOG_INFO(ELogCategory::GAME, "[ScenarioManager] Scenario failed: ", scenario.name);
+    }
+    if (scenario.repeatable) MarkDirty(scenario_index);
+}
+
+void ScenarioManager::FireEvent(const FEventRef& ref) {
+    const FScenarioEventDef& event = scenarios[ref.scenario].events[ref.event];
+    FScenarioProgress& progress = world.scenarios[ref.scenario];
+    if (event.one_time && (progress.events_fired >> ref.event) & 1) return;
+
+    progress.events_fired |= 1u << ref.event;
+    if (event.fired_event != INVALID_WORLD_EVENT) world.world_events.Trigger(event.fired_event);
+    Metrics().events_fired.Add();
+    NAUVOO_LOG_DEBUG(ELogCategory::GAME, "[ScenarioManager] Scenario event fired: ", event.id);
+}
+
+// ==================== Position Triggers ====================
+
+void ScenarioManager::WatchPositionEvents(uint32_t scenario_index) {
+    const FScenarioDef& scenario = scenarios[scenario_index];
+    const FScenarioProgress& progress = world.scenarios[scenario_index];
+    for (uint32_t e = 0; e < scenario.events.size(); ++e) {
+        const FScenarioEventDef& event = scenario.events[e];
+        if (event.trigger != EScenarioTrigger::LOCATION && event.trigger != EScenarioTrigger::PROXIMITY) continue;
+        if (event.one_time && (progress.events_fired >> e) & 1) continue;
+
+        FPositionWatch watch;
+        watch.ref = { scenario_index, e };
+        position_watches.push_back(watch);
+    }
+}
+
+void ScenarioManager::UnwatchScenario(uint32_t scenario_index) {
+    size_t kept = 0;
+    for (size_t i = 0; i < position_watches.size(); ++i) {
+        if (position_watches[i].ref.scenario != scenario_index) position_watches[kept++] = position_watches[i];
+    }
+    position_watches.resize(kept);
+}
+
+void ScenarioManager::UpdatePositionWatches() {
+    if (position_watches.empty()) return;
+
+    const FVector3& player = world.player.position;
+    bool player_moved = !player_position_known || !SamePosition(player, last_player_position);
+    last_player_position = player;
+    player_position_known = true;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < position_watches.size(); ++i) {
+        FPositionWatch watch = position_watches[i];
+        FVector3 previous_target = watch.target;
+        bool resolved = ResolveWatchTarget(watch);
+        bool moved = player_moved || !watch.checked || !SamePosition(watch.target, previous_target);
+
+        // Unchanged positions cannot change the answer
+        bool fired = false;
+        if (resolved && moved) {
+            const FScenarioEventDef& event = scenarios[watch.ref.scenario].events[watch.ref.event];
+            float radius = event.trigger == EScenarioTrigger::PROXIMITY ? PROXIMITY_RADIUS : LOCATION_RADIUS;
+            bool inside = player.Distance(watch.target) <= radius;
+            evaluations++;
+
+            // Fires on entering, so standing in place does not repeat it
+            if (inside && !watch.inside) {
+                FireEvent(watch.ref);
+                fired = event.one_time;
+            }
+            watch.inside = inside;
+            watch.checked = true;
+        }
+        if (!fired) position_watches[kept++] = watch;
+    }
+    position_watches.resize(kept);
+}
+
+bool ScenarioManager::ResolveWatchTarget(FPositionWatch& watch) {
+    const FScenarioEventDef& event = scenarios[watch.ref.scenario].events[watch.ref.event];
+
+    if (event.trigger == EScenarioTrigger::LOCATION) {
+        auto it = world.location_positions.find(event.trigger_symbol);
+        if (it == world.location_positions.end()) return false;
+        watch.target = it->second;
+        return true;
+    }
+
+    // NPCs only move within the list when it is rebuilt; re-find on a miss
+    std::vector<FNPC>& npcs = world.all_npcs;
+    if (watch.npc_index >= npcs.size() || npcs[watch.npc_index].id != event.trigger_key) {
+        watch.npc_index = SIZE_MAX;
+        for (size_t n = 0; n < npcs.size(); ++n) {
+            if (npcs[n].id == event.trigger_key) {
+                watch.npc_index = n;
+                break;
+            }
+        }
+        if (watch.npc_index == SIZE_MAX) return false;
+    }
+    watch.target = npcs[watch.npc_index].position;
+    return true;
+}
+
+// ==================== Objectives ====================
+
+bool ScenarioManager::CompleteObjective(const std::string& scenario_id, size_t objective_index) {
+    auto it = scenario_ids.find(SymbolTable::Get().Find(scenario_id));
+    if (it == scenario_ids.end()) return false;
+
+    const FScenarioDef& scenario = scenarios[it->second];
+    FScenarioProgress& progress = world.scenarios[it->second];
+    if (progress.status != EScenarioStatus::ACTIVE || objective_index >= scenario.objectives.size()) return false;
+
+    uint32_t bit = 1u << objective_index;
+    if (progress.objectives_done & bit) return false;
+    progress.objectives_done |= bit;
+    NAUVOO_LOG_DEBUG(ELogCategory::GAME, "[ScenarioManager] Objective complete: ", scenario.objectives[objective_index]);
+
+    if (progress.objectives_done == LowBits(scenario.objectives.size())) {
+        FinishScenario(it->second, EScenarioStatus::COMPLETED);
+    }
+    return true;
+}
+
+bool ScenarioManager::FailScenario(const std::string& scenario_id) {
+    auto it = scenario_ids.find(SymbolTable::Get().Find(scenario_id));
+    if (it == scenario_ids.end() || world.scenarios[it->second].status != EScenarioStatus::ACTIVE) return false;
+
+    FinishScenario(it->second, EScenarioStatus::FAILED);
+    return true;
+}
+
+EScenarioStatus ScenarioManager::GetStatus(const std::string& scenario_id) const {
+    const FScenarioProgress* progress = GetProgress(scenario_id);
+    return progress ? progress->status : EScenarioStatus::LOCKED;
+}
+
+const FScenarioProgress* ScenarioManager::GetProgress(const std::string& scenario_id) const {
+    auto it = scenario_ids.find(SymbolTable::Get().Find(scenario_id));
+    return it != scenario_ids.end() ? &world.scenarios[it->second] : nullptr;
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "../Engine/CoreTypes.h"
+#include "../Engine/FlatMap.h"
+#include "../Engine/TimerWheel.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Nauvoo {
+
+class ReputationManager;
+struct FJsonValue;
+
+// What makes a scenario event fire once its scenario is active
+enum class EScenarioTrigger : uint8_t {
+    START,          // no trigger of its own: fires as the scenario starts
+    EVENT,          // a world event is active
+    LOCATION,       // the player enters the scenario's location
+    PROXIMITY,      // the player comes within reach of an NPC
+    DIALOGUE        // its dialogue tree is opened
+};
+
+struct FScenarioEventDef {
+    std::string id;
+    EScenarioTrigger trigger = EScenarioTrigger::START;
+    std::string trigger_key;                            // world event, location, NPC or dialogue tree id
+    FSymbol trigger_symbol;                             // trigger_key for non-EVENT triggers
+    FWorldEventId trigger_event = INVALID_WORLD_EVENT;  // EVENT triggers
+    FWorldEventId fired_event = INVALID_WORLD_EVENT;    // world event named after this one, triggered as it fires
+    bool one_time = false;
+};
+
+struct FScenarioDef {
+    std::string id;
+    FSymbol symbol;
+    std::string name;
+    FWorldEventId trigger_event = INVALID_WORLD_EVENT;  // world event that unlocks it; none = unlocked
+    int prerequisite = -1;                              // scenario index that must have completed once
+    int64_t start_minute = -1;                          // GetCalendarMinutes of start date/time; -1 = any time
+    std::string location_id;
+    std::vector<std::string> objectives;
+    std::vector<FScenarioEventDef> events;
+    int legion_delta = 0;
+    int community_delta = 0;
+    int outsider_delta = 0;
+    bool repeatable = false;
+    std::vector<uint32_t> dependents;                   // scenarios naming this one as prerequisite
+};
+
+/**
+ * Runs the scenarios in phase_1_scenarios.json. Every trigger is indexed by
+ * the input it waits on (world event, dialogue tree, start time, position),
+ * and a change to an input marks only the scenarios and events indexed under
+ * it; Update then evaluates just those. Start times are game timers, and
+ * position triggers are only watched while their scenario is active.
+ *
+ * Progress is kept in FWorldState::scenarios so it saves with the world.
+ */
+class ScenarioManager {
+public:
+    static constexpr size_t MAX_OBJECTIVES = 32;       // objectives and events are bit masks in FScenarioProgress
+    static constexpr size_t MAX_EVENTS = 32;
+    static constexpr float PROXIMITY_RADIUS = 5.0f;
+    static constexpr float LOCATION_RADIUS = 20.0f;
+
+    // Timers are optional; without them start times are only noticed when another input changes
+    ScenarioManager(FWorldState& world, ReputationManager* reputation_mgr, TimerWheel* game_timers);
+    ~ScenarioManager();
+
+    // Definitions; replace any loaded before and clear progress. Nothing runs until
+    // ResetProgress or RestoreProgress, called once the clock is set
+    bool LoadScenarios(const std::string& scenario_data_file);
+    bool LoadScenarios(const FJsonValue& root);
+    size_t GetScenarioCount() const { return scenarios.size(); }
+    const FScenarioDef* FindScenario(const std::string& scenario_id) const;
+
+    // New game: every scenario locked, start timers armed
+    void ResetProgress();
+    // After a load: matches saved progress to the definitions by id and rebuilds timers and watches
+    void RestoreProgress();
+
+    // Inputs; each marks only what is indexed under it
+    void OnWorldEventChanged(FWorldEventId event_id, EWorldEventChange change);
+    void OnDialogueStarted(FSymbol tree_id);
+
+    // Evaluates the marked scenarios and events, then the position watches if anything moved
+    void Update();
+
+    // Completing the last objective completes the scenario
+    bool CompleteObjective(const std::string& scenario_id, size_t objective_index);
+    bool FailScenario(const std::string& scenario_id);
+    EScenarioStatus GetStatus(const std::string& scenario_id) const;
+    const FScenarioProgress* GetProgress(const std::string& scenario_id) const;
+
+    // Scenario and event condition checks performed so far
+    uint64_t GetEvaluationCount() const { return evaluations; }
+
+private:
+    struct FEventRef {
+        uint32_t scenario = 0;
+        uint32_t event = 0;
+    };
+
+    // An active LOCATION or PROXIMITY event; fires as the player enters its radius
+    struct FPositionWatch {
+        FEventRef ref;
+        FVector3 target;
+        size_t npc_index = SIZE_MAX;    // PROXIMITY: cached slot in all_npcs
+        bool inside = false;
+        bool checked = false;
+    };
+
+    FWorldState& world;
+    ReputationManager* reputation_manager = nullptr;
+    TimerWheel* game_timers = nullptr;
+
+    std::vector<FScenarioDef> scenarios;
+    TFlatHashMap<FSymbol, uint32_t> scenario_ids;
+
+    // Trigger indexes
+    TFlatHashMap<FWorldEventId, std::vector<uint32_t>> scenarios_by_event;
+    TFlatHashMap<FWorldEventId, std::vector<FEventRef>> events_by_world_event;
+    TFlatHashMap<FSymbol, std::vector<FEventRef>> events_by_dialogue;
+    std::vector<FTimerHandle> start_timers;
+    std::vector<FPositionWatch> position_watches;
+
+    // Marked since the last Update
+    std::vector<uint32_t> dirty_scenarios;
+    std::vector<uint8_t> is_dirty;
+    std::vector<FEventRef> pending_events;
+    FVector3 last_player_position;
+    bool player_position_known = false;
+
+    uint64_t evaluations = 0;
+
+    void BuildIndexes();
+    void ClearProgress();
+    void RebuildRuntimeState();
+    void ArmStartTimers();
+    void MarkDirty(uint32_t scenario_index);
+
+    bool CanStart(uint32_t scenario_index) const;
+    bool IsEventTriggered(const FEventRef& ref) const;
+    void StartScenario(uint32_t scenario_index);
+    void FinishScenario(uint32_t scenario_index, EScenarioStatus status);
+    void FireEvent(const FEventRef& ref);
+    void WatchPositionEvents(uint32_t scenario_index);
+    void UnwatchScenario(uint32_t scenario_index);
+    void UpdatePositionWatches();
+    bool ResolveWatchTarget(FPositionWatch& watch);
+};
+
+}  // namespace Nauvoo
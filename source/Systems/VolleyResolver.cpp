@@ -0,0 +1,166 @@
+#include "../Systems/VolleyResolver.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Nauvoo {
+
+namespace {
+
+// A standing man, in metres from his feet
+constexpr float BODY_HEIGHT = 1.8f;
+constexpr float NECK_HEIGHT = 1.5f;
+constexpr float WAIST_HEIGHT = 0.9f;
+constexpr float AIM_HEIGHT = 1.2f;              // shooters aim for centre mass
+constexpr float TORSO_HALF_WIDTH = 0.2f;        // arms hang outside this
+constexpr float BODY_HALF_WIDTH = 0.45f;
+
+// Balls scatter around the aim point, wider as range grows
+constexpr float BASE_SPREAD = 0.25f;
+constexpr float SPREAD_PER_RANGE = 0.35f;       // added per effective range of distance
+constexpr float MAX_RANGE_MULTIPLE = 4.0f;      // no hits beyond this many effective ranges
+constexpr float MIN_DAMAGE_SCALE = 0.5f;        // spent balls still bruise
+
+// Damage multipliers by where the ball strikes, the torso being 1
+constexpr float HEAD_DAMAGE = 2.0f;
+constexpr float ARM_DAMAGE = 0.6f;
+constexpr float LEG_DAMAGE = 0.75f;
+
+// The helpers below select between values computed on both sides rather
+// than branching, so the resolve loop stays vectorizable
+
+inline float Clamp(float value, float low, float high) {
+    value = value < low ? low : value;
+    return value > high ? high : value;
+}
+
+// Triangular distribution on (-1, 1) from a uniform roll
+inline float Triangular(float roll) {
+    float low = std::sqrt(2.0f * roll) - 1.0f;
+    float high = 1.0f - std::sqrt(2.0f - 2.0f * roll);
+    return roll < 0.5f ? low : high;
+}
+
+// Body part index (EBodyPart order) and damage multiplier at an impact point on the silhouette
+inline int BodyPartAt(float lateral, float height, float& damage_scale) {
+    int right = lateral >= 0.0f ? 1 : 0;
+    int head = height >= NECK_HEIGHT ? 1 : 0;
+    int leg = height < WAIST_HEIGHT ? 1 : 0;
+    int arm = (1 - head - leg) * (std::fabs(lateral) >= TORSO_HALF_WIDTH ? 1 : 0);
+    int torso = 1 - head - leg - arm;
+    damage_scale = head * HEAD_DAMAGE + torso * 1.0f + arm * ARM_DAMAGE + leg * LEG_DAMAGE;
+    return torso * static_cast<int>(EBodyPart::TORSO)
+         + arm * (static_cast<int>(EBodyPart::LEFT_ARM) + right)
+         + leg * (static_cast<int>(EBodyPart::LEFT_LEG) + right);
+}
+
+// Every array is distinct, which the compiler can only be told through
+// restrict-qualified parameters; without it the loop is not vectorized
+void ResolveShotRange(const float* __restrict shooter_x, const float* __restrict shooter_y, const float* __restrict shooter_z,
+                      const float* __restrict target_x, const float* __restrict target_y, const float* __restrict target_z,
+                      const float* __restrict accuracy, const float* __restrict range, const float* __restrict damage,
+                      const float* __restrict hit_roll, const float* __restrict lateral_roll, const float* __restrict height_roll,
+                      uint8_t* __restrict hit, EBodyPart* __restrict body_part, float* __restrict hit_damage,
+                      size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        float dx = target_x[i] - shooter_x[i];
+        float dy = target_y[i] - shooter_y[i];
+        float dz = target_z[i] - shooter_z[i];
+        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        // Chance falls off with the square of distance over the weapon's effective range
+        float relative = distance / range[i];
+        float falloff = 1.0f / (1.0f + relative * relative);
+        falloff = relative < MAX_RANGE_MULTIPLE ? falloff : 0.0f;
+        hit[i] = hit_roll[i] < accuracy[i] * falloff ? 1 : 0;
+
+        // Where the ball lands, clamped onto the silhouette since the hit roll already decided it struck
+        float spread = BASE_SPREAD + SPREAD_PER_RANGE * relative;
+        float lateral = Clamp(Triangular(lateral_roll[i]) * spread, -BODY_HALF_WIDTH, BODY_HALF_WIDTH);
+        float height = Clamp(AIM_HEIGHT + Triangular(height_roll[i]) * spread, 0.0f, BODY_HEIGHT);
+        float part_scale;
+        body_part[i] = static_cast<EBodyPart>(BodyPartAt(lateral, height, part_scale));
+
+        float range_scale = Clamp(2.0f - relative, MIN_DAMAGE_SCALE, 1.0f);
+        hit_damage[i] = damage[i] * range_scale * part_scale;
+    }
+}
+
+}  // namespace
+
+void FVolley::AddShot(FSymbol shooter, const FVector3& shooter_position, EStance stance,
+                      uint32_t target, const FVector3& target_position, float shooter_aim) {
+    shooters.push_back(shooter);
+    shooter_x.push_back(shooter_position.x);
+    shooter_y.push_back(shooter_position.y);
+    shooter_z.push_back(shooter_position.z);
+    stances.push_back(stance);
+    aim.push_back(shooter_aim);
+    targets.push_back(target);
+    target_x.push_back(target_position.x);
+    target_y.push_back(target_position.y);
+    target_z.push_back(target_position.z);
+}
+
+void FVolley::Reserve(size_t count) {
+    shooters.reserve(count);
+    shooter_x.reserve(count);
+    shooter_y.reserve(count);
+    shooter_z.reserve(count);
+    stances.reserve(count);
+    aim.reserve(count);
+    targets.reserve(count);
+    target_x.reserve(count);
+    target_y.reserve(count);
+    target_z.reserve(count);
+}
+
+void FVolley::Clear() {
+    shooters.clear();
+    shooter_x.clear();
+    shooter_y.clear();
+    shooter_z.clear();
+    stances.clear();
+    aim.clear();
+    targets.clear();
+    target_x.clear();
+    target_y.clear();
+    target_z.clear();
+}
+
+void FShotBatch::Resize(size_t count) {
+    accuracy.resize(count);
+    range.resize(count);
+    damage.resize(count);
+    hit_roll.resize(count);
+    lateral_roll.resize(count);
+    height_roll.resize(count);
+    hit.resize(count);
+    body_part.resize(count);
+    hit_damage.resize(count);
+}
+
+float GetStanceAccuracy(EStance stance) {
+    switch (stance) {
+        case EStance::STANDING: return 0.7f;
+        case EStance::CROUCHING: return 0.85f;
+        case EStance::PRONE: return 0.95f;
+        case EStance::MOVING: return 0.4f;
+        case EStance::BEHIND_COVER: return 0.9f;   // braced on the cover
+    }
+    return 1.0f;
+}
+
+EBodyPart DetermineBodyPart(float lateral, float height) {
+    float damage_scale;
+    return static_cast<EBodyPart>(BodyPartAt(lateral, height, damage_scale));
+}
+
+void ResolveShots(const FVolley& volley, FShotBatch& batch, size_t begin, size_t end) {
+    ResolveShotRange(volley.shooter_x.data(), volley.shooter_y.data(), volley.shooter_z.data(),
+                     volley.target_x.data(), volley.target_y.data(), volley.target_z.data(),
+                     batch.accuracy.data(), batch.range.data(), batch.damage.data(),
+                     batch.hit_roll.data(), batch.lateral_roll.data(), batch.height_roll.data(),
+                     batch.hit.data(), batch.body_part.data(), batch.hit_damage.data(), begin, end);
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../Engine/CoreTypes.h"
+#include <cstdint>
+#include <vector>
+
+namespace Nauvoo {
+
+// Volley target index meaning the player rather than an NPC
+constexpr uint32_t VOLLEY_TARGET_PLAYER = 0xFFFFFFFF;
+
+/**
+ * The shots of one volley, one array per field so the resolver streams
+ * through them. Positions are copied in when the shot is added; targets
+ * index the NPC list handed to CombatSystem::FireVolley.
+ */
+struct FVolley {
+    std::vector<FSymbol> shooters;
+    std::vector<float> shooter_x, shooter_y, shooter_z;
+    std::vector<EStance> stances;
+    std::vector<float> aim;                 // shooter's own accuracy multiplier (fatigue, panic)
+    std::vector<uint32_t> targets;
+    std::vector<float> target_x, target_y, target_z;
+
+    void AddShot(FSymbol shooter, const FVector3& shooter_position, EStance stance,
+                 uint32_t target, const FVector3& target_position, float shooter_aim = 1.0f);
+    void Reserve(size_t count);
+    void Clear();
+    size_t GetCount() const { return shooters.size(); }
+};
+
+/**
+ * Per-shot weapon stats and random rolls gathered before resolving, and the
+ * resolved hits. A shot that did not fire has zero accuracy and never hits.
+ */
+struct FShotBatch {
+    std::vector<float> accuracy;            // weapon accuracy x stance x aim
+    std::vector<float> range;               // effective range, at least 1
+    std::vector<float> damage;
+    std::vector<float> hit_roll;            // uniform [0, 1) rolls, drawn in shot order
+    std::vector<float> lateral_roll;
+    std::vector<float> height_roll;
+
+    std::vector<uint8_t> hit;
+    std::vector<EBodyPart> body_part;
+    std::vector<float> hit_damage;
+
+    void Resize(size_t count);
+};
+
+// Accuracy multiplier of a shooter's stance
+float GetStanceAccuracy(EStance stance);
+
+/**
+ * Body part at an impact point relative to the target's feet: x across the
+ * body (positive to the target's right), z up. Points off the silhouette
+ * count as the nearest part.
+ */
+EBodyPart DetermineBodyPart(float lateral, float height);
+
+/**
+ * Range falloff, hit test, impact point and damage for shots [begin, end).
+ * Straight-line arithmetic over the arrays with no lookups or branches, so
+ * the compiler can vectorize it; everything random was drawn beforehand.
+ */
+void ResolveShots(const FVolley& volley, FShotBatch& batch, size_t begin, size_t end);
+
+}  // namespace Nauvoo
@@ -0,0 +1,121 @@
+#include "../Systems/WeaponRegistry.h"
+#include "../Engine/JsonReader.h"
+#include "../Engine/Log.h"
+#include <algorithm>
+
+namespace Nauvoo {
+
+namespace {
+
+bool ParseWeaponType(const std::string& text, EWeaponType& type) {
+    static const std::pair<const char*, EWeaponType> TYPES[] = {
+        { "musket", EWeaponType::MUSKET }, { "pistol", EWeaponType::PISTOL }, { "club", EWeaponType::CLUB },
+        { "saber", EWeaponType::SABER },   { "knife", EWeaponType::KNIFE },   { "bayonet", EWeaponType::BAYONET },
+        { "fist", EWeaponType::FIST }
+    };
+    for (const auto& entry : TYPES) {
+        if (text == entry.first) {
+            type = entry.second;
+            return true;
+        }
+    }
+    return false;
+}
+
+// The musket FireWeapon used before weapons were data
+FWeaponArchetype MakeBuiltInMusket() {
+    FWeaponArchetype musket;
+    musket.id = WeaponRegistry::BUILT_IN_WEAPON_ID;
+    musket.name = "Musket";
+    musket.type = EWeaponType::MUSKET;
+    musket.reload_time = 15.0f;
+    musket.accuracy = 0.7f;
+    musket.damage = 40.0f;
+    musket.stamina_cost = 15.0f;
+    musket.max_ammo = 1;
+    return musket;
+}
+
+}  // namespace
+
+WeaponRegistry::WeaponRegistry() {
+    archetypes.push_back(MakeBuiltInMusket());
+    archetype_ids[SymbolTable::Get().Intern(archetypes[0].id)] = 0;
+}
+
+bool WeaponRegistry::LoadWeapons(const std::string& weapon_data_file) {
+    FJsonValue root;
+    std::string error;
+    if (!JsonReader::ParseFile(weapon_data_file, root, &error)) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[WeaponRegistry] Could not load ", weapon_data_file, ": ", error);
+        return false;
+    }
+    if (!LoadWeapons(root)) return false;
+
+    NAUVOO_LOG_INFO(ELogCategory::COMBAT, "[WeaponRegistry] ", archetypes.size(), " weapons loaded from ", weapon_data_file);
+    return true;
+}
+
+bool WeaponRegistry::LoadWeapons(const FJsonValue& root) {
+    const FJsonValue& list = root["weapons"];
+    if (!list.IsArray()) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[WeaponRegistry] Missing weapons array");
+        return false;
+    }
+
+    std::vector<FWeaponArchetype> loaded;
+    TFlatHashMap<FSymbol, FWeaponArchetypeId> loaded_ids;
+    SymbolTable& symbols = SymbolTable::Get();
+
+    for (size_t i = 0; i < list.GetSize(); ++i) {
+        const FJsonValue& entry = list[i];
+        FWeaponArchetype weapon;
+        weapon.id = entry.GetString("id");
+        FSymbol symbol = weapon.id.empty() ? FSymbol() : symbols.Intern(weapon.id);
+        if (!symbol.IsValid() || loaded_ids.count(symbol) || !ParseWeaponType(entry.GetString("type"), weapon.type)) {
+            NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[WeaponRegistry] Skipping weapon with missing or duplicate id or unknown type: ", weapon.id);
+            continue;
+        }
+        if (loaded.size() >= INVALID_WEAPON_ARCHETYPE) break;
+
+        // Missing stats keep the FWeaponArchetype defaults; melee weapons leave out the firearm ones
+        weapon.name = entry.GetString("name", weapon.id);
+        weapon.fire_rate = std::max(0.0f, static_cast<float>(entry.GetNumber("fire_rate", weapon.fire_rate)));
+        weapon.reload_time = std::max(0.0f, static_cast<float>(entry.GetNumber("reload_time", weapon.reload_time)));
+        weapon.accuracy = std::clamp(static_cast<float>(entry.GetNumber("accuracy", weapon.accuracy)), 0.0f, 1.0f);
+        weapon.damage = static_cast<float>(entry.GetNumber("damage", weapon.damage));
+        weapon.range = static_cast<float>(entry.GetNumber("range", weapon.range));
+        weapon.stamina_cost = static_cast<float>(entry.GetNumber("stamina_cost", weapon.stamina_cost));
+        weapon.max_ammo = std::clamp(static_cast<int>(entry.GetNumber("max_ammo", weapon.max_ammo)), 0, 0xFFFF);
+        weapon.misfire_chance = std::clamp(static_cast<float>(entry.GetNumber("misfire_chance", 0.0)), 0.0f, 1.0f);
+        weapon.fouling_per_shot = std::clamp(static_cast<float>(entry.GetNumber("fouling_per_shot", 0.0)), 0.0f, 1.0f);
+
+        loaded_ids.emplace(symbol, static_cast<FWeaponArchetypeId>(loaded.size()));
+        loaded.push_back(std::move(weapon));
+    }
+    if (loaded.empty()) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[WeaponRegistry] No usable weapons; keeping the current ones");
+        return false;
+    }
+
+    FWeaponArchetypeId default_id = 0;
+    std::string default_name = root.GetString("default_weapon");
+    auto default_it = loaded_ids.find(symbols.Find(default_name));
+    if (default_it != loaded_ids.end()) {
+        default_id = default_it->second;
+    } else if (!default_name.empty()) {
+        NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[WeaponRegistry] Unknown default weapon ", default_name, "; using ", loaded[0].id);
+    }
+
+    archetypes = std::move(loaded);
+    archetype_ids = std::move(loaded_ids);
+    default_archetype = default_id;
+    return true;
+}
+
+FWeaponArchetypeId WeaponRegistry::Find(FSymbol weapon_id) const {
+    auto it = archetype_ids.find(weapon_id);
+    return it != archetype_ids.end() ? it->second : INVALID_WEAPON_ARCHETYPE;
+}
+
+}  // namespace Nauvoo
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "../Engine/CoreTypes.h"
+#include "../Engine/FlatMap.h"
+#include <string>
+#include <vector>
+
+namespace Nauvoo {
+
+struct FJsonValue;
+
+/**
+ * Weapon archetypes from weapons.json, shared by every character carrying
+ * one. Archetypes do not change once loaded; what changes per character
+ * (ammo, reload, fouling, cooldown) is an FWeaponState kept by CombatSystem.
+ * Holds a built-in musket until a file is loaded, so combat still works
+ * without the data.
+ */
+class WeaponRegistry {
+public:
+    static constexpr const char* BUILT_IN_WEAPON_ID = "weapon_musket";
+
+    WeaponRegistry();
+
+    // Replaces every archetype; on failure the current ones are kept
+    bool LoadWeapons(const std::string& weapon_data_file);
+    bool LoadWeapons(const FJsonValue& root);
+
+    // INVALID_WEAPON_ARCHETYPE when unknown
+    FWeaponArchetypeId Find(FSymbol weapon_id) const;
+    FWeaponArchetypeId Find(const std::string& weapon_id) const { return Find(SymbolTable::Get().Find(weapon_id)); }
+    const FWeaponArchetype& Get(FWeaponArchetypeId archetype) const { return archetypes[archetype]; }
+    size_t GetCount() const { return archetypes.size(); }
+
+    // Carried by characters that name no weapon
+    FWeaponArchetypeId GetDefault() const { return default_archetype; }
+
+private:
+    std::vector<FWeaponArchetype> archetypes;
+    TFlatHashMap<FSymbol, FWeaponArchetypeId> archetype_ids;
+    FWeaponArchetypeId default_archetype = 0;
+};
+
+}  // namespace Nauvoo
@@ -5,8 +5,36 @@
 #include "Systems/ReputationManager.h"
 #include "Systems/DialogueManager.h"
 #include "Systems/CombatSystem.h"
+#include "Systems/SaveGameManager.h"
+#include "Systems/SaveCodec.h"
+#include "Systems/NPCScheduleManager.h"
+#include "Systems/ScenarioManager.h"
+#include "Systems/WeaponRegistry.h"
+#include "Systems/CrowdMorale.h"
+#include "Engine/Random.h"
+#include "Engine/ReplaySystem.h"
+#include "Engine/SimulationLOD.h"
+#include "Engine/SyntheticContent.h"
+#include "Engine/SystemScheduler.h"
+#include "Engine/EventBus.h"
+#include "Engine/GameEvents.h"
+#include "Engine/JsonReader.h"
+#include "Engine/TimerWheel.h"
+#include "Engine/Profiler.h"
+#include "Engine/Symbol.h"
+#include "Engine/Memory.h"
+#include "Engine/FlatMap.h"
+#include "Engine/JobSystem.h"
+#include "Engine/Log.h"
+#include "Engine/Metrics.h"
 #include <iostream>
+#include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <thread>
 
 namespace Nauvoo {
 
@@ -28,6 +56,29 @@ public:
         TestDialogueSystem();
         TestCombatSystem();
         TestGameInitialization();
+        TestSaveSystem();
+        TestRandomService();
+        TestReplaySystem();
+        TestHeadlessMode();
+        TestProfiler();
+        TestLogging();
+        TestMetrics();
+        TestJobSystem();
+        TestSystemScheduler();
+        TestSimulationLOD();
+        TestBleedEvents();
+        TestTimerWheel();
+        TestEventBus();
+        TestWorldEventRegistry();
+        TestScenarioRuntime();
+        TestSymbols();
+        TestMemory();
+        TestFlatMap();
+        TestWeapons();
+        TestVolley();
+        TestEncounters();
+        TestCombatAI();
+        TestCrowdMorale();
 
         PrintResults();
     }
@@ -207,6 +258,1456 @@ private:
         std::cout << std::endl;
     }
 
+    void TestSaveSystem() {
+        std::cout << "[TEST SUITE] Save System\n";
+        
+        // Codec round trips
+        std::string repetitive;
+        for (int i = 0; i < 200; i++) {
+            repetitive += "npc_settler_" + std::to_string(i % 7) + ";loc_town_square;";
+        }
+        std::string noisy;
+        uint32_t state = 12345;
+        for (int i = 0; i < 4096; i++) {
+            state = state * 1664525u + 1013904223u;
+            noisy.push_back(static_cast<char>(state >> 24));
+        }
+        
+        const ISaveCodec* lz = GetSaveCodec(ESaveCodec::LZ);
+        std::string encoded, decoded;
+        lz->Encode(repetitive, encoded);
+        Assert(encoded.size() < repetitive.size() / 4, "LZ codec compresses repetitive ids");
+        Assert(lz->Decode(encoded, repetitive.size(), decoded) && decoded == repetitive,
+               "LZ codec round-trips repetitive data");
+        lz->Encode(noisy, encoded);
+        Assert(lz->Decode(encoded, noisy.size(), decoded) && decoded == noisy,
+               "LZ codec round-trips incompressible data");
+        Assert(!lz->Decode(encoded.substr(0, encoded.size() / 2), noisy.size(), decoded),
+               "LZ codec rejects truncated input");
+        Assert(!lz->Decode(encoded, 0xFFFFFFFFu, decoded) && decoded.capacity() < (1u << 20),
+               "LZ codec rejects a raw size the input cannot expand to");
+        
+        FSaveFileHeader future;
+        future.format_version = FSaveFileHeader::FORMAT_VERSION + 1;
+        std::string header_bytes;
+        future.Write(header_bytes);
+        FSaveFileHeader read_back;
+        Assert(read_back.Read(header_bytes) == ESaveHeaderStatus::UNSUPPORTED_VERSION
+               && read_back.Read("plain text save") == ESaveHeaderStatus::MISSING,
+               "Newer save formats are told apart from headerless saves");
+        
+        // Full save/load round trip
+        GameManager gm;
+        gm.Initialize();
+        
+        FNPC npc;
+        npc.id = "test_wounded";
+        npc.name = "Test Wounded";
+        npc.health = 62.5f;
+        npc.position = { 12.25f, 0.0f, -4.5f };
+        FInjury injury;
+        injury.type = EInjuryType::LACERATION;
+        injury.location = EBodyPart::LEFT_LEG;
+        injury.severity = 3;
+        injury.SetBleedRate(1.5f);
+        npc.injuries.push_back(injury);
+        gm.SpawnNPC(npc);
+        gm.AdvanceGameTime(90);
+        gm.TriggerEvent("event_test_save");
+        FNPC* frightened = gm.GetNPCById("test_wounded");
+        uint64_t calm_hash = gm.ComputeStateHash();
+        frightened->fear = 0.75f;
+        frightened->anger = 0.25f;
+        frightened->is_panicking = true;
+        Assert(gm.ComputeStateHash() != calm_hash, "Morale is part of the state hash");
+        gm.SaveGame("test_roundtrip");
+        
+        GameManager loaded;
+        loaded.Initialize();
+        FNPC stray;
+        stray.id = "test_not_in_save";
+        loaded.SpawnNPC(stray);
+        loaded.LoadGame("test_roundtrip");
+        Assert(!loaded.GetNPCById("test_not_in_save") && loaded.GetAllNPCs().size() == gm.GetAllNPCs().size(),
+               "Loading replaces the NPC list");
+        
+        FNPC* restored = loaded.GetNPCById("test_wounded");
+        Assert(restored != nullptr, "Saved NPC restored on load");
+        Assert(restored && restored->health == 62.5f, "NPC health restored");
+        Assert(restored && restored->position.x == 12.25f, "NPC position restored");
+        Assert(restored && restored->injuries.size() == 1
+               && restored->injuries[0].location == EBodyPart::LEFT_LEG,
+               "NPC injuries restored");
+        Assert(restored && restored->fear == 0.75f && restored->anger == 0.25f && restored->is_panicking,
+               "NPC morale restored");
+        Assert(loaded.GetCurrentTime().minute == gm.GetCurrentTime().minute, "Game time restored");
+        Assert(loaded.IsEventActive("event_test_save"), "Active events restored");
+        
+        SaveGameManager save_manager;
+        save_manager.DeleteSave("test_roundtrip");
+        
+        // A save from a newer build is refused rather than read as plain text
+        {
+            std::ofstream file("./saves/test_future.nauvoo", std::ios::binary);
+            file << header_bytes << "payload";
+        }
+        FWorldState untouched;
+        Assert(!save_manager.LoadGame("test_future", untouched), "Newer save formats are rejected");
+        save_manager.DeleteSave("test_future");
+
+        // Enum values past their last member are refused rather than cast
+        FWorldState corrupt;
+        FNPC stranger;
+        stranger.id = "test_out_of_range";
+        stranger.faction = static_cast<EFaction>(9);
+        corrupt.all_npcs.push_back(stranger);
+        save_manager.SaveGame(corrupt, "test_out_of_range");
+        Assert(!save_manager.LoadGame("test_out_of_range", untouched) && untouched.all_npcs.empty(),
+               "Out-of-range enum values are rejected");
+        save_manager.DeleteSave("test_out_of_range");
+        
+        std::cout << std::endl;
+    }
+
+    void TestRandomService() {
+        std::cout << "[TEST SUITE] Random Service\n";
+        
+        RandomService rng_a(42);
+        RandomService rng_b(42);
+        bool same_sequence = true;
+        for (int i = 0; i < 100; i++) {
+            same_sequence &= rng_a.GetStream(ERandomStream::COMBAT).NextU64()
+                          == rng_b.GetStream(ERandomStream::COMBAT).NextU64();
+        }
+        Assert(same_sequence, "Same seed produces same combat stream");
+        Assert(rng_a.GetStream(ERandomStream::AI).NextU64() != rng_a.GetStream(ERandomStream::COMBAT).NextU64(),
+               "System streams are independent");
+        
+        std::vector<float> uniforms;
+        rng_a.GetStream(ERandomStream::AI).FillUniform(uniforms, 1001);
+        bool in_range = uniforms.size() == 1001;
+        float sum = 0.0f;
+        for (float u : uniforms) {
+            in_range &= (u >= 0.0f && u < 1.0f);
+            sum += u;
+        }
+        Assert(in_range, "Batch uniforms lie in [0, 1)");
+        Assert(std::fabs(sum / 1001.0f - 0.5f) < 0.05f, "Batch uniforms are centred on 0.5");
+        
+        uint64_t npc_key = RandomService::HashKey("npc_thomas_brown");
+        Assert(rng_a.DeriveStream(ERandomStream::AI, npc_key, 7).NextU64()
+               == rng_b.DeriveStream(ERandomStream::AI, npc_key, 7).NextU64(),
+               "Per-NPC derived streams are reproducible");
+        Assert(rng_a.DeriveStream(ERandomStream::AI, npc_key, 7).NextU64()
+               != rng_a.DeriveStream(ERandomStream::AI, npc_key, 8).NextU64(),
+               "Per-NPC derived streams differ per counter");
+        
+        // Combat outcomes replay bit-for-bit from seed and inputs
+        auto run_combat = [](uint64_t seed) {
+            GameManager gm;
+            gm.Initialize();
+            gm.SetWorldSeed(seed);
+            FNPC enemy;
+            enemy.id = "test_enemy";
+            enemy.name = "Test Enemy";
+            enemy.health = enemy.max_health = 10000.0f;
+            gm.SpawnNPC(enemy);
+            gm.InitiateCombat("test_enemy");
+            std::vector<float> health_trace;
+            for (int i = 0; i < 12; i++) {
+                gm.GetPlayerState().stamina = 100.0f;
+                gm.GetCombatSystem()->FireWeapon(gm.GetPlayerState(), { 0, 0, 0 }, gm.GetAllNPCs(), "test_enemy");
+                health_trace.push_back(gm.GetCombatSystem()->GetNPCHealth(*gm.GetNPCById("test_enemy")));
+                gm.GetCombatSystem()->AdvanceTime(20.0f);   // past any reload
+            }
+            return health_trace;
+        };
+        Assert(run_combat(1234) == run_combat(1234), "Combat reproducible from world seed");
+        Assert(run_combat(1234) != run_combat(98765), "Different seeds change combat outcomes");
+        
+        std::cout << std::endl;
+    }
+
+    void TestReplaySystem() {
+        std::cout << "[TEST SUITE] Replay System\n";
+        
+        auto setup = [](GameManager& gm, float enemy_health) {
+            gm.Initialize();
+            gm.SetWorldSeed(777);
+            FNPC enemy;
+            enemy.id = "test_raider";
+            enemy.name = "Test Raider";
+            enemy.health = enemy_health;
+            gm.SpawnNPC(enemy);
+        };
+        
+        GameManager recorded;
+        setup(recorded, 100.0f);
+        recorded.BeginRecording(25);
+        Assert(recorded.IsRecording(), "Recording started");
+        
+        for (int i = 0; i < 40; i++) recorded.Update(0.016f);
+        recorded.RecordPlayerAction("attend_drill");
+        recorded.InitiateCombat("test_raider");
+        for (int i = 0; i < 3; i++) {
+            recorded.FireWeapon({ 5, 0, 0 }, "test_raider");
+            for (int j = 0; j < 20; j++) recorded.Update(0.016f);
+        }
+        recorded.AdvanceGameTime(45);
+        for (int i = 0; i < 30; i++) recorded.Update(0.033f);
+        recorded.EndCombat();
+        for (int i = 0; i < 10; i++) recorded.Update(0.033f);
+        
+        uint64_t final_hash = recorded.ComputeStateHash();
+        Assert(recorded.FinishRecording("test_session.nrpl"), "Recording written to file");
+        
+        ReplayPlayer player;
+        Assert(player.LoadFromFile("test_session.nrpl"), "Replay stream loads");
+        Assert(player.GetHeader().total_ticks == 140, "Replay header records tick count");
+        
+        GameManager replayed;
+        setup(replayed, 100.0f);
+        FReplayResult result = player.Run(replayed);
+        Assert(!result.diverged, "Replay matches every checkpoint");
+        Assert(result.checkpoints_verified >= 5, "Replay verified periodic checkpoints");
+        Assert(result.ticks == 140, "Replay ran the recorded number of ticks");
+        Assert(replayed.ComputeStateHash() == final_hash, "Replay reaches identical final state");
+        
+        GameManager divergent;
+        setup(divergent, 55.0f);
+        Assert(player.Run(divergent).diverged, "Replay detects divergent starting state");
+        
+        std::remove("test_session.nrpl");
+        
+        std::cout << std::endl;
+    }
+
+    void TestHeadlessMode() {
+        std::cout << "[TEST SUITE] Headless Mode\n";
+        
+        FHeadlessOptions options;
+        options.days = 2;
+        options.extra_npcs = 50;
+        
+        NauvooGame game;
+        FHeadlessReport report = game.RunHeadless(options);
+        Assert(report.ticks == 2880, "Two days at one minute per tick");
+        Assert(std::fabs(report.simulated_days - 2.0) < 0.01, "Game clock advanced two days");
+        Assert(report.npc_count == 55, "Synthetic population spawned");
+        Assert(report.ticks_per_second > 0.0, "Throughput reported");
+        Assert(report.timings.ticks == report.ticks, "Per-system timings collected every tick");
+        
+        FNPC* settler = game.GetGameManager()->GetNPCById("npc_synthetic_7");
+        Assert(settler && settler->current_activity != nullptr, "Synthetic NPCs follow schedules");
+        
+        std::cout << std::endl;
+    }
+
+    void TestProfiler() {
+        std::cout << "[TEST SUITE] Profiler\n";
+        
+        Profiler& profiler = Profiler::Get();
+        profiler.EndFrame();
+        profiler.ResetStats();
+        profiler.BeginTraceCapture();
+        
+        // Zones are used directly so the test also covers builds with the macros compiled out
+        for (int frame = 0; frame < 20; ++frame) {
+            ProfileZone outer("Test::Frame");
+            ProfileZone inner("Test::Inner");
+        }
+        std::thread worker([] { ProfileZone zone("Test::Worker"); });
+        worker.join();
+        profiler.EndFrame();
+        profiler.EndTraceCapture();
+        
+        FZoneStats stats;
+        Assert(profiler.GetZoneStats("Test::Frame", stats) && stats.count == 20, "Zone samples collected");
+        Assert(stats.p50_us <= stats.p99_us && stats.p99_us <= stats.max_us, "Percentiles ordered");
+        Assert(profiler.GetZoneStats("Test::Worker", stats) && stats.count == 1, "Worker thread zones drained");
+        Assert(profiler.GetCapturedEventCount() >= 41, "Trace captured events");
+        
+        Assert(profiler.WriteChromeTrace("test_trace.json"), "Chrome trace written");
+        std::ifstream trace("test_trace.json");
+        std::string contents((std::istreambuf_iterator<char>(trace)), std::istreambuf_iterator<char>());
+        Assert(contents.rfind("{\"traceEvents\":[", 0) == 0 && contents.find("\"ph\":\"X\"") != std::string::npos,
+               "Trace uses Chrome trace-event format");
+        trace.close();
+        std::remove("test_trace.json");
+        
+        std::cout << std::endl;
+    }
+
+    void TestLogging() {
+        std::cout << "[TEST SUITE] Logging\n";
+        
+        // Arguments are captured by type and formatted like std::cout would
+        FLogRecord record;
+        record.Begin(ELogLevel::INFO, ELogCategory::COMBAT, 0);
+        record.Append("[CombatSystem] ");
+        record.Append(std::string("Legion Soldier"));
+        record.Append(" health: ");
+        record.Append(72.5f);
+        record.Append('/');
+        record.Append(100);
+        Assert(Logger::FormatMessage(record) == "[CombatSystem] Legion Soldier health: 72.5/100", "Deferred formatting");
+        
+        ELogLevel previous_level = Logger::GetLevel();
+        uint32_t previous_mask = Logger::GetCategoryMask();
+        
+        Logger::SetLevel(ELogLevel::WARNING);
+        Assert(!Logger::IsEnabled(ELogLevel::INFO, ELogCategory::GAME), "Level filter");
+        Assert(Logger::IsEnabled(ELogLevel::ERROR, ELogCategory::GAME), "Higher levels pass");
+        Logger::SetCategoryMask(LOG_CATEGORY_ALL & ~static_cast<uint32_t>(ELogCategory::SAVE));
+        Assert(!Logger::IsEnabled(ELogLevel::ERROR, ELogCategory::SAVE), "Category mask");
+        
+        // File sink receives everything written before Flush returns
+        Logger& logger = Logger::Get();
+        logger.SetConsoleEnabled(false);
+        Assert(logger.OpenFile("test_log.txt"), "Log file opened");
+        for (int i = 0; i < 100; ++i) {
+            NAUVOO_LOG_WARNING(ELogCategory::COMBAT, "[Test] message ", i);
+        }
+        NAUVOO_LOG_ERROR(ELogCategory::SAVE, "[Test] masked");
+        logger.Flush();
+        logger.CloseFile();
+        logger.SetConsoleEnabled(true);
+        Logger::SetLevel(previous_level);
+        Logger::SetCategoryMask(previous_mask);
+        
+        std::ifstream log_file("test_log.txt");
+        std::string line;
+        int lines = 0;
+        bool masked_written = false;
+        while (std::getline(log_file, line)) {
+            lines++;
+            if (line.find("masked") != std::string::npos) masked_written = true;
+        }
+        Assert(lines == 100 && !masked_written, "Async writer drained filtered records");
+        log_file.close();
+        std::remove("test_log.txt");
+        
+        std::cout << std::endl;
+    }
+
+    void TestMetrics() {
+        std::cout << "[TEST SUITE] Metrics\n";
+        
+        // Log-linear buckets: exact below 16, within 1/16 above
+        MetricHistogram histogram;
+        for (uint64_t v = 1; v <= 1000; ++v) histogram.Record(v);
+        Assert(histogram.GetCount() == 1000 && histogram.GetMax() == 1000, "Histogram counts samples");
+        uint64_t p50 = histogram.GetPercentile(50.0);
+        Assert(p50 >= 500 && p50 <= 500 + 500 / 16, "Histogram p50 within bucket precision");
+        Assert(MetricHistogram::BucketIndex(7) == 7 && MetricHistogram::BucketUpperBound(MetricHistogram::BucketIndex(40)) >= 40,
+               "Bucket bounds contain their values");
+        
+        MetricsRegistry& registry = MetricsRegistry::Get();
+        MetricCounter& actions = registry.GetCounter("reputation.actions_recorded");
+        MetricCounter& transitions = registry.GetCounter("schedule.transitions");
+        uint64_t actions_before = actions.Get();
+        uint64_t transitions_before = transitions.Get();
+        
+        GameManager gm;
+        gm.Initialize();
+        FNPC npc;
+        npc.id = "npc_metrics";
+        npc.name = "Metrics Settler";
+        gm.SpawnNPC(npc);
+        gm.GetScheduleManager()->AddSchedule(SyntheticContentGenerator::MakeSchedule(npc.id, 0));
+        
+        Assert(gm.EnableMetricsDump("test_metrics.jsonl", 60), "Metrics dump enabled");
+        gm.RecordPlayerAction("attend_drill");
+        gm.AdvanceGameTime(180);
+        gm.Update(0.016f);
+        gm.DisableMetricsDump();
+        
+        Assert(actions.Get() == actions_before + 1, "Managers publish counters");
+        Assert(transitions.Get() > transitions_before, "Schedule transitions counted");
+        Assert(&registry.GetCounter("reputation.actions_recorded") == &actions, "Registry returns the same metric by name");
+        
+        std::ifstream dump("test_metrics.jsonl");
+        std::string line;
+        int snapshots = 0;
+        bool has_fields = true;
+        while (std::getline(dump, line)) {
+            snapshots++;
+            has_fields = has_fields && line.find("\"counters\"") != std::string::npos
+                                    && line.find("\"histograms\"") != std::string::npos;
+        }
+        Assert(snapshots == 3 && has_fields, "Snapshots written at start, after the hour and on close");
+        dump.close();
+        std::remove("test_metrics.jsonl");
+        
+        std::cout << std::endl;
+    }
+
+    void TestJobSystem() {
+        std::cout << "[TEST SUITE] Job System\n";
+        
+        JobSystem pool(3);
+        Assert(pool.GetWorkerCount() == 3, "Pool starts requested workers");
+        
+        std::vector<int> values(10000, 1);
+        std::atomic<int64_t> sum{ 0 };
+        std::atomic<int> chunks{ 0 };
+        pool.ParallelFor(values.size(), 64, [&](size_t, size_t begin, size_t end) {
+            int64_t local = 0;
+            for (size_t i = begin; i < end; ++i) local += values[i];
+            sum.fetch_add(local);
+            chunks.fetch_add(1);
+        });
+        Assert(sum.load() == 10000, "ParallelFor covers every index once");
+        Assert(chunks.load() == static_cast<int>(JobSystem::GetChunkCount(values.size(), 64)),
+               "Chunk count fixed by grain");
+        
+        // a -> (b, c) -> d
+        std::vector<std::string> order;
+        std::mutex order_mutex;
+        auto record = [&](const char* name) {
+            std::lock_guard<std::mutex> lock(order_mutex);
+            order.push_back(name);
+        };
+        JobGraph graph;
+        auto a = graph.AddNode("a", [&]() { record("a"); });
+        auto b = graph.AddNode("b", [&]() { record("b"); });
+        auto c = graph.AddNode("c", [&]() { record("c"); });
+        auto d = graph.AddNode("d", [&]() { record("d"); });
+        graph.AddDependency(a, b);
+        graph.AddDependency(a, c);
+        graph.AddDependency(b, d);
+        graph.AddDependency(c, d);
+        graph.Run(pool);
+        Assert(order.size() == 4 && order.front() == "a" && order.back() == "d", "Graph runs nodes after their dependencies");
+        
+        CommandBuffer<size_t> commands;
+        commands.Reset(JobSystem::GetChunkCount(1000, 10));
+        pool.ParallelFor(1000, 10, [&](size_t chunk, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (i % 7 == 0) commands.Push(chunk, i);
+            }
+        });
+        std::vector<size_t> applied;
+        commands.Apply([&](size_t i) { applied.push_back(i); });
+        Assert(applied.size() == 143 && std::is_sorted(applied.begin(), applied.end()),
+               "Command buffer applies in serial order");
+        
+        // Same world ticked inline and on four threads ends in the same state
+        FSyntheticContentOptions options;
+        options.npc_count = 1000;
+        options.wounded_fraction = 0.3f;
+        JobSystem inline_pool(0);
+        GameManager serial_game;
+        GameManager parallel_game;
+        serial_game.SetJobSystem(&inline_pool);
+        parallel_game.SetJobSystem(&pool);
+        for (GameManager* game : { &serial_game, &parallel_game }) {
+            FSimulationLODSettings lod_settings;
+            lod_settings.budget_ms = 0.0;
+            game->GetSimulationLOD()->SetSettings(lod_settings);
+            game->Initialize();
+            SyntheticContentGenerator::Populate(*game, options);
+        }
+        for (int tick = 0; tick < 120; ++tick) {
+            serial_game.Update(10.0f);
+            parallel_game.Update(10.0f);
+        }
+        
+        size_t dead = 0;
+        for (const FNPC& npc : parallel_game.GetAllNPCs()) {
+            if (!npc.is_alive) dead++;
+        }
+        Assert(dead > 0, "Wounded NPCs bled out during the run");
+        Assert(serial_game.ComputeStateHash() == parallel_game.ComputeStateHash(), "Parallel tick matches serial tick");
+        
+        std::cout << std::endl;
+    }
+
+    void TestSystemScheduler() {
+        std::cout << "[TEST SUITE] System Scheduler\n";
+        
+        SystemScheduler scheduler;
+        auto noop = [](const FSystemTickContext&) {};
+        auto routine = scheduler.RegisterSystem({ "Routine", ETickPhase::SIMULATION,
+            ESystemData::NONE, ESystemData::NPC_ROUTINE, ETickRate::EVERY_FRAME, 1, noop });
+        auto behavior = scheduler.RegisterSystem({ "Behavior", ETickPhase::SIMULATION,
+            ESystemData::NONE, ESystemData::NPC_BEHAVIOR, ETickRate::EVERY_FRAME, 1, noop });
+        auto observer = scheduler.RegisterSystem({ "Observer", ETickPhase::POST,
+            ESystemData::NPC_ROUTINE, ESystemData::NONE, ETickRate::EVERY_FRAME, 1, noop });
+        Assert(scheduler.CanRunConcurrently(routine, behavior), "Disjoint writers run concurrently");
+        Assert(!scheduler.CanRunConcurrently(routine, observer), "Reader waits for writer");
+        
+        // Hourly system split over four frames
+        std::vector<int> visits(10, 0);
+        int minutes_seen = -1;
+        auto hourly = scheduler.RegisterSystem({ "Hourly", ETickPhase::SIMULATION,
+            ESystemData::NONE, ESystemData::WORLD_EVENTS, ETickRate::GAME_HOUR, 4,
+            [&](const FSystemTickContext& context) {
+                auto [begin, end] = context.GetSliceRange(visits.size());
+                for (size_t i = begin; i < end; ++i) visits[i]++;
+                minutes_seen = context.game_minutes;
+            } });
+        
+        JobSystem pool(2);
+        scheduler.SetGameMinutes(360);
+        for (int frame = 0; frame < 6; ++frame) scheduler.Tick(0.016f, pool);
+        Assert(std::count(visits.begin(), visits.end(), 1) == 10, "Amortized run covers every item once");
+        Assert(scheduler.GetRunCount(hourly) == 1 && scheduler.GetRunCount(routine) == 6, "Hourly system gated on game time");
+        
+        scheduler.AdvanceGameMinutes(59);
+        scheduler.Tick(0.016f, pool);
+        Assert(scheduler.GetRunCount(hourly) == 1, "No run before the hour boundary");
+        scheduler.AdvanceGameMinutes(1);
+        for (int frame = 0; frame < 4; ++frame) scheduler.Tick(0.016f, pool);
+        Assert(scheduler.GetRunCount(hourly) == 2 && minutes_seen == 60, "Next run sees elapsed game minutes");
+        Assert(std::count(visits.begin(), visits.end(), 2) == 10, "Second run covers every item again");
+        
+        // Extra systems join the GameManager tick without editing Update
+        GameManager gm;
+        gm.Initialize();
+        int extra_runs = 0;
+        gm.GetSystemScheduler()->RegisterSystem({ "Gossip", ETickPhase::SIMULATION,
+            ESystemData::NPC_ROUTINE, ESystemData::REPUTATION, ETickRate::GAME_MINUTE, 1,
+            [&](const FSystemTickContext&) { extra_runs++; } });
+        gm.SetTimeScale(1.0f);
+        for (int i = 0; i < 10; ++i) gm.Update(1.0f);
+        Assert(gm.GetSystemScheduler()->GetSystemCount() == 12, "Core systems registered");
+        Assert(extra_runs == 10, "Registered system runs once per game minute");
+        
+        std::cout << std::endl;
+    }
+
+    void TestSimulationLOD() {
+        std::cout << "[TEST SUITE] Simulation LOD\n";
+        
+        FSimulationLODSettings settings;
+        settings.full_radius = 50.0f;
+        settings.reduced_radius = 200.0f;
+        settings.reduced_interval_frames = 4;
+        settings.budget_ms = 0.0;
+        SimulationLOD lod;
+        lod.SetSettings(settings);
+        
+        std::vector<FNPC> npcs(4);
+        npcs[0].position = { 10, 0, 0 };
+        npcs[1].position = { 100, 0, 0 };
+        npcs[2].position = { 1000, 0, 0 };
+        npcs[3].position = { 1000, 0, 0 };
+        npcs[3].is_in_combat = true;
+        
+        std::vector<int> ticks(npcs.size(), 0);
+        std::vector<float> simulated(npcs.size(), 0.0f);
+        for (int frame = 0; frame < 8; ++frame) {
+            lod.BuildTickList(npcs, { 0, 0, 0 }, 0.1f);
+            const FNPCTickList& list = lod.GetTickList();
+            for (size_t i = 0; i < list.GetCount(); ++i) {
+                ticks[list.npc_indices[i]]++;
+                simulated[list.npc_indices[i]] += list.delta_times[i];
+            }
+        }
+        Assert(npcs[0].simulation_lod == ESimulationLOD::FULL && ticks[0] == 8, "Nearby NPC ticks every frame");
+        Assert(npcs[3].simulation_lod == ESimulationLOD::FULL && ticks[3] == 8, "NPC in combat always at full detail");
+        Assert(npcs[1].simulation_lod == ESimulationLOD::REDUCED && ticks[1] == 2, "Reduced NPC ticks every few frames");
+        Assert(std::abs(simulated[1] + npcs[1].unsimulated_seconds - 0.8f) < 1e-4f, "Reduced NPC catches up on skipped time");
+        Assert(npcs[2].simulation_lod == ESimulationLOD::DORMANT && ticks[2] == 0, "Distant NPC stays dormant");
+
+        // The budget learns from the time the per-NPC systems report, not the wall time since BuildTickList
+        size_t ticked = lod.GetTickList().GetCount();
+        lod.EndFrame(ticked * 2e-6);
+        Assert(std::abs(lod.GetCostPerTickNs() - 2000.0) < 1e-6, "Tick cost comes from the reported system time");
+
+        // A dormant wounded NPC costs nothing until it is looked up
+        GameManager gm;
+        gm.GetSimulationLOD()->SetSettings(settings);
+        gm.Initialize();
+        FNPC distant;
+        distant.id = "npc_far_wounded";
+        distant.name = "Far Settler";
+        distant.position = { 5000, 0, 0 };
+        FInjury cut;
+        cut.type = EInjuryType::LACERATION;
+        cut.SetBleedRate(0.5f);
+        distant.injuries.push_back(cut);
+        gm.SpawnNPC(distant);
+        
+        for (int i = 0; i < 20; ++i) gm.Update(1.0f);
+        Assert(gm.GetAllNPCs()[0].health == 100.0f, "Dormant NPC not simulated per frame");
+        FNPC* resolved = gm.GetNPCById("npc_far_wounded");
+        Assert(resolved && std::abs(resolved->health - 90.0f) < 1e-3f, "Lookup resolves skipped bleeding");
+        
+        std::cout << std::endl;
+    }
+
+    void TestBleedEvents() {
+        std::cout << "[TEST SUITE] Bleed Events\n";
+        
+        GameManager gm;
+        gm.Initialize();
+        CombatSystem* combat = gm.GetCombatSystem();
+        
+        auto spawn_wounded = [&gm](const std::string& id, float health, float bleed_rate) {
+            FNPC npc;
+            npc.id = id;
+            npc.name = id;
+            npc.health = health;
+            FInjury injury;
+            injury.type = EInjuryType::GUNSHOT;
+            injury.SetBleedRate(bleed_rate);
+            npc.injuries.push_back(injury);
+            gm.SpawnNPC(npc);
+        };
+        spawn_wounded("npc_dying", 10.0f, 2.0f);      // dies after 5 seconds
+        spawn_wounded("npc_treated", 10.0f, 2.0f);
+        for (int i = 0; i < 100; ++i) spawn_wounded("npc_slow_" + std::to_string(i), 100.0f, 0.1f);
+        Assert(combat->GetScheduledDeathCount() == 102, "Each bleeding NPC has one scheduled death");
+        
+        for (int i = 0; i < 4; ++i) gm.Update(1.0f);
+        const FNPC& dying = gm.GetAllNPCs()[0];
+        Assert(dying.is_alive && std::abs(combat->GetNPCHealth(dying) - 2.0f) < 1e-3f, "Health follows the bleed rate analytically");
+        Assert(gm.GetAllNPCs()[2].health == 100.0f, "Stored health untouched between events");
+        
+        combat->TreatInjury(gm.GetAllNPCs()[1], 0);
+        gm.Update(1.0f);
+        Assert(!gm.GetAllNPCs()[0].is_alive, "Scheduled death fires on time");
+        Assert(gm.GetAllNPCs()[1].is_alive && gm.GetAllNPCs()[1].health == 2.0f, "Treatment cancels the scheduled death");
+        
+        FNPC* slow = gm.GetNPCById("npc_slow_0");
+        Assert(slow && std::abs(slow->health - 99.5f) < 1e-3f, "Lookup settles health");
+        Assert(MetricsRegistry::Get().GetGauge("combat.npcs_bleeding").Get() >= 100, "Bleeding NPCs tracked");
+        
+        std::cout << std::endl;
+    }
+
+    void TestTimerWheel() {
+        std::cout << "[TEST SUITE] Timer Wheel\n";
+        
+        TimerWheel wheel(100);
+        std::vector<int> order;
+        auto record = [&order](int id) { return [&order, id]() { order.push_back(id); }; };
+        wheel.Schedule(105, record(1));
+        FTimerHandle cancelled = wheel.Schedule(105, record(2));
+        wheel.Schedule(105, record(3));
+        wheel.Schedule(103, record(4));
+        wheel.Schedule(300, record(5));
+        wheel.Schedule(90000, record(6));
+        FTimerHandle distant = wheel.Schedule(100 + (1ull << 40), record(7));
+        
+        Assert(wheel.Cancel(cancelled) && !wheel.IsPending(cancelled), "Cancelled timer no longer pending");
+        Assert(wheel.Advance(104) == 1 && order == std::vector<int>{ 4 }, "Only due timers fire");
+        wheel.Advance(105);
+        Assert((order == std::vector<int>{ 4, 1, 3 }), "Same-tick timers fire in scheduling order");
+        
+        Assert(wheel.Advance(1000000) == 2 && (order == std::vector<int>{ 4, 1, 3, 5, 6 }), "Large skip fires everything due in order");
+        Assert(wheel.IsPending(distant) && wheel.GetPendingCount() == 1, "Timer beyond the wheel range waits");
+        wheel.Advance(100 + (1ull << 40));
+        Assert(order.back() == 7 && wheel.GetPendingCount() == 0, "Timer beyond the wheel range fires on time");
+        
+        // Self-rescheduling timer across one long skip
+        int days = 0;
+        std::function<void()> daily = [&]() { days++; wheel.ScheduleAfter(1440, daily); };
+        wheel.ScheduleAfter(1440, daily);
+        wheel.Advance(wheel.GetCurrentTick() + 10 * 1440);
+        Assert(days == 10, "Repeating timer fires once per period over a skip");
+        
+        // Game-minute timers: daily decay and wound infection
+        GameManager gm;
+        gm.Initialize();
+        int legion = gm.GetReputationManager()->GetLegionReputation();
+        FPlayerState& player = gm.GetPlayerState();
+        CombatSystem* combat = gm.GetCombatSystem();
+        combat->ApplyDamage(player, 20.0f, EBodyPart::LEFT_ARM, "test");
+        combat->ApplyDamage(player, 20.0f, EBodyPart::RIGHT_LEG, "test");
+        combat->TreatPlayerInjury(player, 1);
+        gm.AdvanceGameTime(59);
+        Assert(!player.injuries[0].infection_risk, "No infection risk before the delay");
+        gm.AdvanceGameTime(1);
+        Assert(player.injuries[0].infection_risk && !player.injuries[1].infection_risk, "Untreated wound risks infection");
+        gm.AdvanceGameTime(3 * 1440);
+        Assert(gm.GetReputationManager()->GetLegionReputation() == std::max(-100, legion - 30), "Reputation decays once per day");
+        combat->ApplyDamage(player, 5.0f, EBodyPart::HEAD, "test");
+        Assert(player.injuries.back().wounded_minute == player.injuries[0].wounded_minute + 60 + 3 * 1440, "Wounds are stamped with the game minute");
+        
+        // Real-time combat timer: the engagement times out after 30 quiet seconds (bandaged, so the player outlasts it)
+        combat->TreatPlayerInjury(player, 0);
+        FNPC raider;
+        raider.id = "npc_timeout_raider";
+        raider.name = "Raider";
+        gm.SpawnNPC(raider);
+        gm.InitiateCombat("npc_timeout_raider");
+        for (int i = 0; i < 29; ++i) gm.Update(1.0f);
+        Assert(combat->IsInCombat(), "Combat continues before the timeout");
+        gm.Update(1.0f);
+        Assert(!combat->IsInCombat(), "Combat ends on timeout");
+        
+        std::cout << std::endl;
+    }
+
+    void TestEventBus() {
+        std::cout << "[TEST SUITE] Event Bus\n";
+        
+        EventBus bus;
+        std::vector<uint32_t> received;
+        size_t batches = 0;
+        bus.Subscribe<FPlayerActionEvent>([&](const FPlayerActionEvent* events, size_t count) {
+            batches++;
+            for (size_t i = 0; i < count; ++i) received.push_back(events[i].action_id.value);
+        });
+        int deaths = 0;
+        bus.Subscribe<FCharacterDiedEvent>([&](const FCharacterDiedEvent*, size_t count) {
+            deaths += static_cast<int>(count);
+            bus.Publish(FPlayerActionEvent{ FSymbol(999u) });
+        });
+        
+        for (uint32_t i = 0; i < 200; ++i) bus.Publish(FPlayerActionEvent{ FSymbol(i) });
+        bus.Publish(FCharacterDiedEvent{ MakeSymbol("npc_a"), EDeathCause::BLED_OUT, {} });
+        Assert(bus.GetPendingCount<FPlayerActionEvent>() == 200 && received.empty(), "Events queue until dispatch");
+        Assert(bus.Dispatch() == 202, "Dispatch delivers handler-published events in a later round");
+        Assert(batches == 2 && received.size() == 201 && received[199] == 199 && received[200] == 999,
+               "Each dispatch round is one batch in publish order");
+        Assert(deaths == 1 && bus.GetPendingCount<FPlayerActionEvent>() == 0, "Every channel drained");
+        
+        // Wrapped ring still delivers in order
+        received.clear();
+        for (uint32_t i = 0; i < 300; ++i) bus.Publish(FPlayerActionEvent{ FSymbol(i) });
+        bus.Dispatch();
+        for (uint32_t i = 0; i < 300; ++i) bus.Publish(FPlayerActionEvent{ FSymbol(1000 + i) });
+        bus.Dispatch();
+        Assert(received.size() == 600 && received[300] == 1000 && received[599] == 1299, "Ring wraps without reordering");
+        
+        // A bleed-out reaches reputation through the bus and marks the game unsaved
+        GameManager gm;
+        gm.Initialize();
+        int legion = gm.GetReputationManager()->GetLegionReputation();
+        FNPC npc;
+        npc.id = "npc_event_victim";
+        npc.name = "Victim";
+        npc.health = 2.0f;
+        FInjury wound;
+        wound.type = EInjuryType::GUNSHOT;
+        wound.SetBleedRate(2.0f);
+        npc.injuries.push_back(wound);
+        gm.SpawnNPC(npc);
+        Assert(gm.GetUnsavedChangeCount() == 0, "No unsaved changes after initialize");
+        gm.Update(1.0f);
+        Assert(!gm.GetAllNPCs()[0].is_alive, "NPC bled out");
+        Assert(gm.GetReputationManager()->GetLegionReputation() == legion + 10, "Death applies the kill_in_combat modifier");
+        gm.TriggerEvent("event_bus_test");
+        gm.Update(0.016f);
+        Assert(gm.GetUnsavedChangeCount() == 2, "Death and world event tracked as unsaved");
+        gm.SaveGame("test_event_bus");
+        Assert(gm.GetUnsavedChangeCount() == 0, "Saving clears unsaved changes");
+        SaveGameManager save_manager;
+        save_manager.DeleteSave("test_event_bus");
+        
+        std::cout << std::endl;
+    }
+
+    void TestWorldEventRegistry() {
+        std::cout << "[TEST SUITE] World Event Registry\n";
+        
+        WorldEventRegistry events;
+        std::vector<EWorldEventChange> changes;
+        events.AddListener([&](FWorldEventId, EWorldEventChange change) { changes.push_back(change); });
+        
+        FWorldEventId drill = events.Intern("event_drill");
+        size_t symbol_count = SymbolTable::Get().GetCount();
+        Assert(events.Intern("event_drill") == drill && events.Find("event_unknown") == INVALID_WORLD_EVENT
+               && SymbolTable::Get().GetCount() == symbol_count, "Event ids interned once; unknown names are not interned");
+        for (int i = 0; i < 100; ++i) events.Intern("event_filler_" + std::to_string(i));
+        FWorldEventId patrol = events.Intern("event_patrol");
+        
+        Assert(events.Trigger(drill) && !events.Trigger(drill) && events.IsActive(drill), "Trigger sets the active flag once");
+        Assert(!events.Complete(patrol) && events.Trigger(patrol) && events.Complete(patrol), "Only active events complete");
+        Assert(!events.IsActive(patrol) && events.IsCompleted(patrol) && events.GetActiveCount() == 1, "Completed event leaves the active set");
+        Assert(events.AddToCounter(patrol, 3) == 3, "Counters accumulate");
+        Assert((changes == std::vector<EWorldEventChange>{ EWorldEventChange::TRIGGERED, EWorldEventChange::TRIGGERED,
+                                                         EWorldEventChange::COMPLETED, EWorldEventChange::COUNTER }),
+               "Listeners hear each change");
+        Assert((events.GetActiveEvents() == std::vector<FWorldEventId>{ drill }), "Active events enumerated from the bitset");
+        
+        WorldEventRegistry copy = events;
+        copy.Trigger(copy.Find("event_filler_5"));
+        Assert(copy.IsActive(patrol) == events.IsActive(patrol) && changes.size() == 4, "Copies keep state but not listeners");
+        
+        // Save round trip into a game that interned other events first
+        GameManager gm;
+        gm.Initialize();
+        gm.TriggerEvent("event_saved_active");
+        gm.TriggerEvent("event_saved_done");
+        gm.CompleteEvent("event_saved_done");
+        gm.GetWorldEvents().SetCounter(gm.GetWorldEvents().Intern("event_saved_counter"), -4);
+        gm.SaveGame("test_world_events");
+        
+        GameManager loaded;
+        loaded.Initialize();
+        FWorldEventId early = loaded.GetWorldEvents().Intern("event_loaded_first");
+        loaded.GetWorldEvents().Trigger(early);
+        loaded.LoadGame("test_world_events");
+        WorldEventRegistry& restored = loaded.GetWorldEvents();
+        Assert(loaded.IsEventActive("event_saved_active") && !loaded.IsEventActive("event_saved_done"), "Active flags restored");
+        Assert(restored.IsCompleted(restored.Find("event_saved_done")), "Completed flags restored");
+        Assert(restored.GetCounter(restored.Find("event_saved_counter")) == -4, "Counters restored");
+        Assert(!restored.IsActive(early) && restored.Find("event_loaded_first") == early, "Load replaces state and keeps interned ids");
+        SaveGameManager save_manager;
+        save_manager.DeleteSave("test_world_events");
+        
+        std::cout << std::endl;
+    }
+
+    void TestScenarioRuntime() {
+        std::cout << "[TEST SUITE] Scenario Runtime\n";
+        
+        FJsonValue parsed;
+        std::string error;
+        Assert(JsonReader::Parse("{\"a\": [1, -2.5e1, true, null], \"s\": \"q\\\"\\u00e9\\ud83d\\ude00\"}", parsed, &error)
+               && parsed["a"].GetSize() == 4 && parsed["a"][1].number == -25.0 && parsed["s"].string == "q\"\xC3\xA9\xF0\x9F\x98\x80",
+               "JSON values, escapes and surrogate pairs parsed");
+        Assert(!JsonReader::Parse("{\n  \"a\": [1,]\n}", parsed, &error) && error.compare(0, 4, "2:11") == 0, "JSON errors report line and column");
+        
+        const char* scenario_json = R"({ "phase_1_scenarios": [
+            { "id": "scn_patrol", "name": "Patrol", "trigger": "test_patrol_ordered",
+              "start_date": "05-15-1841", "start_time": "07:00",
+              "objectives": ["Walk the wall", "Report back"],
+              "events": [
+                { "id": "test_met_sergeant", "trigger": "player_near_sergeant", "npc_id": "npc_test_sergeant", "one_time": true },
+                { "id": "test_briefed", "dialogue_tree_id": "tree_briefing" } ],
+              "reputation_changes": { "legion_delta": 15, "community_delta": 0, "outsider_delta": -5 } },
+            { "id": "scn_followup", "name": "Followup", "trigger": "test_patrol_ordered", "prerequisite_scenario": "scn_patrol",
+              "objectives": ["Rest"],
+              "events": [ { "id": "test_alarm_heard", "trigger": "test_alarm" } ] }
+        ] })";
+        Assert(JsonReader::Parse(scenario_json, parsed, &error), "Scenario JSON parsed");
+        
+        FWorldState world;
+        world.current_time = { 1841, 5, 15, 360 };
+        TimerWheel timers;
+        ReputationManager reputation;
+        ScenarioManager scenarios(world, &reputation, &timers);
+        world.world_events.AddListener([&](FWorldEventId id, EWorldEventChange change) { scenarios.OnWorldEventChanged(id, change); });
+        Assert(scenarios.LoadScenarios(parsed) && scenarios.GetScenarioCount() == 2 && world.scenarios.size() == 2, "Scenarios loaded");
+        scenarios.ResetProgress();
+        Assert(scenarios.FindScenario("scn_followup")->prerequisite == 0, "Prerequisites resolved");
+        
+        FNPC sergeant;
+        sergeant.id = "npc_test_sergeant";
+        sergeant.position = { 10.0f, 0.0f, 0.0f };
+        world.all_npcs.push_back(sergeant);
+        
+        scenarios.Update();
+        uint64_t evaluations = scenarios.GetEvaluationCount();
+        scenarios.Update();
+        Assert(scenarios.GetEvaluationCount() == evaluations, "Nothing re-evaluated while no input changes");
+        
+        world.world_events.Trigger(world.world_events.Intern("test_patrol_ordered"));
+        scenarios.Update();
+        Assert(scenarios.GetStatus("scn_patrol") == EScenarioStatus::LOCKED, "Start time gates the trigger");
+        Assert(scenarios.GetEvaluationCount() == evaluations + 2, "Only the scenarios indexed under the event evaluated");
+        
+        world.current_time.minute += 60;
+        timers.Advance(60);
+        scenarios.Update();
+        Assert(scenarios.GetStatus("scn_patrol") == EScenarioStatus::ACTIVE, "Start timer wakes the scenario");
+        Assert(scenarios.GetStatus("scn_followup") == EScenarioStatus::LOCKED, "Prerequisite holds the follow-up back");
+        
+        scenarios.Update();
+        Assert(!world.world_events.IsActive(world.world_events.Find("test_met_sergeant")), "NPC out of reach");
+        world.player.position = { 7.0f, 0.0f, 0.0f };
+        scenarios.Update();
+        Assert(world.world_events.IsActive(world.world_events.Find("test_met_sergeant")), "Proximity fires as the player arrives");
+        
+        scenarios.OnDialogueStarted(MakeSymbol("tree_briefing"));
+        scenarios.Update();
+        Assert(scenarios.GetProgress("scn_patrol")->events_fired == 3u, "Dialogue trigger fires its event");
+        
+        Assert(scenarios.CompleteObjective("scn_patrol", 0) && !scenarios.CompleteObjective("scn_patrol", 0), "Objective completes once");
+        Assert(scenarios.CompleteObjective("scn_patrol", 1) && scenarios.GetStatus("scn_patrol") == EScenarioStatus::COMPLETED,
+               "Last objective completes the scenario");
+        Assert(reputation.GetLegionReputation() == 15 && reputation.GetOutsiderReputation() == -5, "Completion applies reputation");
+        scenarios.Update();
+        Assert(scenarios.GetStatus("scn_followup") == EScenarioStatus::ACTIVE, "Completion unlocks dependents");
+        world.world_events.Trigger(world.world_events.Intern("test_alarm"));
+        scenarios.Update();
+        Assert(scenarios.GetProgress("scn_followup")->events_fired == 1u, "World event trigger fires its event");
+        
+        // Progress saves with the world
+        GameManager gm;
+        gm.Initialize();
+        gm.GetScenarioManager()->LoadScenarios(parsed);
+        gm.GetScenarioManager()->ResetProgress();
+        gm.TriggerEvent("test_patrol_ordered");
+        gm.AdvanceGameTime(60);
+        gm.Update(0.0f);
+        Assert(gm.GetScenarioManager()->GetStatus("scn_patrol") == EScenarioStatus::ACTIVE, "Scenarios run in the game tick");
+        gm.GetScenarioManager()->CompleteObjective("scn_patrol", 1);
+        gm.SaveGame("test_scenarios");
+        
+        GameManager loaded;
+        loaded.Initialize();
+        loaded.GetScenarioManager()->LoadScenarios(parsed);
+        loaded.LoadGame("test_scenarios");
+        const FScenarioProgress* progress = loaded.GetScenarioManager()->GetProgress("scn_patrol");
+        Assert(progress && progress->status == EScenarioStatus::ACTIVE && progress->objectives_done == 2u, "Scenario progress restored");
+        SaveGameManager save_manager;
+        save_manager.DeleteSave("test_scenarios");
+        
+        // Start times count on the 30-day calendar the clock rolls over by
+        const char* month_end_json = R"({ "phase_1_scenarios": [
+            { "id": "scn_new_month", "name": "New Month", "start_date": "06-01-1841", "start_time": "00:00", "objectives": ["Wait"] },
+            { "id": "scn_bad_date", "name": "Bad Date", "start_date": "05-31-1841", "start_time": "00:00", "objectives": ["Wait"] } ] })";
+        Assert(JsonReader::Parse(month_end_json, parsed, &error), "Month-end scenario JSON parsed");
+        FWorldState calendar_world;
+        calendar_world.current_time = { 1841, 5, 30, 1380 };
+        TimerWheel calendar_timers;
+        ScenarioManager calendar(calendar_world, &reputation, &calendar_timers);
+        Assert(calendar.LoadScenarios(parsed), "Month-end scenarios load");
+        calendar.ResetProgress();
+        Assert(calendar.FindScenario("scn_new_month")->start_minute > 0 && calendar.FindScenario("scn_bad_date")->start_minute == -1,
+               "Days past the 30th are not on the calendar");
+        calendar.Update();
+        Assert(calendar.GetStatus("scn_new_month") == EScenarioStatus::LOCKED, "Next month's scenario waits");
+        calendar_world.current_time = { 1841, 6, 1, 0 };
+        calendar_timers.Advance(60);
+        calendar.Update();
+        Assert(calendar.GetStatus("scn_new_month") == EScenarioStatus::ACTIVE, "Start timer fires on time across a month end");
+        
+        // The shipped data, when run from the repository root
+        if (JsonReader::ParseFile("source/Data/phase_1_scenarios.json", parsed)) {
+            Assert(scenarios.LoadScenarios(parsed) && scenarios.GetScenarioCount() == 5, "Phase 1 scenarios load");
+        }
+        
+        std::cout << std::endl;
+    }
+
+    void TestSymbols() {
+        std::cout << "[TEST SUITE] Symbols\n";
+        
+        static_assert(PLAYER_SYMBOL.IsValid() && !PreinternedSymbol("npc_unknown").IsValid(), "Preinterned symbols are constants");
+        Assert(SymbolTable::Get().GetName(PLAYER_SYMBOL) == "player", "Preinterned symbols are interned first");
+        const FSymbol ATTEND_DRILL = MakeSymbol("attend_drill");
+        Assert(ATTEND_DRILL.IsValid() && ATTEND_DRILL != MakeSymbol("skip_drill"), "Distinct texts give distinct symbols");
+        std::string built = std::string("attend_") + "drill";
+        Assert(FSymbol(built) == ATTEND_DRILL, "Runtime text gives the literal's symbol");
+        
+        SymbolTable& table = SymbolTable::Get();
+        Assert(!table.Find("test_symbol_unseen").IsValid(), "Unknown text has no symbol in the table");
+        FSymbol interned = table.Intern("test_symbol_seen");
+        Assert(table.Find("test_symbol_seen") == interned && table.GetName(interned) == "test_symbol_seen", "Interned symbols map back to text");
+        
+        // FNV-1a 32 maps these two to the same hash; they still get symbols of their own
+        static_assert(HashSymbol("costarring") == HashSymbol("liquid"), "The texts collide in the index");
+        FSymbol first = table.Intern("costarring");
+        FSymbol second = table.Intern("liquid");
+        Assert(first != second && table.Intern("liquid") == second && table.GetName(first) == "costarring"
+               && table.GetName(second) == "liquid", "Hash collisions do not merge symbols");
+        size_t count = table.GetCount();
+        Assert(table.Intern("test_symbol_next") == FSymbol(static_cast<uint32_t>(count + 1)), "Symbols are handed out in order");
+        
+        ReputationManager reputation;
+        reputation.RecordAction(ATTEND_DRILL, {});
+        reputation.ModifyNPCTrust(MakeSymbol("npc_thomas_brown"), 10);
+        Assert(reputation.GetLegionReputation() == 20 && reputation.GetNPCTrust("npc_thomas_brown") == 10, "Managers keyed by symbol");
+        size_t interned_count = table.GetCount();
+        Assert(reputation.GetNPCTrust("test_symbol_typo") == reputation.GetNPCTrust(FSymbol()) && table.GetCount() == interned_count,
+               "Looking up an unknown id does not intern it");
+        
+        // A saved value from another run is remapped through its name
+        FSaveWriter writer;
+        writer.PutVarint(2);
+        writer.PutVarint(interned.value);
+        writer.PutString("test_symbol_seen");
+        writer.PutVarint(12345);
+        writer.PutString("test_symbol_resaved");
+        FSaveSymbolTable saved;
+        FSaveReader reader(writer.GetBuffer());
+        Assert(saved.Read(reader) && saved.Resolve(interned.value) == interned
+               && saved.Resolve(12345) == MakeSymbol("test_symbol_resaved") && !saved.Resolve(54321).IsValid(),
+               "Saved symbols resolve through their names");
+        Assert(table.GetName(MakeSymbol("test_symbol_resaved")) == "test_symbol_resaved", "Loading interns saved names");
+        
+        std::cout << std::endl;
+    }
+
+    void TestMemory() {
+        std::cout << "[TEST SUITE] Memory\n";
+        
+        FrameArena arena(4096);
+        std::pmr::vector<int> small(&arena);
+        small.reserve(100);
+        Assert(arena.GetUsed() >= 100 * sizeof(int) && arena.GetSpillCount() == 0, "Arena bumps within its buffer");
+        arena.Reset();
+        Assert(arena.GetUsed() == 0 && arena.GetCapacity() == 4096, "Reset rewinds without reallocating");
+        
+        std::pmr::vector<char> large(&arena);
+        large.reserve(10000);
+        Assert(arena.GetSpillCount() == 1, "Oversized tick spills to the heap");
+        large = std::pmr::vector<char>(&arena);
+        arena.Reset();
+        Assert(arena.GetCapacity() >= 10000 && arena.GetHighWater() >= 10000, "Next Reset grows to the high-water mark");
+        
+        FixedBlockPool pool(64, 8);
+        std::vector<void*> blocks;
+        for (int i = 0; i < 8; ++i) blocks.push_back(pool.allocate(48));
+        for (void* block : blocks) pool.deallocate(block, 48);
+        for (int i = 0; i < 8; ++i) blocks[i] = pool.allocate(64);
+        Assert(pool.GetChunkCount() == 1 && pool.GetLiveBlocks() == 8, "Freed blocks are reused");
+        for (void* block : blocks) pool.deallocate(block, 64);
+        
+        FInjuryList warm;
+        for (int i = 0; i < 8; ++i) warm.push_back(FInjury());
+        warm.clear();
+        FAllocationStats before = GetAllocationStats();
+        for (int i = 0; i < 100; ++i) {
+            FInjuryList injuries;
+            injuries.push_back(FInjury());
+            injuries.push_back(FInjury());
+            injuries.pop_back();
+        }
+        // Read before Assert builds its message string
+        uint64_t list_allocations = GetAllocationStats().allocations - before.allocations;
+        Assert(list_allocations == 0, "Injury lists keep their first wounds inline");
+        
+        before = GetAllocationStats();
+        for (int i = 0; i < 100; ++i) {
+            FInjuryList injuries;
+            for (int k = 0; k < 6; ++k) injuries.push_back(FInjury());
+        }
+        list_allocations = GetAllocationStats().allocations - before.allocations;
+        Assert(list_allocations == 0, "Injuries past the inline slots overflow into the pool");
+        
+        FInjuryList spilled;
+        for (uint8_t k = 0; k < 6; ++k) {
+            FInjury injury;
+            injury.severity = k;
+            injury.SetBleedRate(0.25f * k);
+            spilled.push_back(injury);
+        }
+        FInjuryList copied = spilled;
+        Assert(spilled.IsOverflowing() && copied.size() == 6 && copied[0].severity == 0 && copied[5].severity == 5
+               && copied.end() - copied.begin() == 6 && copied[5].GetBleedRate() == 1.25f,
+               "Overflowing injury lists stay contiguous and in order");
+        FInjuryList moved = std::move(spilled);
+        FInjuryList short_list;
+        short_list.push_back(copied[3]);
+        FInjuryList taken = std::move(short_list);
+        Assert(moved.size() == 6 && moved[5].severity == 5 && spilled.empty() && spilled.begin() == spilled.end()
+               && short_list.empty() && taken.size() == 1 && taken[0].severity == 3,
+               "Moved-from injury lists are empty");
+        spilled.push_back(copied[1]);
+        Assert(spilled.size() == 1 && spilled[0].severity == 1 && !spilled.IsOverflowing(), "Moved-from injury lists can be reused");
+        
+        if (IsAllocationTrackingEnabled()) {
+            GameManager game;
+            game.Initialize();
+            game.StartNewGame();
+            FSyntheticContentOptions options;
+            options.npc_count = 100;
+            options.wounded_fraction = 0.2f;
+            SyntheticContentGenerator::Populate(game, options);
+            for (int i = 0; i < 1000; ++i) game.Update(0.1f);
+            
+            uint64_t allocations = 0;
+            for (int i = 0; i < 100; ++i) {
+                game.Update(0.1f);
+                allocations += game.GetLastTickAllocations();
+            }
+            Assert(allocations == 0, "Steady-state ticks do not allocate");
+        }
+        
+        std::cout << std::endl;
+    }
+
+    void TestFlatMap() {
+        std::cout << "[TEST SUITE] Flat maps\n";
+        
+        // Enough keys to grow through several rehashes and span many probe groups
+        TFlatHashMap<FSymbol, int> map;
+        std::vector<FSymbol> keys;
+        for (int i = 0; i < 1000; ++i) {
+            keys.push_back(FSymbol(SyntheticContentGenerator::MakeNPCId(i)));
+            map[keys.back()] = i;
+        }
+        bool all_found = map.size() == keys.size();
+        for (int i = 0; i < 1000; ++i) {
+            auto it = map.find(keys[i]);
+            all_found = all_found && it != map.end() && it->second == i;
+        }
+        Assert(all_found && !map.contains(MakeSymbol("npc_never_added")), "Every inserted key found after growth");
+        
+        for (int i = 0; i < 1000; i += 2) map.erase(keys[i]);
+        size_t visited = 0;
+        bool only_odd = true;
+        for (const auto& entry : map) {
+            visited++;
+            only_odd = only_odd && entry.second % 2 == 1;
+        }
+        Assert(visited == 500 && only_odd && !map.contains(keys[0]) && map.contains(keys[1]), "Erase leaves the rest reachable");
+        
+        for (auto it = map.begin(); it != map.end();) {
+            it = it->second < 500 ? map.erase(it) : std::next(it);
+        }
+        TFlatHashMap<FSymbol, int> copy = map;
+        map[keys[0]] = -1;
+        Assert(copy.size() == 250 && !copy.contains(keys[0]) && copy.find(keys[999])->second == 999, "Erase while iterating; copies are independent");
+        
+        TFlatSortedMap<EFormatSeason, int> seasons;
+        seasons[EFormatSeason::WINTER] = 4;
+        seasons[EFormatSeason::SPRING] = 1;
+        seasons.try_emplace(EFormatSeason::SPRING, 99);
+        Assert(seasons.size() == 2 && seasons.begin()->first == EFormatSeason::SPRING && seasons.find(EFormatSeason::SPRING)->second == 1
+               && !seasons.contains(EFormatSeason::SUMMER), "Sorted map keeps key order and first value");
+        
+        std::cout << std::endl;
+    }
+
+    void TestWeapons() {
+        std::cout << "[TEST SUITE] Weapons\n";
+        
+        GameManager gm;
+        gm.Initialize();
+        WeaponRegistry* registry = gm.GetWeaponRegistry();
+        FWeaponArchetypeId musket_id = registry->Find("weapon_musket");
+        FWeaponArchetypeId saber_id = registry->Find("weapon_saber");
+        Assert(registry->GetCount() > 1 && musket_id != INVALID_WEAPON_ARCHETYPE && registry->GetDefault() == musket_id,
+               "Weapons loaded from data");
+        const FWeaponArchetype& musket = registry->Get(musket_id);
+        Assert(saber_id != INVALID_WEAPON_ARCHETYPE && registry->Get(saber_id).max_ammo == 0, "Melee weapons carry no ammo");
+        
+        CombatSystem* combat = gm.GetCombatSystem();
+        const FSymbol RIFLEMAN = MakeSymbol("npc_test_rifleman");
+        const FSymbol SWORDSMAN = MakeSymbol("npc_test_swordsman");
+        Assert(combat->EquipWeapon(RIFLEMAN, MakeSymbol("weapon_musket")) && combat->EquipWeapon(SWORDSMAN, MakeSymbol("weapon_saber"))
+               && !combat->EquipWeapon(SWORDSMAN, MakeSymbol("weapon_unknown")), "Only known weapons equip");
+        Assert(combat->GetWeaponState(SWORDSMAN)->archetype == saber_id, "Failed equip keeps the weapon carried");
+        
+        // Misfires keep the charge; keep trying until the shot goes off
+        EWeaponDischarge discharge = EWeaponDischarge::MISFIRED;
+        for (int attempt = 0; attempt < 50 && discharge == EWeaponDischarge::MISFIRED; ++attempt) {
+            discharge = combat->DischargeWeapon(RIFLEMAN);
+            if (discharge == EWeaponDischarge::MISFIRED) combat->AdvanceTime(musket.fire_rate);
+        }
+        const FWeaponState* rifle = combat->GetWeaponState(RIFLEMAN);
+        Assert(discharge == EWeaponDischarge::FIRED && rifle->ammo == 0 && rifle->IsReloading() && rifle->fouling > 0.0f,
+               "Firing the last round starts the reload and fouls the barrel");
+        Assert(combat->DischargeWeapon(RIFLEMAN) == EWeaponDischarge::RELOADING, "Cannot fire while reloading");
+        
+        combat->AdvanceTime(musket.reload_time * 0.5f);
+        Assert(rifle->IsReloading() && rifle->ammo == 0, "Reload takes the archetype's reload time");
+        combat->AdvanceTime(musket.reload_time * 0.5f + 0.01f);
+        Assert(!rifle->IsReloading() && rifle->ammo == musket.max_ammo && rifle->cooldown == 0.0f, "Reload completes in the batched update");
+        combat->CleanWeapon(RIFLEMAN);
+        Assert(rifle->fouling == 0.0f, "Cleaning removes fouling");
+        
+        Assert(combat->DischargeWeapon(SWORDSMAN) == EWeaponDischarge::FIRED
+               && combat->DischargeWeapon(SWORDSMAN) == EWeaponDischarge::COOLING_DOWN, "Melee attacks wait out their cooldown");
+        combat->UnequipWeapon(RIFLEMAN);
+        Assert(combat->GetArmedCount() == 1 && !combat->GetWeaponState(RIFLEMAN) && combat->GetWeaponState(SWORDSMAN)->archetype == saber_id,
+               "Unequipping keeps the other weapons addressable");
+        
+        // The player's weapon follows equipped_weapon_id and keeps its ammo between shots
+        FNPC enemy;
+        enemy.id = "test_weapon_target";
+        gm.SpawnNPC(enemy);
+        gm.InitiateCombat("test_weapon_target");
+        gm.GetPlayerState().equipped_weapon_id = "weapon_revolver";
+        const FWeaponArchetype& revolver = registry->Get(registry->Find("weapon_revolver"));
+        gm.FireWeapon({ 0, 0, 0 }, "test_weapon_target");
+        const FWeaponState* sidearm = combat->GetWeaponState(PLAYER_SYMBOL);
+        int first_ammo = sidearm->ammo;
+        gm.FireWeapon({ 0, 0, 0 }, "test_weapon_target");
+        Assert(sidearm->archetype == registry->Find("weapon_revolver") && first_ammo >= revolver.max_ammo - 1
+               && sidearm->ammo == first_ammo, "Player weapon state persists; no second shot during the cooldown");
+        
+        std::cout << std::endl;
+    }
+
+    void TestVolley() {
+        std::cout << "[TEST SUITE] Volley Fire\n";
+        
+        Assert(DetermineBodyPart(0.0f, 1.7f) == EBodyPart::HEAD && DetermineBodyPart(0.05f, 1.2f) == EBodyPart::TORSO
+               && DetermineBodyPart(-0.3f, 1.2f) == EBodyPart::LEFT_ARM && DetermineBodyPart(0.3f, 1.2f) == EBodyPart::RIGHT_ARM
+               && DetermineBodyPart(-0.1f, 0.4f) == EBodyPart::LEFT_LEG && DetermineBodyPart(0.1f, 0.4f) == EBodyPart::RIGHT_LEG,
+               "Impact points map onto body parts");
+        
+        // Point blank, at the effective range (half the chance) and far beyond it, all with the same roll
+        FVolley volley;
+        volley.AddShot(FSymbol(), { 0, 0, 0 }, EStance::STANDING, 0, { 0, 1, 0 });
+        volley.AddShot(FSymbol(), { 0, 0, 0 }, EStance::STANDING, 0, { 0, 100, 0 });
+        volley.AddShot(FSymbol(), { 0, 0, 0 }, EStance::STANDING, 0, { 0, 1000, 0 });
+        FShotBatch batch;
+        batch.Resize(volley.GetCount());
+        for (size_t i = 0; i < volley.GetCount(); ++i) {
+            batch.accuracy[i] = 0.9f;
+            batch.range[i] = 100.0f;
+            batch.damage[i] = 40.0f;
+            batch.hit_roll[i] = 0.46f;
+            batch.lateral_roll[i] = batch.height_roll[i] = 0.5f;
+        }
+        ResolveShots(volley, batch, 0, volley.GetCount());
+        Assert(batch.hit[0] && !batch.hit[1] && !batch.hit[2], "Hit chance falls off with range");
+        batch.hit_roll[1] = 0.44f;
+        ResolveShots(volley, batch, 1, 2);
+        Assert(batch.hit[1] && batch.body_part[0] == EBodyPart::TORSO && batch.hit_damage[0] == 40.0f,
+               "Centred balls strike the torso for full damage");
+        
+        // A line of militia fires on a sturdy and a frail target, and one man on the player
+        GameManager gm;
+        gm.Initialize();
+        CombatSystem* combat = gm.GetCombatSystem();
+        FNPC sturdy;
+        sturdy.id = "test_volley_sturdy";
+        sturdy.health = sturdy.max_health = 100000.0f;
+        sturdy.position = { 0, 30, 0 };
+        FNPC frail;
+        frail.id = "test_volley_frail";
+        frail.health = 1.0f;
+        frail.position = { 10, 5, 0 };
+        gm.SpawnNPC(sturdy);
+        gm.SpawnNPC(frail);
+        std::vector<FNPC>& npcs = gm.GetAllNPCs();
+        auto index_of = [&](const std::string& id) {
+            return static_cast<uint32_t>(std::find_if(npcs.begin(), npcs.end(), [&](const FNPC& npc) { return npc.id == id; }) - npcs.begin());
+        };
+        
+        FVolley line;
+        for (int i = 0; i < 50; ++i) {
+            FSymbol militia = SymbolTable::Get().Intern("npc_test_militia_" + std::to_string(i));
+            combat->EquipWeapon(militia, MakeSymbol("weapon_musket"));
+            FVector3 position = { static_cast<float>(i), 0, 0 };
+            if (i == 0) line.AddShot(militia, position, EStance::PRONE, VOLLEY_TARGET_PLAYER, gm.GetPlayerState().position);
+            else if (i < 10) line.AddShot(militia, position, EStance::PRONE, index_of(frail.id), frail.position);
+            else line.AddShot(militia, position, EStance::STANDING, index_of(sturdy.id), sturdy.position);
+        }
+        FVolleyResult result = combat->FireVolley(line, npcs, gm.GetPlayerState());
+        const FNPC& sturdy_after = npcs[index_of(sturdy.id)];
+        const FNPC& frail_after = npcs[index_of(frail.id)];
+        bool spread = std::any_of(sturdy_after.injuries.begin(), sturdy_after.injuries.end(),
+                                  [](const FInjury& injury) { return injury.location != EBodyPart::TORSO; });
+        Assert(result.fired + result.misfired == 50 && result.hits > 0
+               && static_cast<int>(sturdy_after.injuries.size() + frail_after.injuries.size() + gm.GetPlayerState().injuries.size()) == result.hits,
+               "Every hit of the volley lands once");
+        Assert(spread, "Hits spread across the body");
+        Assert(!frail_after.is_alive && frail_after.injuries.size() == 1, "Balls reaching a target killed earlier in the volley are spent");
+        
+        FVolleyResult reloading = combat->FireVolley(line, npcs, gm.GetPlayerState());
+        Assert(reloading.fired == 0 && reloading.misfired == 0 && reloading.hits == 0,
+               "The line cannot fire again while reloading and cooling down");
+        
+        // The player's own shot goes at the enemy
+        gm.InitiateCombat(sturdy.id);
+        size_t sturdy_injuries = sturdy_after.injuries.size();
+        size_t player_injuries = gm.GetPlayerState().injuries.size();
+        for (int i = 0; i < 20 && sturdy_after.injuries.size() == sturdy_injuries; ++i) {
+            gm.GetPlayerState().stamina = 100.0f;
+            gm.FireWeapon(sturdy.position, sturdy.id);
+            combat->AdvanceTime(20.0f);
+        }
+        Assert(sturdy_after.injuries.size() > sturdy_injuries && gm.GetPlayerState().injuries.size() == player_injuries,
+               "FireWeapon hits the enemy, not the player");
+        
+        std::cout << std::endl;
+    }
+
+    void TestEncounters() {
+        std::cout << "[TEST SUITE] Encounters\n";
+        
+        GameManager gm;
+        gm.Initialize();
+        CombatSystem* combat = gm.GetCombatSystem();
+        EncounterManager& encounters = combat->GetEncounters();
+        for (int i = 0; i < 12; ++i) {
+            FNPC rioter;
+            rioter.id = "npc_test_rioter_" + std::to_string(i);
+            gm.SpawnNPC(rioter);
+        }
+        std::vector<FNPC>& npcs = gm.GetAllNPCs();
+        uint32_t first = static_cast<uint32_t>(npcs.size() - 12);
+        
+        // A three-way street fight and a separate ambush with a short fuse
+        FEncounterId street = encounters.StartEncounter(combat->GetClock());
+        FEncounterId ambush = encounters.StartEncounter(combat->GetClock(), 10.0);
+        for (uint32_t i = 0; i < 9; ++i) encounters.Join(street, static_cast<uint8_t>(i % 3), npcs, first + i);
+        for (uint32_t i = 9; i < 12; ++i) encounters.Join(ambush, static_cast<uint8_t>(i % 2), npcs, first + i);
+        Assert(encounters.GetActiveCount() == 2 && encounters.GetParticipantCount(street) == 9 && encounters.GetParticipantCount(ambush) == 3
+               && npcs[first].is_in_combat && encounters.GetSide(FSymbol(npcs[first + 4].id)) == 1, "Encounters keep their own participants and sides");
+        Assert(!encounters.Join(street, EncounterManager::MAX_SIDES, npcs, first) && !encounters.Join(INVALID_ENCOUNTER, 0, npcs, first),
+               "Unknown encounters and sides are refused");
+        
+        // Side 1 is shot down; two sides still fight
+        for (uint32_t i = 1; i < 9; i += 3) npcs[first + i].is_alive = false;
+        combat->UpdateEncounters(npcs, gm.GetPlayerState());
+        Assert(encounters.IsActive(street) && encounters.GetParticipantCount(street) == 6 && !npcs[first + 1].is_in_combat,
+               "The dead leave their encounter");
+        // Side 2 flees; the last side standing wins
+        for (uint32_t i = 2; i < 9; i += 3) npcs[first + i].is_in_combat = false;
+        combat->UpdateEncounters(npcs, gm.GetPlayerState());
+        const std::vector<FEncounterEnd>& ended = encounters.GetEnded();
+        Assert(!encounters.IsActive(street) && ended.size() == 1 && ended[0].id == street && ended[0].reason == EEncounterEnd::RESOLVED
+               && !npcs[first].is_in_combat && encounters.GetParticipantCount() == 3, "One-sided encounters resolve");
+        
+        // Shots keep the ambush going past its timeout; quiet lets it lapse
+        combat->AdvanceTime(8.0f);
+        encounters.MarkActive(FSymbol(npcs[first + 9].id), combat->GetClock());
+        combat->AdvanceTime(8.0f);
+        combat->UpdateEncounters(npcs, gm.GetPlayerState());
+        Assert(encounters.IsActive(ambush), "Activity pushes the timeout back");
+        combat->AdvanceTime(2.5f);
+        combat->UpdateEncounters(npcs, gm.GetPlayerState());
+        Assert(!encounters.IsActive(ambush) && encounters.GetEnded()[0].reason == EEncounterEnd::TIMED_OUT
+               && encounters.GetParticipantCount() == 0 && !npcs[first + 9].is_in_combat, "Quiet encounters time out");
+        
+        // The player joins a fight in progress on the far side, and ending it releases everyone
+        FEncounterId brawl = encounters.StartEncounter(combat->GetClock());
+        encounters.Join(brawl, 0, npcs, first);
+        encounters.Join(brawl, 1, npcs, first + 3);
+        gm.InitiateCombat(npcs[first].id);
+        Assert(combat->IsInCombat() && encounters.GetEncounterOf(PLAYER_SYMBOL) == brawl && encounters.GetSide(PLAYER_SYMBOL) == 1,
+               "The player takes the side against their enemy");
+        gm.EndCombat();
+        Assert(!combat->IsInCombat() && !encounters.IsActive(brawl) && !npcs[first].is_in_combat && !npcs[first + 3].is_in_combat,
+               "Ending combat ends the player's encounter");
+        
+        std::cout << std::endl;
+    }
+
+    void TestCombatAI() {
+        std::cout << "[TEST SUITE] Combat AI\n";
+        
+        FResponseCurve falling{ ECurveShape::LINEAR, -1.0f, 0.0f, 1.0f };
+        FResponseCurve step{ ECurveShape::LOGISTIC, 10.0f, 0.5f, 0.0f };
+        Assert(falling.Evaluate(0.25f) == 0.75f && falling.Evaluate(2.0f) == 0.0f && step.Evaluate(0.5f) == 0.5f
+               && step.Evaluate(0.0f) < 0.1f && step.Evaluate(1.0f) > 0.9f, "Response curves shape and clamp their input");
+        
+        // A loaded musketman, one reloading, a wounded one and a dying civilian face three outsiders
+        GameManager gm;
+        gm.Initialize();
+        CombatSystem* combat = gm.GetCombatSystem();
+        EncounterManager& encounters = combat->GetEncounters();
+        combat->SetReplanInterval(0.0f);
+        const char* ids[] = { "npc_test_ai_loaded", "npc_test_ai_reloading", "npc_test_ai_wounded", "npc_test_ai_dying",
+                              "npc_test_ai_outsider_0", "npc_test_ai_outsider_1", "npc_test_ai_outsider_2" };
+        for (int i = 0; i < 7; ++i) {
+            FNPC npc;
+            npc.id = ids[i];
+            npc.faction = i == 3 ? EFaction::LDS_CIVILIAN : i < 3 ? EFaction::LEGION_SOLDIER : EFaction::OUTSIDER;
+            npc.position = { static_cast<float>(i), i < 4 ? 0.0f : 30.0f, 0.0f };
+            gm.SpawnNPC(npc);
+        }
+        std::vector<FNPC>& npcs = gm.GetAllNPCs();
+        uint32_t first = static_cast<uint32_t>(npcs.size() - 7);
+        FNPC& loaded = npcs[first];
+        FNPC& reloading = npcs[first + 1];
+        FNPC& wounded = npcs[first + 2];
+        FNPC& dying = npcs[first + 3];
+        wounded.health = 20.0f;
+        dying.health = 5.0f;
+        
+        FSymbol reloader(reloading.id);
+        combat->EquipWeapon(FSymbol(loaded.id), MakeSymbol("weapon_musket"));
+        combat->EquipWeapon(reloader, MakeSymbol("weapon_musket"));
+        for (int i = 0; i < 10 && !combat->GetWeaponState(reloader)->IsReloading(); ++i) {
+            combat->DischargeWeapon(reloader);
+            combat->AdvanceTime(combat->GetWeaponState(reloader)->cooldown);
+        }
+        
+        FEncounterId skirmish = encounters.StartEncounter(combat->GetClock());
+        for (uint32_t i = 0; i < 7; ++i) encounters.Join(skirmish, i < 4 ? 0 : 1, npcs, first + i);
+        combat->UpdateEnemyBehavior(npcs, gm.GetPlayerState(), 0.016f);
+        Assert(loaded.combat_action == ECombatAction::ENGAGE && reloading.combat_action == ECombatAction::RELOAD,
+               "Loaded men fire and empty ones reload");
+        Assert(wounded.combat_action == ECombatAction::TAKE_COVER && wounded.stance == EStance::BEHIND_COVER,
+               "The wounded take cover");
+        Assert(dying.combat_action == ECombatAction::RETREAT && !dying.is_in_combat
+               && loaded.combat_target_position.y == 30.0f, "The dying flee; the rest aim at the enemy side");
+        combat->UpdateEncounters(npcs, gm.GetPlayerState());
+        Assert(encounters.GetParticipantCount(skirmish) == 6, "Those who retreat leave the encounter");
+        
+        // Outnumbering a distant foe, they advance
+        FEncounterId pursuit = encounters.StartEncounter(combat->GetClock());
+        for (uint32_t i = 4; i < 7; ++i) encounters.Join(pursuit, 0, npcs, first + i);
+        encounters.Join(pursuit, 1, npcs, first + 2);
+        wounded.position = { 0, 200, 0 };
+        wounded.health = wounded.max_health;
+        combat->UpdateEnemyBehavior(npcs, gm.GetPlayerState(), 0.016f);
+        Assert(npcs[first + 4].combat_action == ECombatAction::ADVANCE && npcs[first + 4].stance == EStance::MOVING,
+               "A stronger side closes on a distant enemy");
+        
+        // At one decision per second each, a quarter of the combatants replan every quarter second
+        FEncounterId brawl = encounters.StartEncounter(combat->GetClock());
+        for (uint32_t i = 0; i < 8; ++i) {
+            FNPC brawler;
+            brawler.id = "npc_test_ai_brawler_" + std::to_string(i);
+            gm.SpawnNPC(brawler);
+        }
+        encounters.EndEncounter(skirmish, npcs);
+        encounters.EndEncounter(pursuit, npcs);
+        for (uint32_t i = 0; i < 8; ++i) encounters.Join(brawl, static_cast<uint8_t>(i % 2), npcs, static_cast<uint32_t>(npcs.size() - 8 + i));
+        auto decided = [&]() {
+            return std::count_if(npcs.end() - 8, npcs.end(), [](const FNPC& npc) { return npc.combat_action != ECombatAction::NONE; });
+        };
+        combat->SetReplanInterval(1.0f);
+        combat->UpdateEnemyBehavior(npcs, gm.GetPlayerState(), 0.25f);
+        long after_one = decided();
+        for (int i = 0; i < 3; ++i) combat->UpdateEnemyBehavior(npcs, gm.GetPlayerState(), 0.25f);
+        Assert(after_one == 2 && decided() == 8, "Replanning is spread over the interval");
+        
+        std::cout << std::endl;
+    }
+
+    void TestCrowdMorale() {
+        std::cout << "[TEST SUITE] Crowd Morale\n";
+        
+        // A loose crowd of a hundred on a 6 m grid; shots and a death at one corner
+        std::vector<FNPC> npcs(100);
+        FNPCTickList crowd;
+        for (uint32_t i = 0; i < 100; ++i) {
+            npcs[i].id = "npc_test_crowd_" + std::to_string(i);
+            npcs[i].position = { (i % 10) * 6.0f, (i / 10) * 6.0f, 0.0f };
+            crowd.Add(i, 0.1f);
+        }
+        npcs[0].is_in_combat = true;
+        CrowdMorale morale;
+        for (int shot = 0; shot < 6; ++shot) morale.AddStimulus({ 0, 0, 0 }, CrowdMorale::GUNFIRE_FEAR, 0.0f);
+        morale.AddStimulus({ -4, -4, 0 }, CrowdMorale::DEATH_FEAR, CrowdMorale::DEATH_ANGER);
+        morale.AddStimulus({ 500, 500, 0 }, 1.0f, 0.0f);
+        morale.Update(npcs, crowd);
+        const FNPC& near = npcs[11];
+        Assert(morale.GetMemberCount() == 100 && near.is_panicking && !npcs[99].is_panicking && npcs[99].fear == 0.0f,
+               "Frights panic those nearby and reach nobody far off");
+        Assert(near.flee_direction.x > 0.0f && near.flee_direction.y > 0.0f && near.stance == EStance::MOVING
+               && near.position.x > 6.0f && near.position.y > 6.0f, "The panicking flee away from the fright");
+        Assert(npcs[0].is_panicking && !npcs[0].is_in_combat && npcs[0].combat_action == ECombatAction::RETREAT,
+               "Panic breaks off a fight");
+        
+        for (int i = 0; i < 300; ++i) morale.Update(npcs, crowd);
+        Assert(morale.GetPanickingCount() == 0 && std::none_of(npcs.begin(), npcs.end(), [](const FNPC& npc) { return npc.is_panicking; })
+               && near.stance == EStance::STANDING, "Panic burns out once the shooting stops");
+        
+        // A packed, angry mob in a brawl stands its ground under the same fire and grows angrier
+        std::vector<FNPC> mob(50);
+        FNPCTickList mob_list;
+        for (uint32_t i = 0; i < 50; ++i) {
+            mob[i].position = { static_cast<float>(i % 7), static_cast<float>(i / 7), 0.0f };
+            mob[i].anger = 0.8f;
+            mob[i].is_in_combat = true;
+            mob_list.Add(i, 0.1f);
+        }
+        CrowdMorale mob_morale;
+        for (int shot = 0; shot < 6; ++shot) mob_morale.AddStimulus({ 0, 0, 0 }, CrowdMorale::GUNFIRE_FEAR, 0.0f);
+        for (int i = 0; i < 20; ++i) mob_morale.Update(mob, mob_list);
+        Assert(mob_morale.GetPanickingCount() == 0 && mob[0].is_in_combat && mob[0].anger > 0.8f
+               && mob_morale.GetCohesionAt(mob[0].position) > 0.8f, "A cohesive angry mob does not break");
+        
+        // Deaths and shots in the world reach the game's crowd
+        GameManager gm;
+        gm.Initialize();
+        gm.GetEventBus()->Publish(FCharacterDiedEvent{ MakeSymbol("npc_test_crowd_victim"), EDeathCause::WOUNDS, { 0, 0, 0 } });
+        gm.GetEventBus()->Publish(FGunfireEvent{ PLAYER_SYMBOL, { 0, 0, 0 } });
+        gm.GetEventBus()->Dispatch();
+        Assert(gm.GetCrowdMorale()->GetPendingStimulusCount() == 2, "Deaths and gunfire frighten the crowd");
+        
+        std::cout << std::endl;
+    }
+
     void PrintResults() {
         std::cout << "╔═══════════════════════════════════════════════════════════╗\n";
         std::cout << "║                      TEST RESULTS                          ║\n";
@@ -1,10 +1,72 @@
 #include "Engine/Game.h"
 #include "Engine/GameManager.h"
+#include "Engine/Log.h"
+#include "Engine/Profiler.h"
 #include <iostream>
 #include <string>
+#include <cstdlib>
+
+namespace {
+
+void PrintUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --headless              simulate without pausing for input and print a throughput report\n"
+              << "  --days N                game days to simulate in headless mode (default 1)\n"
+              << "  --npcs N                add N synthetic NPCs to the initial cast\n"
+              << "  --dt SECONDS            simulated seconds per tick (default 0.016)\n"
+              << "  --minutes-per-tick M    game minutes advanced per tick in headless mode (default 1)\n"
+              << "  --seed S                world seed\n"
+              << "  --record FILE           record inputs to a replay file\n"
+              << "  --replay FILE           replay a recorded session headless and verify checkpoints\n"
+              << "  --metrics FILE          append a JSON metrics snapshot every game hour in headless mode\n"
+              << "  --trace FILE            write a Chrome trace of profiler zones (profiling builds only)\n"
+              << "  --verbose               keep system console output in headless mode\n";
+}
+
+}  // namespace
 
 int main(int argc, char** argv) {
+    bool headless = false;
+    Nauvoo::FHeadlessOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool has_value = i + 1 < argc;
+
+        if (arg == "--headless") headless = true;
+        else if (arg == "--verbose") options.verbose = true;
+        else if (arg == "--days" && has_value) options.days = std::atoi(argv[++i]);
+        else if (arg == "--npcs" && has_value) options.extra_npcs = std::atoi(argv[++i]);
+        else if (arg == "--dt" && has_value) options.delta_time = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--minutes-per-tick" && has_value) options.game_minutes_per_tick = static_cast<float>(std::atof(argv[++i]));
+        else if (arg == "--seed" && has_value) options.world_seed = std::strtoull(argv[++i], nullptr, 10);
+        else if (arg == "--record" && has_value) options.record_file = argv[++i];
+        else if (arg == "--metrics" && has_value) options.metrics_file = argv[++i];
+        else if (arg == "--trace" && has_value) options.trace_file = argv[++i];
+        else if (arg == "--replay" && has_value) { options.replay_file = argv[++i]; headless = true; }
+        else {
+            PrintUsage(argv[0]);
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    if (options.delta_time <= 0.0f || options.game_minutes_per_tick <= 0.0f) {
+        std::cerr << "--dt and --minutes-per-tick must be positive" << std::endl;
+        return 1;
+    }
+
     try {
+        if (headless) {
+            Nauvoo::NauvooGame game;
+            Nauvoo::FHeadlessReport report = game.RunHeadless(options);
+            Nauvoo::Logger::Get().Flush();
+            report.Print();
+#if NAUVOO_PROFILING
+            Nauvoo::Profiler::Get().PrintStats();
+#endif
+            return report.replay_diverged ? 2 : 0;
+        }
+
         std::cout << "\n╔═══════════════════════════════════════════════════════════╗\n";
         std::cout << "║                                                           ║\n";
         std::cout << "║        NAUVOO: LEGION - Historical First-Person Game      ║\n";
@@ -19,6 +81,7 @@ int main(int argc, char** argv) {
         std::cin.get();
         
         game.Run();
+        Nauvoo::Logger::Get().Flush();
         
         std::cout << "\n[Main] Game loop ended" << std::endl;
         std::cout << "\n═══════════════════════════════════════════════════════════\n";